@@ -0,0 +1,13 @@
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <cstdint>
+
+// Heap allocation counter. Linking alloc_counter.cc into a binary replaces the global
+// operator new with a counting one, so hot paths can check that they stay off the
+// heap. Only C++ allocations are seen; malloc calls made by the gRPC core are not.
+
+// Number of operator new calls made so far by the calling thread.
+uint64_t ThreadAllocationCount();
+
+#endif // ALLOC_COUNTER_H
@@ -0,0 +1,312 @@
+#include "async_server.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+
+#include <grpcpp/alarm.h>
+
+#include "log.h"
+#include "outbound_queue.h"
+#include "stream_session.h"
+
+using grpc::ServerCompletionQueue;
+using grpc::ServerContext;
+using grpc::Status;
+
+using marketdata::ServerStats;
+using marketdata::StatsRequest;
+using marketdata::SubscriptionRequest;
+
+namespace {
+
+class AsyncStream;
+
+// Completion queue tag identifying which operation of which stream completed
+struct StreamTag {
+    enum Event { kConnected, kRead, kWrite, kWakeup, kTimer, kFinish };
+    AsyncStream* stream;
+    Event event;
+};
+
+// State machine for one async Subscribe stream. Everything except Enqueue runs on the
+// stream's completion queue thread. Enqueue may be called from any thread: it only
+// queues and, if the queue thread is not already draining, fires an alarm to wake
+// it. The scheduled_ flag marks which side owns draining so at most one wakeup or
+// write is ever outstanding. A second alarm, owned by the queue thread, wakes the
+// stream when a rate-limited conflated update becomes due.
+class AsyncStream final : public OutboundStream, public std::enable_shared_from_this<AsyncStream> {
+public:
+    // Starts waiting for the next incoming Subscribe call on this queue.
+    static void Accept(AsyncMarketDataServer::Service* service, ServerCompletionQueue* cq,
+                       PublisherEngine* engine, ServerMetrics* metrics, BatchOptions batching) {
+        std::shared_ptr<AsyncStream> stream(new AsyncStream(service, cq, engine, metrics, batching));
+        stream->self_ = stream;
+        service->RequestSubscribe(&stream->context_, &stream->stream_, cq, cq, &stream->connected_tag_);
+    }
+
+    bool Enqueue(OutboundItem item) override {
+        if (closed_.load() || broken_.load()) {
+            return false;
+        }
+        queue_.Push(std::move(item));
+        if (!scheduled_.exchange(true)) {
+            wakeup_.Set(cq_, std::chrono::system_clock::now(), &wakeup_tag_);
+        }
+        return true;
+    }
+
+    const OutboundQueue& queue() const override { return queue_; }
+
+    void OnEvent(StreamTag::Event event, bool ok) {
+        switch (event) {
+        case StreamTag::kConnected:
+            if (!ok) {
+                // The server is shutting down and will not deliver this call
+                self_.reset();
+                return;
+            }
+            Log() << "Client connected.";
+            Accept(service_, cq_, engine_, server_metrics_, queue_.batching());
+            server_metrics_->AddStream(shared_from_this(), context_.peer());
+            session_ = std::make_unique<StreamSession>(engine_, shared_from_this());
+            stream_.Read(&request_buffer_, &read_tag_);
+            break;
+
+        case StreamTag::kRead:
+            if (ok && DecodeRequest() && session_->HandleRequest(request_)) {
+                stream_.Read(&request_buffer_, &read_tag_);
+            } else {
+                BeginClose();
+            }
+            break;
+
+        case StreamTag::kWrite: {
+            // The write is outstanding until the transport has taken it, e.g. under flow control
+            StreamMetrics& stream_metrics = metrics();
+            AddToOwnCounter(stream_metrics.write_blocked_ns,
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(OutboundQueue::Clock::now() -
+                                                                                 write_start_)
+                                .count());
+            if (ok) {
+                AddToOwnCounter(stream_metrics.messages_sent, 1);
+                AddToOwnCounter(stream_metrics.bytes_sent, in_flight_->bytes().Length());
+            } else {
+                Log(LogLevel::kError) << "Failed to write update. Client likely disconnected.";
+                AddToSharedCounter(stream_metrics.updates_dropped, 1);
+                broken_.store(true);
+            }
+            in_flight_.reset();
+            Drain();
+            break;
+        }
+
+        case StreamTag::kWakeup:
+            Drain();
+            break;
+
+        case StreamTag::kTimer:
+            timer_armed_ = false;
+            if (finished_) {
+                self_.reset();
+            } else if (!scheduled_.exchange(true)) {
+                Drain();
+            }
+            // Otherwise the current owner re-evaluates due updates when its write completes
+            break;
+
+        case StreamTag::kFinish:
+            finished_ = true;
+            if (timer_armed_) {
+                // Release once the cancelled timer has come back from the queue
+                timer_.Cancel();
+            } else {
+                self_.reset();
+            }
+            break;
+        }
+    }
+
+private:
+    AsyncStream(AsyncMarketDataServer::Service* service, ServerCompletionQueue* cq, PublisherEngine* engine,
+                ServerMetrics* server_metrics, BatchOptions batching)
+        : service_(service), cq_(cq), engine_(engine), server_metrics_(server_metrics), stream_(&context_),
+          queue_(batching) {}
+
+    bool DecodeRequest() {
+        Status status = grpc::SerializationTraits<SubscriptionRequest>::Deserialize(&request_buffer_, &request_);
+        if (!status.ok()) {
+            Log(LogLevel::kError) << "Failed to decode subscription request: " << status.error_message();
+            return false;
+        }
+        return true;
+    }
+
+    // Called once the client has stopped sending (or the stream broke).
+    void BeginClose() {
+        Log() << "Client stream closed. Removing all subscriptions for this stream.";
+        session_->UnsubscribeAll();
+        session_.reset();
+        closed_.store(true);
+        if (!scheduled_.exchange(true)) {
+            Drain();
+        }
+        // Otherwise the outstanding write or wakeup will observe closed_ and finish the call
+    }
+
+    // Writes the next queued update. The caller must own scheduled_.
+    void Drain() {
+        while (true) {
+            if (closed_.load() || broken_.load()) {
+                AddToSharedCounter(metrics().updates_dropped, queue_.Clear());
+                if (closed_.load()) {
+                    // Keep ownership so no further wakeups are scheduled after Finish
+                    stream_.Finish(Status::OK, &finish_tag_);
+                    return;
+                }
+            } else {
+                OutboundQueue::Clock::time_point wake_at;
+                in_flight_ = queue_.Next(OutboundQueue::Clock::now(), &wake_at);
+                if (in_flight_) {
+                    // Hint gRPC to hold this write if more are already waiting behind it.
+                    // Not the first, which carries the initial metadata: gRPC holds a
+                    // hinted one until something else flushes the stream.
+                    grpc::WriteOptions options;
+                    if (queue_.batching().buffer_hints && queue_.HasPending() && headers_sent_) {
+                        options.set_buffer_hint();
+                    }
+                    headers_sent_ = true;
+                    write_start_ = OutboundQueue::Clock::now();
+                    stream_.Write(in_flight_->bytes(), options, &write_tag_);
+                    return;
+                }
+                if (wake_at != OutboundQueue::Clock::time_point::max()) {
+                    ArmTimer(wake_at);
+                }
+            }
+
+            scheduled_.store(false);
+            if (!queue_.HasPending() || scheduled_.exchange(true)) {
+                return;
+            }
+        }
+    }
+
+    void ArmTimer(OutboundQueue::Clock::time_point deadline) {
+        if (timer_armed_) {
+            if (deadline < timer_deadline_) {
+                // Comes back early as cancelled and is re-armed for the earlier deadline
+                timer_.Cancel();
+            }
+            return;
+        }
+        timer_armed_ = true;
+        timer_deadline_ = deadline;
+        auto delay = deadline - OutboundQueue::Clock::now();
+        timer_.Set(cq_, std::chrono::system_clock::now() +
+                            std::chrono::duration_cast<std::chrono::system_clock::duration>(delay),
+                   &timer_tag_);
+    }
+
+    AsyncMarketDataServer::Service* service_;
+    ServerCompletionQueue* cq_;
+    PublisherEngine* engine_;
+    ServerMetrics* server_metrics_;
+
+    ServerContext context_;
+    grpc::ServerAsyncReaderWriter<grpc::ByteBuffer, grpc::ByteBuffer> stream_;
+    grpc::ByteBuffer request_buffer_;
+    SubscriptionRequest request_;
+    std::unique_ptr<StreamSession> session_;
+
+    // Keeps the stream alive while it has operations outstanding on the queue
+    std::shared_ptr<AsyncStream> self_;
+
+    OutboundQueue queue_;
+    std::shared_ptr<const EncodedUpdate> in_flight_;
+    OutboundQueue::Clock::time_point write_start_;
+    std::atomic<bool> scheduled_{false};
+    std::atomic<bool> closed_{false};
+    std::atomic<bool> broken_{false};
+    grpc::Alarm wakeup_;
+
+    // Queue-thread only
+    grpc::Alarm timer_;
+    bool timer_armed_ = false;
+    OutboundQueue::Clock::time_point timer_deadline_;
+    bool finished_ = false;
+    bool headers_sent_ = false;
+
+    StreamTag connected_tag_{this, StreamTag::kConnected};
+    StreamTag read_tag_{this, StreamTag::kRead};
+    StreamTag write_tag_{this, StreamTag::kWrite};
+    StreamTag wakeup_tag_{this, StreamTag::kWakeup};
+    StreamTag timer_tag_{this, StreamTag::kTimer};
+    StreamTag finish_tag_{this, StreamTag::kFinish};
+};
+
+} // namespace
+
+grpc::Status AsyncMarketDataServer::Service::GetStats(ServerContext* /*context*/, const StatsRequest* /*request*/,
+                                                      ServerStats* response) {
+    metrics_->Collect(response);
+    return Status::OK;
+}
+
+AsyncMarketDataServer::AsyncMarketDataServer(PublisherEngine* engine, ServerMetrics* metrics, BatchOptions batching,
+                                             size_t num_queues)
+    : engine_(engine), metrics_(metrics), batching_(batching), num_queues_(num_queues), service_(metrics) {
+    if (num_queues_ == 0) {
+        num_queues_ = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+AsyncMarketDataServer::~AsyncMarketDataServer() {
+    Shutdown();
+}
+
+void AsyncMarketDataServer::Run(const std::string& server_address, TransportProfile profile) {
+    grpc::ServerBuilder builder;
+    // Listen on the given address without any authentication mechanism.
+    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    ApplyTransportProfile(profile, &builder);
+    builder.RegisterService(&service_);
+    for (size_t i = 0; i < num_queues_; ++i) {
+        queues_.push_back(builder.AddCompletionQueue());
+    }
+
+    server_ = builder.BuildAndStart();
+    std::cout << "Async server listening on " << server_address << " with "
+              << num_queues_ << " completion queues" << std::endl;
+
+    for (auto& cq : queues_) {
+        AsyncStream::Accept(&service_, cq.get(), engine_, metrics_, batching_);
+        threads_.emplace_back(&AsyncMarketDataServer::PollQueue, this, cq.get());
+    }
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+    threads_.clear();
+}
+
+void AsyncMarketDataServer::Shutdown() {
+    // The engine should be stopped first so no wakeups are scheduled on a dead queue.
+    if (!server_) {
+        return;
+    }
+    server_->Shutdown();
+    for (auto& cq : queues_) {
+        cq->Shutdown();
+    }
+    server_.reset();
+}
+
+void AsyncMarketDataServer::PollQueue(ServerCompletionQueue* cq) {
+    void* tag;
+    bool ok;
+    while (cq->Next(&tag, &ok)) {
+        StreamTag* stream_tag = static_cast<StreamTag*>(tag);
+        stream_tag->stream->OnEvent(stream_tag->event, ok);
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef ASYNC_SERVER_H
+#define ASYNC_SERVER_H
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "market_data.grpc.pb.h"
+#include "outbound_queue.h"
+#include "publisher_engine.h"
+#include "server_metrics.h"
+#include "transport_profile.h"
+
+// Completion-queue based server mode. Streams are driven by a per-stream state
+// machine on one of a fixed set of completion queues (one per core, each polled by
+// a single thread), so no gRPC thread is tied up for the lifetime of a stream and
+// idle or slow subscribers cost memory rather than threads.
+class AsyncMarketDataServer {
+public:
+    // Subscribe is served raw: requests are decoded by the stream, and updates are
+    // written as the bytes they were encoded to once, when published. GetStats is rare
+    // and cheap, so it stays a synchronous method served by gRPC's own threads.
+    class Service final
+        : public marketdata::MarketDataService::WithRawMethod_Subscribe<marketdata::MarketDataService::Service> {
+    public:
+        explicit Service(ServerMetrics* metrics) : metrics_(metrics) {}
+
+        grpc::Status GetStats(grpc::ServerContext* context, const marketdata::StatsRequest* request,
+                              marketdata::ServerStats* response) override;
+
+    private:
+        ServerMetrics* metrics_;
+    };
+
+    // num_queues == 0 uses one completion queue per hardware thread.
+    AsyncMarketDataServer(PublisherEngine* engine, ServerMetrics* metrics, BatchOptions batching = BatchOptions(),
+                          size_t num_queues = 0);
+    ~AsyncMarketDataServer();
+
+    // Builds and starts the server, then blocks until Shutdown is called.
+    void Run(const std::string& server_address, TransportProfile profile = TransportProfile::kDefault);
+
+    void Shutdown();
+
+private:
+    void PollQueue(grpc::ServerCompletionQueue* cq);
+
+    PublisherEngine* engine_;
+    ServerMetrics* metrics_;
+    BatchOptions batching_;
+    size_t num_queues_;
+    Service service_;
+    std::unique_ptr<grpc::Server> server_;
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> queues_;
+    std::vector<std::thread> threads_;
+};
+
+#endif // ASYNC_SERVER_H
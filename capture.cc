@@ -0,0 +1,74 @@
+#include "capture.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+uint64_t CaptureInstrumentKey(const std::string& instrument_id) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : instrument_id) {
+        hash = (hash ^ c) * 1099511628211ull;
+    }
+    return hash;
+}
+
+std::shared_ptr<const CaptureFile> CaptureFile::Open(const std::string& path, std::string* error) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        *error = "cannot open " + path + ": " + std::strerror(errno);
+        return nullptr;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(kCaptureMagic)) {
+        close(fd);
+        *error = path + " is not a capture file";
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(info.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps the file alive on its own
+    close(fd);
+    if (data == MAP_FAILED) {
+        *error = "cannot map " + path + ": " + std::strerror(errno);
+        return nullptr;
+    }
+    if (std::memcmp(data, kCaptureMagic, sizeof(kCaptureMagic)) != 0) {
+        munmap(data, size);
+        *error = path + " is not a capture file";
+        return nullptr;
+    }
+    return std::shared_ptr<const CaptureFile>(new CaptureFile(static_cast<const char*>(data), size));
+}
+
+CaptureFile::~CaptureFile() {
+    munmap(const_cast<char*>(data_), size_);
+}
+
+size_t CaptureFile::Find(size_t offset, uint64_t instrument_key) const {
+    CaptureRecordHeader header;
+    while (offset + sizeof(header) <= size_) {
+        std::memcpy(&header, data_ + offset, sizeof(header));
+        if (header.length > size_ - offset - sizeof(header)) {
+            break;
+        }
+        if (header.instrument_key == instrument_key) {
+            return offset;
+        }
+        offset += sizeof(header) + header.length;
+    }
+    return size_;
+}
+
+size_t CaptureFile::Read(size_t offset, Record* record) const {
+    CaptureRecordHeader header;
+    std::memcpy(&header, data_ + offset, sizeof(header));
+    record->timestamp_ns = header.timestamp_ns;
+    record->instrument_key = header.instrument_key;
+    record->data = data_ + offset + sizeof(header);
+    record->size = header.length;
+    return offset + sizeof(header) + header.length;
+}
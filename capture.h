@@ -0,0 +1,70 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// Capture files hold recorded market data for replay. A file is kCaptureMagic
+// followed by records, each a CaptureRecordHeader and then a serialized
+// MarketDataUpdate of header.length bytes. Every record carries one snapshot or
+// incremental update of a single instrument, named by instrument_key; records with
+// a key of 0 (such as symbol directories) belong to no instrument and are skipped on
+// replay. Fields are in host byte order (little-endian on every supported target).
+constexpr char kCaptureMagic[8] = {'M', 'D', 'C', 'A', 'P', '0', '0', '1'};
+
+struct CaptureRecordHeader {
+    uint32_t length;
+    uint32_t reserved;
+    // When the update was recorded, in nanoseconds since the epoch
+    int64_t timestamp_ns;
+    uint64_t instrument_key;
+};
+static_assert(sizeof(CaptureRecordHeader) == 24, "capture records have a fixed 24 byte header");
+
+// Key naming an instrument in capture records: the 64-bit FNV-1a hash of its id,
+// so readers can skip other instruments' records without decoding them.
+uint64_t CaptureInstrumentKey(const std::string& instrument_id);
+
+// A capture file mapped read-only into memory. Opening it only maps it; pages are
+// read in as records are reached, so opening is instant regardless of size. Records
+// are addressed by byte offset and their payloads are served in place.
+class CaptureFile {
+public:
+    struct Record {
+        int64_t timestamp_ns;
+        uint64_t instrument_key;
+        const void* data;
+        size_t size;
+    };
+
+    // Returns nullptr and sets *error if the file cannot be mapped or is not a capture.
+    static std::shared_ptr<const CaptureFile> Open(const std::string& path, std::string* error);
+
+    ~CaptureFile();
+    CaptureFile(const CaptureFile&) = delete;
+    CaptureFile& operator=(const CaptureFile&) = delete;
+
+    // Offset of the first record.
+    size_t begin() const { return sizeof(kCaptureMagic); }
+
+    // Offset of the first complete record at or after offset whose key is
+    // instrument_key, or end() if there is none. A record cut short at the end of the
+    // file, as left by an interrupted recorder, is treated as the end.
+    size_t Find(size_t offset, uint64_t instrument_key) const;
+
+    // Reads the complete record at offset, as returned by Find, and returns the offset
+    // just past it.
+    size_t Read(size_t offset, Record* record) const;
+
+    size_t end() const { return size_; }
+
+private:
+    CaptureFile(const char* data, size_t size) : data_(data), size_(size) {}
+
+    const char* data_;
+    size_t size_;
+};
+
+#endif // CAPTURE_H
@@ -0,0 +1,231 @@
+#include "capture_recorder.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "capture.h"
+#include "log.h"
+
+using marketdata::MarketDataUpdate;
+
+namespace {
+
+// Size of each recording buffer, and so of the writes the writer thread makes
+constexpr size_t kBufferSize = 4 * 1024 * 1024;
+
+// Buffers that may be waiting for the disk before updates are dropped
+constexpr size_t kMaxBuffers = 16;
+
+// How long a partially filled buffer may wait before it is written anyway
+constexpr std::chrono::milliseconds kFlushInterval(100);
+
+int CreateFile(const std::string& path, std::string* error) {
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        *error = "cannot create " + path + ": " + std::strerror(errno);
+        return -1;
+    }
+    if (write(fd, kCaptureMagic, sizeof(kCaptureMagic)) != static_cast<ssize_t>(sizeof(kCaptureMagic))) {
+        *error = "cannot write " + path + ": " + std::strerror(errno);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+} // namespace
+
+std::unique_ptr<CaptureRecorder> CaptureRecorder::Open(const std::string& path, uint64_t max_file_bytes,
+                                                       std::string* error) {
+    int fd = CreateFile(path, error);
+    if (fd < 0) {
+        return nullptr;
+    }
+    return std::unique_ptr<CaptureRecorder>(new CaptureRecorder(path, max_file_bytes, fd));
+}
+
+CaptureRecorder::CaptureRecorder(std::string path, uint64_t max_file_bytes, int fd)
+    : path_(std::move(path)), max_file_bytes_(max_file_bytes), file_bytes_(sizeof(kCaptureMagic)), fd_(fd),
+      bytes_written_(sizeof(kCaptureMagic)) {
+    // Two buffers up front let recording continue while the first one is written
+    for (int i = 0; i < 2; ++i) {
+        auto buffer = std::make_unique<Buffer>();
+        buffer->data.resize(kBufferSize);
+        free_.push_back(std::move(buffer));
+        ++buffers_;
+    }
+    thread_ = std::thread([this]() { WriterLoop(); });
+}
+
+CaptureRecorder::~CaptureRecorder() {
+    Close();
+}
+
+bool CaptureRecorder::Record(uint64_t instrument_key, int64_t timestamp_ns, const MarketDataUpdate& update) {
+    CaptureRecordHeader header;
+    header.length = static_cast<uint32_t>(update.ByteSizeLong());
+    header.reserved = 0;
+    header.timestamp_ns = timestamp_ns;
+    header.instrument_key = instrument_key;
+    size_t size = sizeof(header) + header.length;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closing_ || !EnsureSpace(size)) {
+        ++dropped_;
+        return false;
+    }
+    uint8_t* out = reinterpret_cast<uint8_t*>(active_->data.data() + active_->used);
+    std::memcpy(out, &header, sizeof(header));
+    update.SerializeWithCachedSizesToArray(out + sizeof(header));
+    active_->used += size;
+    file_bytes_ += size;
+    ++records_;
+    return true;
+}
+
+bool CaptureRecorder::RotateIfFull() {
+    if (max_file_bytes_ == 0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_bytes_ < max_file_bytes_ || closing_) {
+        return false;
+    }
+    if (active_ && active_->used > 0) {
+        full_.push_back(std::move(active_));
+        cv_.notify_one();
+    }
+    if (active_) {
+        active_->new_file = true;
+    } else {
+        pending_new_file_ = true;
+    }
+    file_bytes_ = sizeof(kCaptureMagic);
+    return true;
+}
+
+bool CaptureRecorder::EnsureSpace(size_t size) {
+    if (active_ && active_->data.size() - active_->used >= size) {
+        return true;
+    }
+    if (active_ && active_->used > 0) {
+        full_.push_back(std::move(active_));
+        cv_.notify_one();
+    }
+    if (!active_) {
+        if (!free_.empty()) {
+            active_ = std::move(free_.back());
+            free_.pop_back();
+        } else if (buffers_ < kMaxBuffers) {
+            active_ = std::make_unique<Buffer>();
+            active_->data.resize(kBufferSize);
+            ++buffers_;
+        } else {
+            return false;
+        }
+        active_->new_file = pending_new_file_;
+        pending_new_file_ = false;
+    }
+    if (active_->data.size() < size) {
+        // A record larger than a whole buffer gets a buffer of its own size
+        active_->data.resize(size);
+    }
+    return true;
+}
+
+void CaptureRecorder::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closing_) {
+            return;
+        }
+        closing_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+    close(fd_);
+
+    std::cout << "Recorded " << records_ << " updates (" << bytes_written_ << " bytes) to " << file_index_ + 1
+              << " capture file(s); dropped " << dropped_ << "." << std::endl;
+}
+
+void CaptureRecorder::WriterLoop() {
+    std::vector<std::unique_ptr<Buffer>> writing;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait_for(lock, kFlushInterval, [this]() { return !full_.empty() || closing_; });
+        if (full_.empty() && active_ && active_->used > 0) {
+            // Nothing filled up in time: write what there is
+            full_.push_back(std::move(active_));
+        }
+        if (full_.empty()) {
+            if (closing_) {
+                return;
+            }
+            continue;
+        }
+
+        writing.swap(full_);
+        lock.unlock();
+        for (const auto& buffer : writing) {
+            WriteBuffer(*buffer);
+        }
+        lock.lock();
+        for (auto& buffer : writing) {
+            buffer->used = 0;
+            buffer->new_file = false;
+            free_.push_back(std::move(buffer));
+        }
+        writing.clear();
+    }
+}
+
+void CaptureRecorder::WriteBuffer(const Buffer& buffer) {
+    if (failed_) {
+        return;
+    }
+    if (buffer.new_file && !OpenNextFile()) {
+        failed_ = true;
+        return;
+    }
+    const char* data = buffer.data.data();
+    size_t left = buffer.used;
+    while (left > 0) {
+        ssize_t written = write(fd_, data, left);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            Log(LogLevel::kError) << "Capture write to " << FileName(file_index_) << " failed: " << std::strerror(errno)
+                                  << ". Recording stopped.";
+            failed_ = true;
+            return;
+        }
+        data += written;
+        left -= written;
+        bytes_written_ += written;
+    }
+}
+
+bool CaptureRecorder::OpenNextFile() {
+    close(fd_);
+    ++file_index_;
+    std::string error;
+    fd_ = CreateFile(FileName(file_index_), &error);
+    if (fd_ < 0) {
+        Log(LogLevel::kError) << "Capture rotation failed: " << error << ". Recording stopped.";
+        return false;
+    }
+    bytes_written_ += sizeof(kCaptureMagic);
+    Log() << "Recording to " << FileName(file_index_);
+    return true;
+}
+
+std::string CaptureRecorder::FileName(uint64_t index) const {
+    return index == 0 ? path_ : path_ + "." + std::to_string(index);
+}
@@ -0,0 +1,89 @@
+#ifndef CAPTURE_RECORDER_H
+#define CAPTURE_RECORDER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "market_data.pb.h"
+
+// Appends received updates to capture files (see capture.h) from a dedicated writer
+// thread. Record serializes each update straight into a large in-memory buffer;
+// full buffers, and the partial one every flush interval, are handed to the writer,
+// which writes them out in one call each. The recording thread only takes a lock for
+// the buffer hand-off, never waits on the disk, and does not allocate once its
+// buffers exist; if the disk falls far enough behind that every buffer is waiting,
+// updates are dropped and counted instead.
+//
+// With a file size limit, recording rotates: the first file is the given path, later
+// ones add ".1", ".2" and so on.
+class CaptureRecorder {
+public:
+    // Returns nullptr and sets *error if the first file cannot be created.
+    // max_file_bytes of 0 disables rotation.
+    static std::unique_ptr<CaptureRecorder> Open(const std::string& path, uint64_t max_file_bytes,
+                                                 std::string* error);
+
+    ~CaptureRecorder();
+    CaptureRecorder(const CaptureRecorder&) = delete;
+    CaptureRecorder& operator=(const CaptureRecorder&) = delete;
+
+    // Records one update of an instrument. Returns false if it had to be dropped.
+    bool Record(uint64_t instrument_key, int64_t timestamp_ns, const marketdata::MarketDataUpdate& update);
+
+    // Starts a new file if the current one has reached the size limit. Returns true if
+    // it did, so the caller can record the snapshots that make the new file replayable
+    // on its own.
+    bool RotateIfFull();
+
+    // Writes out everything recorded and stops the writer. Called by the destructor.
+    void Close();
+
+private:
+    struct Buffer {
+        std::vector<char> data;
+        size_t used = 0;
+        // The buffer opens the next file
+        bool new_file = false;
+    };
+
+    CaptureRecorder(std::string path, uint64_t max_file_bytes, int fd);
+
+    // Makes a buffer with room for size bytes active. Called with mutex_ held.
+    bool EnsureSpace(size_t size);
+    void WriterLoop();
+    void WriteBuffer(const Buffer& buffer);
+    bool OpenNextFile();
+    std::string FileName(uint64_t index) const;
+
+    const std::string path_;
+    const uint64_t max_file_bytes_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::unique_ptr<Buffer> active_;
+    std::vector<std::unique_ptr<Buffer>> full_;
+    std::vector<std::unique_ptr<Buffer>> free_;
+    size_t buffers_ = 0;
+    // The next buffer taken opens a new file
+    bool pending_new_file_ = false;
+    bool closing_ = false;
+    // Bytes recorded into the current file, counted when recorded rather than written
+    uint64_t file_bytes_ = 0;
+    uint64_t records_ = 0;
+    uint64_t dropped_ = 0;
+
+    // Writer thread only
+    int fd_;
+    uint64_t file_index_ = 0;
+    uint64_t bytes_written_ = 0;
+    bool failed_ = false;
+
+    std::thread thread_;
+};
+
+#endif // CAPTURE_RECORDER_H
@@ -0,0 +1,48 @@
+#include "compact_levels.h"
+
+#include <limits>
+
+using marketdata::OrderBookIncrementalUpdate;
+using marketdata::PriceLevel;
+
+namespace {
+
+// Appends one side's levels, delta-encoding each price against the previous level's.
+// Returns false if a gap is too wide for a delta.
+bool AppendSide(const google::protobuf::RepeatedPtrField<PriceLevel>& levels, int64_t* previous_ticks,
+                OrderBookIncrementalUpdate* update) {
+    for (const PriceLevel& level : levels) {
+        int64_t delta = level.price_ticks() - *previous_ticks;
+        if (delta < std::numeric_limits<int32_t>::min() || delta > std::numeric_limits<int32_t>::max()) {
+            return false;
+        }
+        update->add_price_deltas(static_cast<int32_t>(delta));
+        update->add_quantity_lots(static_cast<uint64_t>(std::max<int64_t>(0, level.quantity_lots())));
+        *previous_ticks = level.price_ticks();
+    }
+    return true;
+}
+
+} // namespace
+
+bool CompactLevels(OrderBookIncrementalUpdate* update) {
+    if (update->bid_updates().empty() && update->ask_updates().empty()) {
+        return true;
+    }
+    // The first level's delta is 0; the base carries its price
+    int64_t previous_ticks = !update->bid_updates().empty() ? update->bid_updates(0).price_ticks()
+                                                            : update->ask_updates(0).price_ticks();
+    update->set_base_price_ticks(previous_ticks);
+    if (!AppendSide(update->bid_updates(), &previous_ticks, update) ||
+        !AppendSide(update->ask_updates(), &previous_ticks, update)) {
+        update->clear_base_price_ticks();
+        update->clear_price_deltas();
+        update->clear_quantity_lots();
+        return false;
+    }
+    update->set_bid_count(static_cast<uint32_t>(update->bid_updates_size()));
+    // Cleared rather than released, so a pooled update keeps the level messages for reuse
+    update->mutable_bid_updates()->Clear();
+    update->mutable_ask_updates()->Clear();
+    return true;
+}
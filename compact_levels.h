@@ -0,0 +1,38 @@
+#ifndef COMPACT_LEVELS_H
+#define COMPACT_LEVELS_H
+
+#include <algorithm>
+#include <cstdint>
+
+#include "market_data.pb.h"
+
+// Compact encoding of the level changes of a fixed-point incremental update. Instead
+// of a PriceLevel message per level, which costs a tag, a length and two tagged
+// fields, the levels go into packed fields of the update itself: one zigzag price
+// delta in ticks and one quantity varint per level, and the number of bids (see
+// OrderBookIncrementalUpdate in market_data.proto). Deletions are a quantity of 0,
+// as in PriceLevel, so a level needs no separate action.
+
+// Moves the bid_updates and ask_updates of a fixed-point update into the compact
+// fields, bids first, each side in its original order. Returns false and leaves the
+// update as it is if a price gap does not fit a delta.
+bool CompactLevels(marketdata::OrderBookIncrementalUpdate* update);
+
+inline bool HasCompactLevels(const marketdata::OrderBookIncrementalUpdate& update) {
+    return !update.price_deltas().empty();
+}
+
+// Calls f(is_bid, price_ticks, quantity_lots) for each compact level in order, straight
+// from the packed fields.
+template <typename F>
+void ForEachCompactLevel(const marketdata::OrderBookIncrementalUpdate& update, F&& f) {
+    // A malformed update with fewer quantities than prices is cut short
+    int count = std::min(update.price_deltas_size(), update.quantity_lots_size());
+    int64_t price_ticks = update.base_price_ticks();
+    for (int i = 0; i < count; ++i) {
+        price_ticks += update.price_deltas(i);
+        f(static_cast<uint32_t>(i) < update.bid_count(), price_ticks, static_cast<int64_t>(update.quantity_lots(i)));
+    }
+}
+
+#endif // COMPACT_LEVELS_H
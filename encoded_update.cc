@@ -0,0 +1,79 @@
+#include "encoded_update.h"
+
+#include <string>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
+
+using google::protobuf::io::CodedOutputStream;
+
+using marketdata::MarketDataBatch;
+using marketdata::MarketDataUpdate;
+
+namespace {
+
+// Longest encoding of a 32-bit varint
+constexpr size_t kMaxVarint32Bytes = 5;
+
+// Tag of a length-delimited field
+uint32_t LengthDelimitedTag(int field_number) {
+    return (static_cast<uint32_t>(field_number) << 3) | 2;
+}
+
+// Appends a field header: the tag followed by the length of the field's contents.
+void AppendFieldHeader(int field_number, size_t length, std::string* out) {
+    uint8_t header[2 * kMaxVarint32Bytes];
+    uint8_t* end = CodedOutputStream::WriteVarint32ToArray(LengthDelimitedTag(field_number), header);
+    end = CodedOutputStream::WriteVarint32ToArray(static_cast<uint32_t>(length), end);
+    out->append(reinterpret_cast<const char*>(header), end - header);
+}
+
+} // namespace
+
+void EncodedUpdate::Encode() {
+    // Serialization needs an empty buffer; a recycled update still holds its last encoding
+    bytes_.Clear();
+    bool own_buffer;
+    grpc::SerializationTraits<MarketDataUpdate>::Serialize(message_, &bytes_, &own_buffer);
+}
+
+std::shared_ptr<const EncodedUpdate> EncodeBatch(const std::vector<std::shared_ptr<const EncodedUpdate>>& updates) {
+    // MarketDataUpdate { batch: MarketDataBatch { updates: MarketDataUpdate... } }. An
+    // embedded message is encoded exactly like the message itself, so each update's
+    // bytes only need a field header in front of them.
+    std::string headers;
+    std::vector<size_t> header_ends;
+    header_ends.reserve(updates.size());
+    size_t batch_length = 0;
+    for (const auto& update : updates) {
+        AppendFieldHeader(MarketDataBatch::kUpdatesFieldNumber, update->bytes().Length(), &headers);
+        header_ends.push_back(headers.size());
+        batch_length += update->bytes().Length();
+    }
+    batch_length += headers.size();
+
+    // All headers share one slice, cut into a sub-slice in front of each update
+    std::string framing;
+    AppendFieldHeader(MarketDataUpdate::kBatchFieldNumber, batch_length, &framing);
+    size_t outer_length = framing.size();
+    framing += headers;
+    grpc::Slice framing_slice(framing);
+
+    std::vector<grpc::Slice> slices;
+    slices.push_back(framing_slice.sub(0, outer_length));
+    std::vector<grpc::Slice> update_slices;
+    size_t header_begin = outer_length;
+    for (size_t i = 0; i < updates.size(); ++i) {
+        size_t header_end = outer_length + header_ends[i];
+        slices.push_back(framing_slice.sub(header_begin, header_end));
+        header_begin = header_end;
+
+        update_slices.clear();
+        updates[i]->bytes().Dump(&update_slices);
+        slices.insert(slices.end(), update_slices.begin(), update_slices.end());
+    }
+
+    auto batch = std::make_shared<EncodedUpdate>();
+    batch->SetBytes(grpc::ByteBuffer(slices.data(), slices.size()));
+    return batch;
+}
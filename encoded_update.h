@@ -0,0 +1,43 @@
+#ifndef ENCODED_UPDATE_H
+#define ENCODED_UPDATE_H
+
+#include <memory>
+#include <vector>
+
+#include <grpcpp/support/byte_buffer.h>
+
+#include "market_data.pb.h"
+
+// A market data update together with its wire encoding. Updates are serialized once,
+// by whoever builds them, and the encoded bytes are shared by every stream the update
+// is fanned out to: writing them costs a slice reference per stream instead of a
+// serialization per stream.
+class EncodedUpdate {
+public:
+    EncodedUpdate() = default;
+    explicit EncodedUpdate(marketdata::MarketDataUpdate message) : message_(std::move(message)) { Encode(); }
+
+    const marketdata::MarketDataUpdate& message() const { return message_; }
+
+    // For an update about to be rebuilt; Encode must be called once it is done.
+    marketdata::MarketDataUpdate* mutable_message() { return &message_; }
+
+    // Serializes the message into bytes().
+    void Encode();
+
+    // Wraps bytes that are already a serialized MarketDataUpdate. message() is left
+    // empty, so such updates can only be written, not inspected.
+    void SetBytes(grpc::ByteBuffer bytes) { bytes_ = std::move(bytes); }
+
+    const grpc::ByteBuffer& bytes() const { return bytes_; }
+
+private:
+    marketdata::MarketDataUpdate message_;
+    grpc::ByteBuffer bytes_;
+};
+
+// Builds a MarketDataBatch update out of encoded updates by framing their bytes,
+// without decoding or re-serializing any of them. The result carries bytes only.
+std::shared_ptr<const EncodedUpdate> EncodeBatch(const std::vector<std::shared_ptr<const EncodedUpdate>>& updates);
+
+#endif // ENCODED_UPDATE_H
@@ -0,0 +1,382 @@
+#include "feed_handler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include <google/protobuf/arena.h>
+#include <grpcpp/grpcpp.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "market_data.grpc.pb.h"
+#include "market_data.pb.h"
+
+#include "log.h"
+#include "spsc_ring.h"
+
+using grpc::ChannelArguments;
+using grpc::ClientContext;
+using grpc::ClientReaderWriter;
+using grpc::Status;
+
+using google::protobuf::Arena;
+using google::protobuf::ArenaOptions;
+
+using marketdata::MarketDataService;
+using marketdata::MarketDataUpdate;
+using marketdata::OrderBookIncrementalUpdate;
+using marketdata::SubscriptionRequest;
+
+namespace {
+
+// Memory each shard decodes a message into, as in the single-stream client
+constexpr size_t kReadArenaSize = 64 * 1024;
+
+int64_t SteadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool SameLevel(const BookLevel& a, const BookLevel& b) {
+    return a.price_ticks == b.price_ticks && a.quantity == b.quantity;
+}
+
+// Copies the top depth levels of a side, zeroing the rest; returns the levels copied.
+template <typename BookSideT>
+uint32_t CopySide(const BookSideT& side, size_t depth, BookLevel* levels) {
+    size_t count = std::min(depth, side.depth());
+    for (size_t i = 0; i < count; ++i) {
+        levels[i] = side.level(i);
+    }
+    std::fill(levels + count, levels + kMaxPublishedDepth, BookLevel{});
+    return static_cast<uint32_t>(count);
+}
+
+void PinToCpu(int cpu) {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    int error = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    if (error != 0) {
+        Log(LogLevel::kError) << "Cannot pin feed handler thread to CPU " << cpu << ": " << std::strerror(error);
+    }
+}
+
+} // namespace
+
+// State of one shard. Everything but the rings' consumer side, the counters and the
+// context (for cancellation) belongs to the shard's thread.
+struct FeedHandler::Shard {
+    struct Book {
+        size_t instrument = 0;
+        std::string instrument_id;
+        // A subscription of up to kMaxPublishedDepth levels never sends more than the
+        // bounded book holds; full-depth and deeper ones are kept in a whole book
+        bool full_depth = false;
+        BasicOrderBook<kMaxPublishedDepth> top_levels;
+        OrderBook all_levels;
+        // Sequence number the book is up to date with
+        uint64_t sequence = 0;
+        // Waiting for a requested snapshot after a gap
+        bool recovering = false;
+        BookTop published;
+
+        // Calls f with whichever book is in use
+        template <typename F>
+        void Visit(F&& f) {
+            if (full_depth) {
+                f(all_levels);
+            } else {
+                f(top_levels);
+            }
+        }
+    };
+
+    size_t index = 0;
+    // Levels per side subscribed to, 0 for the full book
+    size_t subscription_depth = 0;
+    std::vector<Book> books;
+    std::unordered_map<std::string, Book*> books_by_id;
+    std::vector<Book*> books_by_handle;
+
+    std::unique_ptr<ClientContext> context;
+    std::unique_ptr<ClientReaderWriter<SubscriptionRequest, MarketDataUpdate>> stream;
+    std::thread thread;
+
+    // One ring per consumer
+    std::vector<std::unique_ptr<SpscRing<BookEvent>>> rings;
+    std::atomic<uint64_t> messages{0};
+    std::atomic<uint64_t> dropped_events{0};
+
+    // Receive time of the message being processed
+    int64_t receive_ns = 0;
+
+    void Process(FeedHandler& handler, const MarketDataUpdate& update);
+    bool CheckSequence(Book& book, const OrderBookIncrementalUpdate& update);
+    void Publish(FeedHandler& handler, Book& book, bool snapshot);
+    bool WriteRequest(SubscriptionRequest::Action action, const std::vector<std::string>& instrument_ids);
+};
+
+FeedHandler::FeedHandler(FeedHandlerOptions options) : options_(std::move(options)) {
+    options_.shards = std::max<size_t>(1, std::min(options_.shards, std::max<size_t>(1, options_.instruments.size())));
+    options_.depth = std::min(options_.depth, kMaxPublishedDepth);
+    options_.consumers = std::max<size_t>(1, options_.consumers);
+
+    for (size_t i = 0; i < options_.shards; ++i) {
+        auto shard = std::make_unique<Shard>();
+        shard->index = i;
+        shard->subscription_depth = options_.subscription_depth;
+        for (size_t c = 0; c < options_.consumers; ++c) {
+            shard->rings.push_back(std::make_unique<SpscRing<BookEvent>>(options_.ring_capacity));
+        }
+        shards_.push_back(std::move(shard));
+    }
+    for (size_t i = 0; i < options_.instruments.size(); ++i) {
+        indices_.emplace(options_.instruments[i], i);
+        tops_.push_back(std::make_unique<PublishedTop>());
+        Shard& shard = *shards_[i % shards_.size()];
+        shard.books.emplace_back();
+        shard.books.back().instrument = i;
+        shard.books.back().instrument_id = options_.instruments[i];
+        shard.books.back().full_depth =
+            options_.subscription_depth == 0 || options_.subscription_depth > kMaxPublishedDepth;
+    }
+    // The books no longer move, so they can be indexed by address
+    for (auto& shard : shards_) {
+        for (auto& book : shard->books) {
+            shard->books_by_id.emplace(book.instrument_id, &book);
+        }
+    }
+}
+
+FeedHandler::~FeedHandler() {
+    Stop();
+}
+
+void FeedHandler::Start() {
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    for (auto& shard : shards_) {
+        shard->context = std::make_unique<ClientContext>();
+        Shard* s = shard.get();
+        shard->thread = std::thread([this, s]() { RunShard(*s); });
+    }
+}
+
+void FeedHandler::Stop() {
+    if (!running_) {
+        return;
+    }
+    for (auto& shard : shards_) {
+        shard->context->TryCancel();
+    }
+    for (auto& shard : shards_) {
+        shard->thread.join();
+    }
+    running_ = false;
+}
+
+int FeedHandler::InstrumentIndex(const std::string& instrument_id) const {
+    auto it = indices_.find(instrument_id);
+    return it == indices_.end() ? -1 : static_cast<int>(it->second);
+}
+
+size_t FeedHandler::Poll(size_t consumer, BookEvent* events, size_t max_events) {
+    size_t count = 0;
+    for (auto& shard : shards_) {
+        SpscRing<BookEvent>& ring = *shard->rings[consumer];
+        while (count < max_events && ring.TryPop(&events[count])) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+uint64_t FeedHandler::messages() const {
+    uint64_t total = 0;
+    for (const auto& shard : shards_) {
+        total += shard->messages.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t FeedHandler::dropped_events() const {
+    uint64_t total = 0;
+    for (const auto& shard : shards_) {
+        total += shard->dropped_events.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void FeedHandler::RunShard(Shard& shard) {
+    if (options_.first_cpu >= 0) {
+        PinToCpu(options_.first_cpu + static_cast<int>(shard.index));
+    }
+
+    // A local subchannel pool gives each shard its own connection
+    ChannelArguments args;
+    args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    ApplyTransportProfile(options_.profile, &args);
+    std::unique_ptr<MarketDataService::Stub> stub = MarketDataService::NewStub(
+        grpc::CreateCustomChannel(options_.server_address, grpc::InsecureChannelCredentials(), args));
+    shard.stream = stub->Subscribe(shard.context.get());
+    // The shard's instruments all go in one request
+    std::vector<std::string> instrument_ids;
+    for (const auto& book : shard.books) {
+        instrument_ids.push_back(book.instrument_id);
+    }
+    shard.WriteRequest(SubscriptionRequest::SUBSCRIBE, instrument_ids);
+
+    std::unique_ptr<char[]> read_block(new char[kReadArenaSize]);
+    ArenaOptions arena_options;
+    arena_options.initial_block = read_block.get();
+    arena_options.initial_block_size = kReadArenaSize;
+    Arena arena(arena_options);
+    while (true) {
+        arena.Reset();
+        MarketDataUpdate* update = Arena::CreateMessage<MarketDataUpdate>(&arena);
+        if (!shard.stream->Read(update)) {
+            break;
+        }
+        shard.receive_ns = SteadyNowNs();
+        shard.messages.store(shard.messages.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        shard.Process(*this, *update);
+    }
+
+    Status status = shard.stream->Finish();
+    if (!status.ok() && status.error_code() != grpc::StatusCode::CANCELLED) {
+        Log(LogLevel::kError) << "Feed handler shard " << shard.index << " stream failed: " << status.error_message();
+    }
+}
+
+void FeedHandler::Shard::Process(FeedHandler& handler, const MarketDataUpdate& update) {
+    if (update.has_batch()) {
+        for (const auto& batched_update : update.batch().updates()) {
+            Process(handler, batched_update);
+        }
+
+    } else if (update.has_symbol_directory()) {
+        for (const auto& entry : update.symbol_directory().entries()) {
+            auto it = books_by_id.find(entry.instrument_id());
+            if (it == books_by_id.end()) {
+                continue;
+            }
+            if (entry.instrument_handle() >= books_by_handle.size()) {
+                books_by_handle.resize(entry.instrument_handle() + 1, nullptr);
+            }
+            books_by_handle[entry.instrument_handle()] = it->second;
+        }
+
+    } else if (update.has_snapshot()) {
+        auto it = books_by_id.find(update.snapshot().instrument_id());
+        if (it == books_by_id.end()) {
+            return;
+        }
+        Book& book = *it->second;
+        book.Visit([&](auto& levels) { levels.ApplySnapshot(update.snapshot()); });
+        book.sequence = update.snapshot().sequence();
+        book.recovering = false;
+        Publish(handler, book, true);
+
+    } else if (update.has_incremental_update()) {
+        const OrderBookIncrementalUpdate& incremental_update = update.incremental_update();
+        Book* book = nullptr;
+        if (incremental_update.instrument_handle() != 0) {
+            uint32_t handle = incremental_update.instrument_handle();
+            book = handle < books_by_handle.size() ? books_by_handle[handle] : nullptr;
+        } else {
+            auto it = books_by_id.find(incremental_update.instrument_id());
+            book = it == books_by_id.end() ? nullptr : it->second;
+        }
+        if (book == nullptr || !CheckSequence(*book, incremental_update)) {
+            return;
+        }
+        book->Visit([&](auto& levels) { levels.ApplyIncremental(incremental_update); });
+        Publish(handler, *book, false);
+    }
+}
+
+bool FeedHandler::Shard::CheckSequence(Book& book, const OrderBookIncrementalUpdate& update) {
+    if (update.sequence() == 0) {
+        // Unsequenced feed
+        return true;
+    }
+    if (book.recovering || update.sequence() <= book.sequence) {
+        return false;
+    }
+    uint64_t first_sequence = update.first_sequence() != 0 ? update.first_sequence() : update.sequence();
+    if (first_sequence > book.sequence + 1) {
+        Log(LogLevel::kError) << "Feed handler detected sequence gap for " << book.instrument_id << ": expected "
+                              << book.sequence + 1 << ", received " << first_sequence << ". Requesting snapshot.";
+        book.recovering = true;
+        WriteRequest(SubscriptionRequest::SNAPSHOT, {book.instrument_id});
+        return false;
+    }
+    book.sequence = update.sequence();
+    return true;
+}
+
+void FeedHandler::Shard::Publish(FeedHandler& handler, Book& book, bool snapshot) {
+    BookTop top;
+    top.sequence = book.sequence;
+    top.receive_ns = receive_ns;
+    size_t depth = handler.options_.depth;
+    book.Visit([&](const auto& levels) {
+        top.tick_size = levels.tick_size();
+        top.bid_depth = CopySide(levels.bids(), depth, top.bids);
+        top.ask_depth = CopySide(levels.asks(), depth, top.asks);
+    });
+
+    // Updates below the published depth change nothing consumers can see
+    uint32_t flags = 0;
+    if (snapshot) {
+        flags |= BookEvent::kSnapshot;
+    }
+    if (!SameLevel(top.bids[0], book.published.bids[0]) || !SameLevel(top.asks[0], book.published.asks[0])) {
+        flags |= BookEvent::kBestChanged;
+    }
+    for (size_t i = 1; i < depth && !(flags & BookEvent::kDepthChanged); ++i) {
+        if (!SameLevel(top.bids[i], book.published.bids[i]) || !SameLevel(top.asks[i], book.published.asks[i])) {
+            flags |= BookEvent::kDepthChanged;
+        }
+    }
+    if (flags == 0) {
+        return;
+    }
+    handler.tops_[book.instrument]->Store(top);
+    book.published = top;
+
+    BookEvent event;
+    event.instrument = static_cast<uint32_t>(book.instrument);
+    event.flags = flags;
+    event.sequence = top.sequence;
+    event.best_bid = top.bids[0];
+    event.best_ask = top.asks[0];
+    for (auto& ring : rings) {
+        if (!ring->TryPush(event)) {
+            dropped_events.store(dropped_events.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool FeedHandler::Shard::WriteRequest(SubscriptionRequest::Action action, const std::vector<std::string>& instrument_ids) {
+    SubscriptionRequest request;
+    request.set_action(action);
+    for (const auto& instrument_id : instrument_ids) {
+        request.add_instrument_ids(instrument_id);
+    }
+    if (action == SubscriptionRequest::SUBSCRIBE) {
+        request.set_depth(static_cast<uint32_t>(subscription_depth));
+    }
+    if (!stream->Write(request)) {
+        Log(LogLevel::kError) << "Feed handler shard " << index << " failed to write "
+                              << SubscriptionRequest::Action_Name(action) << " request for " << instrument_ids.size()
+                              << " instruments. Stream likely broken.";
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,126 @@
+#ifndef FEED_HANDLER_H
+#define FEED_HANDLER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "order_book.h"
+#include "seqlock.h"
+#include "transport_profile.h"
+
+// Most levels per side a FeedHandler publishes for each book
+constexpr size_t kMaxPublishedDepth = 10;
+
+// The top of one book as published by a FeedHandler. Unused levels are zero.
+struct BookTop {
+    // Sequence number of the last update that changed the published levels, and the
+    // steady-clock time its message was received, in nanoseconds
+    uint64_t sequence = 0;
+    int64_t receive_ns = 0;
+    // Price of one tick, to turn price_ticks into prices
+    double tick_size = 0;
+    uint32_t bid_depth = 0;
+    uint32_t ask_depth = 0;
+    BookLevel bids[kMaxPublishedDepth] = {};
+    BookLevel asks[kMaxPublishedDepth] = {};
+};
+
+// A change to a published book, queued for each consumer.
+struct BookEvent {
+    enum Flags : uint32_t {
+        kBestChanged = 1,   // The best bid or offer moved or changed size
+        kDepthChanged = 2,  // A published level below the best changed
+        kSnapshot = 4,      // The book was replaced by a snapshot
+    };
+    // Index of the instrument in FeedHandlerOptions::instruments
+    uint32_t instrument = 0;
+    uint32_t flags = 0;
+    uint64_t sequence = 0;
+    // Zero quantity if the side is empty
+    BookLevel best_bid = {};
+    BookLevel best_ask = {};
+};
+
+struct FeedHandlerOptions {
+    std::string server_address = "localhost:50051";
+    std::vector<std::string> instruments;
+    // Streams, each on its own connection and decode/apply thread; instrument i goes to shard i % shards
+    size_t shards = 1;
+    // Levels per side published in each BookTop, at most kMaxPublishedDepth
+    size_t depth = 5;
+    // Levels per side subscribed to; 0 subscribes to the full book
+    size_t subscription_depth = 0;
+    // Pins shard i's thread to CPU first_cpu + i; negative leaves them unpinned
+    int first_cpu = -1;
+    // Threads that will call Poll, each with its own ring per shard
+    size_t consumers = 1;
+    // Events a consumer may fall behind by before further ones are dropped
+    size_t ring_capacity = 4096;
+    // gRPC settings of the shards' connections
+    TransportProfile profile = TransportProfile::kDefault;
+};
+
+// Multi-threaded client feed handler. Instruments are sharded over several Subscribe
+// streams, each read by its own thread that decodes updates and applies them to the
+// shard's books, so no book is touched by more than one thread. After each update a
+// shard publishes the top of the book in two ways:
+//
+//  * Top(instrument) reads the latest BookTop through a seqlock: any thread may call
+//    it at any time without a lock, and it never holds up the shard.
+//  * Poll(consumer, ...) drains BookEvents describing what changed, from one
+//    single-producer single-consumer ring per shard and consumer. A consumer that
+//    falls behind loses events (counted in dropped_events) rather than stalling the
+//    feed; the book itself is always current through Top.
+//
+// Sequence gaps are recovered per instrument with a snapshot request, as in the
+// single-stream client.
+class FeedHandler {
+public:
+    explicit FeedHandler(FeedHandlerOptions options);
+    ~FeedHandler();
+
+    FeedHandler(const FeedHandler&) = delete;
+    FeedHandler& operator=(const FeedHandler&) = delete;
+
+    // Connects every shard and subscribes to its instruments.
+    void Start();
+    // Cancels the streams and joins the shard threads.
+    void Stop();
+
+    const std::vector<std::string>& instruments() const { return options_.instruments; }
+    // Index of an instrument in instruments(), or -1 if it is not handled.
+    int InstrumentIndex(const std::string& instrument_id) const;
+
+    // Lock-free; may be called from any thread.
+    BookTop Top(size_t instrument) const { return tops_[instrument]->Load(); }
+
+    // Moves up to max_events pending events for consumer into events, taking from each
+    // shard in turn, and returns how many there were. Each consumer must only be
+    // polled from one thread.
+    size_t Poll(size_t consumer, BookEvent* events, size_t max_events);
+
+    // Messages read and events dropped over all shards
+    uint64_t messages() const;
+    uint64_t dropped_events() const;
+
+private:
+    struct Shard;
+
+    // Seqlocks are kept on their own cache lines so shards never share one
+    struct alignas(64) PublishedTop : Seqlock<BookTop> {};
+
+    void RunShard(Shard& shard);
+
+    FeedHandlerOptions options_;
+    std::unordered_map<std::string, size_t> indices_;
+    std::vector<std::unique_ptr<PublishedTop>> tops_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    bool running_ = false;
+};
+
+#endif // FEED_HANDLER_H
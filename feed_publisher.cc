@@ -0,0 +1,21 @@
+#include "feed_publisher.h"
+
+#include <grpcpp/support/slice.h>
+
+#include "log.h"
+
+bool FeedPublisher::Publish(std::shared_ptr<const EncodedUpdate> update) {
+    // An update encoded in one piece is a single slice already, so this only takes a reference
+    grpc::Slice bytes;
+    if (!update->bytes().DumpToSingleSlice(&bytes).ok()) {
+        return false;
+    }
+    bool all_sent = true;
+    for (const auto& sender : senders_) {
+        if (!sender->Send(bytes.begin(), bytes.size())) {
+            Log(LogLevel::kError) << "Failed to send a " << bytes.size() << " byte update on the feed.";
+            all_sent = false;
+        }
+    }
+    return all_sent;
+}
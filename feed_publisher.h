@@ -0,0 +1,25 @@
+#ifndef FEED_PUBLISHER_H
+#define FEED_PUBLISHER_H
+
+#include <memory>
+#include <vector>
+
+#include "feed_transport.h"
+#include "publisher_engine.h"
+
+// Engine subscriber that sends every update it is given, as its encoded bytes, over
+// one or more feed transports (see feed_transport.h). Subscribed to an instrument
+// without a snapshot, it puts that instrument's full-depth incremental updates on the
+// feed; receivers take snapshots and recovery from gRPC. Publish is called from every
+// worker that owns a subscribed instrument, and shares no state between them.
+class FeedPublisher final : public Subscriber {
+public:
+    explicit FeedPublisher(std::vector<std::unique_ptr<FeedSender>> senders) : senders_(std::move(senders)) {}
+
+    bool Publish(std::shared_ptr<const EncodedUpdate> update) override;
+
+private:
+    std::vector<std::unique_ptr<FeedSender>> senders_;
+};
+
+#endif // FEED_PUBLISHER_H
@@ -0,0 +1,328 @@
+#include "feed_transport.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Receive buffer asked for, so bursts are not dropped by the kernel while the receiver
+// is busy applying
+constexpr int kUdpReceiveBuffer = 8 * 1024 * 1024;
+
+// Parses "HOST:PORT" into an IPv4 socket address.
+bool ParseAddress(const std::string& address, sockaddr_in* out, std::string* error) {
+    size_t colon = address.rfind(':');
+    std::memset(out, 0, sizeof(*out));
+    out->sin_family = AF_INET;
+    int port = colon == std::string::npos ? 0 : std::atoi(address.c_str() + colon + 1);
+    if (colon == std::string::npos || port <= 0 || port > 65535 ||
+        inet_pton(AF_INET, address.substr(0, colon).c_str(), &out->sin_addr) != 1) {
+        *error = "expected IPV4_ADDRESS:PORT, got " + address;
+        return false;
+    }
+    out->sin_port = htons(static_cast<uint16_t>(port));
+    return true;
+}
+
+bool IsMulticast(const sockaddr_in& address) {
+    return IN_MULTICAST(ntohl(address.sin_addr.s_addr));
+}
+
+std::string SystemError(const std::string& what) {
+    return what + ": " + std::strerror(errno);
+}
+
+class UdpSender final : public FeedSender {
+public:
+    explicit UdpSender(int fd) : fd_(fd) {}
+    ~UdpSender() override { close(fd_); }
+
+    bool Send(const void* data, size_t size) override {
+        // The socket is connected, and sends on a datagram socket are atomic
+        return size <= kMaxDatagramSize && send(fd_, data, size, 0) == static_cast<ssize_t>(size);
+    }
+
+private:
+    int fd_;
+};
+
+class UdpReceiver final : public FeedReceiver {
+public:
+    explicit UdpReceiver(int fd) : fd_(fd), buffer_(kMaxDatagramSize) {}
+    ~UdpReceiver() override { close(fd_); }
+
+    bool Receive(std::string* data, std::chrono::microseconds timeout) override {
+        pollfd ready{fd_, POLLIN, 0};
+        timespec wait{static_cast<time_t>(timeout.count() / 1000000), static_cast<long>(timeout.count() % 1000000) * 1000};
+        if (ppoll(&ready, 1, &wait, nullptr) <= 0) {
+            return false;
+        }
+        ssize_t size = recv(fd_, buffer_.data(), buffer_.size(), 0);
+        if (size < 0) {
+            return false;
+        }
+        data->assign(buffer_.data(), static_cast<size_t>(size));
+        return true;
+    }
+
+private:
+    int fd_;
+    std::vector<char> buffer_;
+};
+
+struct ShmRingHeader {
+    char magic[sizeof(kShmRingMagic)];
+    uint64_t slot_count;
+    uint64_t slot_words;
+    // Positions claimed by writers so far
+    alignas(64) std::atomic<uint64_t> head;
+};
+
+struct ShmSlot {
+    std::atomic<uint64_t> sequence;
+    std::atomic<uint64_t> size;
+    std::atomic<uint64_t> words[kShmSlotWords];
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "ring words are shared between processes");
+
+constexpr size_t kShmRingSize = sizeof(ShmRingHeader) + kShmSlotCount * sizeof(ShmSlot);
+
+std::string ShmPath(const std::string& name) {
+    return "/" + name;
+}
+
+// A mapping of a ring, unmapped when the sender or receiver goes away.
+class ShmRing {
+public:
+    explicit ShmRing(void* memory) : memory_(memory) {}
+    ~ShmRing() { munmap(memory_, kShmRingSize); }
+
+    ShmRingHeader& header() const { return *static_cast<ShmRingHeader*>(memory_); }
+
+    ShmSlot& slot(uint64_t position) const {
+        auto* slots = reinterpret_cast<ShmSlot*>(static_cast<char*>(memory_) + sizeof(ShmRingHeader));
+        return slots[position % kShmSlotCount];
+    }
+
+private:
+    void* memory_;
+};
+
+class ShmSender final : public FeedSender {
+public:
+    explicit ShmSender(void* memory) : ring_(memory) {}
+
+    bool Send(const void* data, size_t size) override {
+        if (size > kShmSlotWords * sizeof(uint64_t)) {
+            return false;
+        }
+        uint64_t position = ring_.header().head.fetch_add(1, std::memory_order_relaxed);
+        ShmSlot& slot = ring_.slot(position);
+        slot.sequence.store(2 * position + 1, std::memory_order_relaxed);
+        // Orders the odd sequence number before any of the new words
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.size.store(size, std::memory_order_relaxed);
+        const char* bytes = static_cast<const char*>(data);
+        for (size_t i = 0; i * sizeof(uint64_t) < size; ++i) {
+            uint64_t word = 0;
+            std::memcpy(&word, bytes + i * sizeof(uint64_t), std::min(sizeof(uint64_t), size - i * sizeof(uint64_t)));
+            slot.words[i].store(word, std::memory_order_relaxed);
+        }
+        slot.sequence.store(2 * position + 2, std::memory_order_release);
+        return true;
+    }
+
+private:
+    ShmRing ring_;
+};
+
+class ShmReceiver final : public FeedReceiver {
+public:
+    explicit ShmReceiver(void* memory) : ring_(memory), next_(ring_.header().head.load(std::memory_order_acquire)) {}
+
+    bool Receive(std::string* data, std::chrono::microseconds timeout) override {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (true) {
+            ShmSlot& slot = ring_.slot(next_);
+            uint64_t complete = 2 * next_ + 2;
+            uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence == complete) {
+                size_t size = std::min<size_t>(slot.size.load(std::memory_order_relaxed), sizeof(slot.words));
+                size_t words = (size + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+                for (size_t i = 0; i < words; ++i) {
+                    words_[i] = slot.words[i].load(std::memory_order_relaxed);
+                }
+                // Orders the words read before the second look at the sequence number
+                std::atomic_thread_fence(std::memory_order_acquire);
+                sequence = slot.sequence.load(std::memory_order_relaxed);
+                if (sequence == complete) {
+                    data->assign(reinterpret_cast<const char*>(words_), size);
+                    ++next_;
+                    return true;
+                }
+            }
+            if (sequence > complete) {
+                // Lapped: skip to half a ring behind the writers, which leaves room to catch up
+                uint64_t head = ring_.header().head.load(std::memory_order_acquire);
+                uint64_t resume = head - std::min<uint64_t>(head, kShmSlotCount / 2);
+                lost_ += resume - next_;
+                next_ = resume;
+                continue;
+            }
+            // Not written yet, or a writer is in the middle of it
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    uint64_t lost() const override { return lost_; }
+
+private:
+    ShmRing ring_;
+    uint64_t next_;
+    uint64_t lost_ = 0;
+    uint64_t words_[kShmSlotWords];
+};
+
+// Maps the ring's file, which must already have its full size. Receivers only read it.
+void* MapRing(int fd, bool writable, std::string* error) {
+    void* memory = mmap(nullptr, kShmRingSize, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps the memory alive on its own
+    close(fd);
+    if (memory == MAP_FAILED) {
+        *error = SystemError("cannot map ring");
+        return nullptr;
+    }
+    return memory;
+}
+
+} // namespace
+
+std::unique_ptr<FeedSender> OpenUdpSender(const std::string& address, std::string* error) {
+    sockaddr_in destination;
+    if (!ParseAddress(address, &destination, error)) {
+        return nullptr;
+    }
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        *error = SystemError("cannot create socket");
+        return nullptr;
+    }
+    if (IsMulticast(destination)) {
+        unsigned char ttl = 1;
+        unsigned char loop = 1;
+        setsockopt(fd, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+        setsockopt(fd, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop));
+    }
+    if (connect(fd, reinterpret_cast<const sockaddr*>(&destination), sizeof(destination)) != 0) {
+        *error = SystemError("cannot send to " + address);
+        close(fd);
+        return nullptr;
+    }
+    return std::make_unique<UdpSender>(fd);
+}
+
+std::unique_ptr<FeedReceiver> OpenUdpReceiver(const std::string& address, std::string* error) {
+    sockaddr_in group;
+    if (!ParseAddress(address, &group, error)) {
+        return nullptr;
+    }
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        *error = SystemError("cannot create socket");
+        return nullptr;
+    }
+    // Several receivers on one host share a multicast port
+    int reuse = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    int buffer = kUdpReceiveBuffer;
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &buffer, sizeof(buffer));
+    sockaddr_in local = group;
+    if (IsMulticast(group)) {
+        local.sin_addr.s_addr = htonl(INADDR_ANY);
+    }
+    if (bind(fd, reinterpret_cast<const sockaddr*>(&local), sizeof(local)) != 0) {
+        *error = SystemError("cannot bind " + address);
+        close(fd);
+        return nullptr;
+    }
+    if (IsMulticast(group)) {
+        ip_mreq membership{};
+        membership.imr_multiaddr = group.sin_addr;
+        membership.imr_interface.s_addr = htonl(INADDR_ANY);
+        if (setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) != 0) {
+            *error = SystemError("cannot join " + address);
+            close(fd);
+            return nullptr;
+        }
+    }
+    return std::make_unique<UdpReceiver>(fd);
+}
+
+std::unique_ptr<FeedSender> OpenShmSender(const std::string& name, std::string* error) {
+    // A fresh ring, so receivers of an earlier run cannot mistake old entries for new ones
+    shm_unlink(ShmPath(name).c_str());
+    int fd = shm_open(ShmPath(name).c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0) {
+        *error = SystemError("cannot create ring " + name);
+        return nullptr;
+    }
+    if (ftruncate(fd, static_cast<off_t>(kShmRingSize)) != 0) {
+        *error = SystemError("cannot size ring " + name);
+        close(fd);
+        return nullptr;
+    }
+    void* memory = MapRing(fd, true, error);
+    if (memory == nullptr) {
+        return nullptr;
+    }
+    // The new file is zero-filled, which is an empty ring; the magic goes in last
+    auto& header = *static_cast<ShmRingHeader*>(memory);
+    header.slot_count = kShmSlotCount;
+    header.slot_words = kShmSlotWords;
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(header.magic, kShmRingMagic, sizeof(kShmRingMagic));
+    return std::make_unique<ShmSender>(memory);
+}
+
+std::unique_ptr<FeedReceiver> OpenShmReceiver(const std::string& name, std::string* error) {
+    int fd = shm_open(ShmPath(name).c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        *error = SystemError("cannot open ring " + name);
+        return nullptr;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) != kShmRingSize) {
+        *error = name + " is not a ring of this build's size";
+        close(fd);
+        return nullptr;
+    }
+    void* memory = MapRing(fd, false, error);
+    if (memory == nullptr) {
+        return nullptr;
+    }
+    const auto& header = *static_cast<const ShmRingHeader*>(memory);
+    if (std::memcmp(header.magic, kShmRingMagic, sizeof(kShmRingMagic)) != 0 || header.slot_count != kShmSlotCount ||
+        header.slot_words != kShmSlotWords) {
+        *error = name + " is not a ring of this build's layout";
+        munmap(memory, kShmRingSize);
+        return nullptr;
+    }
+    return std::make_unique<ShmReceiver>(memory);
+}
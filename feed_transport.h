@@ -0,0 +1,66 @@
+#ifndef FEED_TRANSPORT_H
+#define FEED_TRANSPORT_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// One-way transports that carry the server's incremental updates to any number of
+// receivers at a fixed cost per update, however many there are: UDP, multicast
+// across a LAN or unicast, and a shared-memory ring for receivers on the same host.
+// Every datagram or ring entry is one serialized MarketDataUpdate, exactly as written
+// to gRPC streams. Nothing is retransmitted: receivers find lost updates through the
+// per-instrument sequence numbers and recover with a snapshot over gRPC.
+
+// Largest update a UDP datagram carries
+constexpr size_t kMaxDatagramSize = 65507;
+
+// Layout of a shared-memory ring: a ShmRingHeader followed by slot_count slots. Each
+// slot is a sequence word, a size word and kShmSlotWords payload words, all 64-bit
+// atomics so readers can copy a slot while a writer is storing it. Writers claim
+// positions by incrementing head; the slot of position p is p % slot_count. A writer
+// sets the slot's sequence to 2p + 1 while it stores the entry and to 2p + 2 once it
+// is complete. A reader waiting for position p copies the slot once its sequence is
+// 2p + 2 and keeps the copy if the sequence is unchanged afterwards; a higher
+// sequence means the ring has lapped the reader.
+constexpr char kShmRingMagic[8] = {'M', 'D', 'S', 'H', 'M', '0', '0', '1'};
+constexpr size_t kShmSlotWords = 510;
+constexpr size_t kShmSlotCount = 8192;
+
+class FeedSender {
+public:
+    virtual ~FeedSender() = default;
+
+    // Sends one update. May be called from several threads at once. Returns false if
+    // it could not be sent, e.g. because it is larger than the transport carries.
+    virtual bool Send(const void* data, size_t size) = 0;
+};
+
+class FeedReceiver {
+public:
+    virtual ~FeedReceiver() = default;
+
+    // Waits up to timeout for the next update and copies it into *data. Returns false
+    // if none arrived. Must only be called from one thread.
+    virtual bool Receive(std::string* data, std::chrono::microseconds timeout) = 0;
+
+    // Updates the receiver knows it missed. The ring counts the entries it was lapped
+    // by; UDP losses only show up as sequence gaps.
+    virtual uint64_t lost() const { return 0; }
+};
+
+// address is "HOST:PORT" with an IPv4 host. A multicast group is sent to with a TTL
+// of 1 and loopback enabled, so receivers on the same host see it too; receivers join
+// it. Each returns nullptr and sets *error on failure.
+std::unique_ptr<FeedSender> OpenUdpSender(const std::string& address, std::string* error);
+std::unique_ptr<FeedReceiver> OpenUdpReceiver(const std::string& address, std::string* error);
+
+// The ring named name lives in /dev/shm. The sender creates it afresh, replacing any
+// ring left by an earlier run; a receiver attaches to an existing ring and starts at
+// its current head.
+std::unique_ptr<FeedSender> OpenShmSender(const std::string& name, std::string* error);
+std::unique_ptr<FeedReceiver> OpenShmReceiver(const std::string& name, std::string* error);
+
+#endif // FEED_TRANSPORT_H
@@ -0,0 +1,33 @@
+#ifndef FLAGS_H
+#define FLAGS_H
+
+#include <charconv>
+#include <string>
+#include <system_error>
+
+// Command-line flag helpers shared by the server, client and load generator.
+
+// If arg is "<name>=<value>", stores the value and returns true.
+inline bool FlagValue(const std::string& arg, const std::string& name, std::string* value) {
+    if (arg.size() <= name.size() || arg.compare(0, name.size(), name) != 0 || arg[name.size()] != '=') {
+        return false;
+    }
+    *value = arg.substr(name.size() + 1);
+    return true;
+}
+
+// If all of value is a number that fits in T, stores it and returns true, so that a
+// malformed flag is reported with the usage instead of throwing.
+template <typename T>
+bool ParseNumber(const std::string& value, T* number) {
+    T parsed;
+    const char* end = value.data() + value.size();
+    std::from_chars_result result = std::from_chars(value.data(), end, parsed);
+    if (value.empty() || result.ec != std::errc() || result.ptr != end) {
+        return false;
+    }
+    *number = parsed;
+    return true;
+}
+
+#endif // FLAGS_H
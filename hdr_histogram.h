@@ -0,0 +1,110 @@
+#ifndef HDR_HISTOGRAM_H
+#define HDR_HISTOGRAM_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// High dynamic range histogram of non-negative integer values, after Gil Tene's
+// HdrHistogram. Values are counted in buckets covering successive powers of two,
+// each split into linear sub-buckets, so every recorded value is kept to the given
+// number of significant decimal digits across the whole trackable range. Recording
+// is an index computation and an increment, with no allocation; the memory used
+// depends only on the range and precision.
+class HdrHistogram {
+public:
+    // Values above highest_trackable_value are counted as highest_trackable_value.
+    // significant_digits is between 1 and 5.
+    HdrHistogram(int64_t highest_trackable_value, int significant_digits)
+        : highest_trackable_value_(highest_trackable_value) {
+        int64_t largest_single_unit_value = 2 * static_cast<int64_t>(std::pow(10, significant_digits));
+        sub_bucket_count_magnitude_ = static_cast<int>(std::ceil(std::log2(static_cast<double>(largest_single_unit_value))));
+        sub_bucket_half_count_magnitude_ = sub_bucket_count_magnitude_ - 1;
+        sub_bucket_count_ = int64_t{1} << sub_bucket_count_magnitude_;
+        sub_bucket_half_count_ = sub_bucket_count_ / 2;
+        sub_bucket_mask_ = sub_bucket_count_ - 1;
+
+        int bucket_count = 1;
+        for (int64_t smallest_untrackable = sub_bucket_count_; smallest_untrackable <= highest_trackable_value;
+             smallest_untrackable <<= 1) {
+            ++bucket_count;
+        }
+        counts_.assign(static_cast<size_t>(bucket_count + 1) * sub_bucket_half_count_, 0);
+    }
+
+    void Record(int64_t value) {
+        value = std::clamp<int64_t>(value, 0, highest_trackable_value_);
+        ++counts_[Index(value)];
+        ++total_count_;
+        max_ = std::max(max_, value);
+    }
+
+    // Smallest value that percentile percent of the recorded values are at or below,
+    // to the histogram's precision. 0 if nothing was recorded.
+    int64_t ValueAtPercentile(double percentile) const {
+        if (total_count_ == 0) {
+            return 0;
+        }
+        uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100 * total_count_)));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= target) {
+                return std::min(HighestEquivalentValue(i), max_);
+            }
+        }
+        return max_;
+    }
+
+    // Adds the counts of another histogram with the same range and precision.
+    void Add(const HdrHistogram& other) {
+        for (size_t i = 0; i < counts_.size() && i < other.counts_.size(); ++i) {
+            counts_[i] += other.counts_[i];
+        }
+        total_count_ += other.total_count_;
+        max_ = std::max(max_, other.max_);
+    }
+
+    void Reset() {
+        std::fill(counts_.begin(), counts_.end(), 0);
+        total_count_ = 0;
+        max_ = 0;
+    }
+
+    uint64_t count() const { return total_count_; }
+    int64_t max() const { return max_; }
+
+private:
+    size_t Index(int64_t value) const {
+        // The bucket is given by the highest set bit above the sub-bucket range
+        int pow2_ceiling = 64 - __builtin_clzll(static_cast<uint64_t>(value | sub_bucket_mask_));
+        int bucket_index = pow2_ceiling - sub_bucket_count_magnitude_;
+        int64_t sub_bucket_index = value >> bucket_index;
+        return (static_cast<size_t>(bucket_index + 1) << sub_bucket_half_count_magnitude_) +
+               static_cast<size_t>(sub_bucket_index - sub_bucket_half_count_);
+    }
+
+    // Largest value counted at index.
+    int64_t HighestEquivalentValue(size_t index) const {
+        int bucket_index = static_cast<int>(index >> sub_bucket_half_count_magnitude_) - 1;
+        int64_t sub_bucket_index = static_cast<int64_t>(index & (sub_bucket_half_count_ - 1)) + sub_bucket_half_count_;
+        if (bucket_index < 0) {
+            sub_bucket_index -= sub_bucket_half_count_;
+            bucket_index = 0;
+        }
+        return ((sub_bucket_index + 1) << bucket_index) - 1;
+    }
+
+    int64_t highest_trackable_value_;
+    int sub_bucket_count_magnitude_;
+    int sub_bucket_half_count_magnitude_;
+    int64_t sub_bucket_count_;
+    int64_t sub_bucket_half_count_;
+    int64_t sub_bucket_mask_;
+    std::vector<uint64_t> counts_;
+    uint64_t total_count_ = 0;
+    int64_t max_ = 0;
+};
+
+#endif // HDR_HISTOGRAM_H
@@ -0,0 +1,549 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "market_data.grpc.pb.h"
+#include "market_data.pb.h"
+
+#include "flags.h"
+#include "hdr_histogram.h"
+#include "transport_profile.h"
+
+using grpc::Channel;
+using grpc::ChannelArguments;
+using grpc::ClientAsyncReaderWriterInterface;
+using grpc::ClientContext;
+using grpc::CompletionQueue;
+using grpc::Status;
+
+using marketdata::MarketDataService;
+using marketdata::MarketDataUpdate;
+using marketdata::SubscriptionRequest;
+
+namespace {
+
+// Latencies are tracked up to this many nanoseconds, to three significant digits
+constexpr int64_t kMaxTrackedLatencyNs = 60'000'000'000;
+constexpr int kLatencyDigits = 3;
+
+// How often the driver thread wakes to apply churn and check for reports
+constexpr std::chrono::milliseconds kDriverTick(10);
+
+// Attempts at drawing an instrument a stream is not already subscribed to
+constexpr int kMaxDraws = 16;
+
+int64_t SteadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Command line configuration of the load generator
+struct LoadOptions {
+    std::string server_address = "localhost:50051";
+    size_t streams = 100;
+    size_t channels = 4;
+    size_t cq_threads = 2;
+    // Instruments to draw subscriptions from, SYM0 .. SYM<instruments-1>
+    size_t instruments = 100;
+    size_t subscriptions_per_stream = 4;
+    // Draw instruments uniformly, or weighted by 1/rank so a few are much hotter
+    bool hot_mix = false;
+    // Share of streams that subscribe with conflation, optionally rate limited
+    double conflate_fraction = 0;
+    uint32_t conflate_max_rate = 0;
+    // Levels per side each subscription asks for, 0 for full depth
+    uint32_t depth = 0;
+    // Subscription changes per second over all streams; each unsubscribes one
+    // instrument of a random stream and subscribes it to another
+    double churn_per_second = 0;
+    std::chrono::seconds duration{30};
+    std::chrono::milliseconds report_interval{1000};
+    uint64_t seed = 1;
+    // gRPC settings of the connections, to match the server's
+    TransportProfile profile = TransportProfile::kDefault;
+};
+
+// What one completion queue thread observed. Only its own thread records into it;
+// the reporting thread takes the lock to read and reset it.
+struct ThreadStats {
+    std::mutex mutex;
+    uint64_t messages = 0;
+    uint64_t updates = 0;
+    uint64_t snapshots = 0;
+    // Publish to receive, for updates stamped by a server running with --timestamps
+    HdrHistogram latency{kMaxTrackedLatencyNs, kLatencyDigits};
+};
+
+class LoadStream;
+
+// Completion queue tag identifying which operation of which stream completed
+struct StreamTag {
+    enum Event { kStarted, kRead, kWrite, kFinish };
+    LoadStream* stream;
+    Event event;
+};
+
+// One simulated subscriber: a Subscribe stream driven from a completion queue. Reads
+// are always outstanding once the call has started. Requests may be sent from any
+// thread; they are queued and written one at a time. The call is finished once reads
+// have ended and no write is outstanding.
+class LoadStream {
+public:
+    LoadStream(MarketDataService::Stub* stub, CompletionQueue* cq, ThreadStats* stats, bool conflate,
+               uint32_t max_updates_per_second, uint32_t depth)
+        : stub_(stub), cq_(cq), stats_(stats), conflate_(conflate), max_updates_per_second_(max_updates_per_second),
+          depth_(depth) {}
+
+    void Start() {
+        stream_ = stub_->PrepareAsyncSubscribe(&context_, cq_);
+        stream_->StartCall(&started_tag_);
+    }
+
+    // Queues a request; it is written once the call has started and earlier ones are out.
+    void Send(SubscriptionRequest::Action action, const std::string& instrument_id) {
+        SubscriptionRequest request;
+        request.set_instrument_id(instrument_id);
+        Send(action, std::move(request));
+    }
+
+    // All the instruments in one request.
+    void Send(SubscriptionRequest::Action action, const std::vector<std::string>& instrument_ids) {
+        SubscriptionRequest request;
+        for (const auto& instrument_id : instrument_ids) {
+            request.add_instrument_ids(instrument_id);
+        }
+        Send(action, std::move(request));
+    }
+
+    void Send(SubscriptionRequest::Action action, SubscriptionRequest request) {
+        request.set_action(action);
+        if (action == SubscriptionRequest::SUBSCRIBE) {
+            request.set_conflate(conflate_);
+            request.set_max_updates_per_second(max_updates_per_second_);
+            request.set_depth(depth_);
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (read_done_) {
+            return;
+        }
+        pending_.push_back(std::move(request));
+        if (started_ && !writing_) {
+            WriteNext();
+        }
+    }
+
+    void Cancel() { context_.TryCancel(); }
+
+    bool finished() const { return finished_.load(); }
+    bool failed() const { return failed_.load(); }
+
+    void OnEvent(StreamTag::Event event, bool ok) {
+        switch (event) {
+        case StreamTag::kStarted: {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!ok) {
+                read_done_ = true;
+                FinishCall();
+                return;
+            }
+            started_ = true;
+            WriteNext();
+            stream_->Read(&update_, &read_tag_);
+            break;
+        }
+
+        case StreamTag::kRead:
+            if (ok) {
+                Count(SteadyNowNs());
+                stream_->Read(&update_, &read_tag_);
+            } else {
+                std::lock_guard<std::mutex> lock(mutex_);
+                read_done_ = true;
+                if (!writing_) {
+                    FinishCall();
+                }
+            }
+            break;
+
+        case StreamTag::kWrite: {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!ok) {
+                // The call is broken; the outstanding read will fail too
+                pending_.clear();
+            }
+            WriteNext();
+            break;
+        }
+
+        case StreamTag::kFinish:
+            failed_.store(!status_.ok() && status_.error_code() != grpc::StatusCode::CANCELLED);
+            finished_.store(true);
+            break;
+        }
+    }
+
+private:
+    // Writes the next queued request, or finishes the call if reads have ended.
+    // Called with mutex_ held.
+    void WriteNext() {
+        if (read_done_) {
+            pending_.clear();
+        }
+        if (pending_.empty()) {
+            writing_ = false;
+            if (read_done_) {
+                FinishCall();
+            }
+            return;
+        }
+        writing_ = true;
+        request_ = std::move(pending_.front());
+        pending_.pop_front();
+        stream_->Write(request_, &write_tag_);
+    }
+
+    // Called with mutex_ held.
+    void FinishCall() {
+        if (finish_called_) {
+            return;
+        }
+        finish_called_ = true;
+        stream_->Finish(&status_, &finish_tag_);
+    }
+
+    void Count(int64_t received_ns) {
+        std::lock_guard<std::mutex> lock(stats_->mutex);
+        ++stats_->messages;
+        CountUpdate(update_, received_ns);
+    }
+
+    // Called with the stats lock held.
+    void CountUpdate(const MarketDataUpdate& update, int64_t received_ns) {
+        if (update.has_batch()) {
+            for (const auto& batched_update : update.batch().updates()) {
+                CountUpdate(batched_update, received_ns);
+            }
+        } else if (update.has_incremental_update()) {
+            ++stats_->updates;
+            uint64_t published_ns = update.incremental_update().publish_timestamp_ns();
+            if (published_ns != 0) {
+                stats_->latency.Record(received_ns - static_cast<int64_t>(published_ns));
+            }
+        } else if (update.has_snapshot()) {
+            ++stats_->snapshots;
+        }
+    }
+
+    MarketDataService::Stub* stub_;
+    CompletionQueue* cq_;
+    ThreadStats* stats_;
+    bool conflate_;
+    uint32_t max_updates_per_second_;
+    uint32_t depth_;
+
+    ClientContext context_;
+    std::unique_ptr<ClientAsyncReaderWriterInterface<SubscriptionRequest, MarketDataUpdate>> stream_;
+    // Queue-thread only
+    MarketDataUpdate update_;
+
+    std::mutex mutex_;
+    std::deque<SubscriptionRequest> pending_;
+    SubscriptionRequest request_;
+    bool started_ = false;
+    bool writing_ = false;
+    bool read_done_ = false;
+    bool finish_called_ = false;
+    Status status_;
+
+    std::atomic<bool> finished_{false};
+    std::atomic<bool> failed_{false};
+
+    StreamTag started_tag_{this, StreamTag::kStarted};
+    StreamTag read_tag_{this, StreamTag::kRead};
+    StreamTag write_tag_{this, StreamTag::kWrite};
+    StreamTag finish_tag_{this, StreamTag::kFinish};
+};
+
+void PollQueue(CompletionQueue* cq) {
+    void* tag;
+    bool ok;
+    while (cq->Next(&tag, &ok)) {
+        StreamTag* stream_tag = static_cast<StreamTag*>(tag);
+        stream_tag->stream->OnEvent(stream_tag->event, ok);
+    }
+}
+
+// Picks instruments for subscriptions according to the configured mix.
+class InstrumentMix {
+public:
+    InstrumentMix(const LoadOptions& options, std::mt19937_64* rng) : rng_(rng) {
+        std::vector<double> weights;
+        for (size_t i = 0; i < options.instruments; ++i) {
+            ids_.push_back("SYM" + std::to_string(i));
+            weights.push_back(options.hot_mix ? 1.0 / (i + 1) : 1.0);
+        }
+        distribution_ = std::discrete_distribution<size_t>(weights.begin(), weights.end());
+    }
+
+    // Draws an instrument not in taken, or an empty id if none turned up.
+    std::string Draw(const std::vector<std::string>& taken) {
+        for (int i = 0; i < kMaxDraws; ++i) {
+            const std::string& id = ids_[distribution_(*rng_)];
+            if (std::find(taken.begin(), taken.end(), id) == taken.end()) {
+                return id;
+            }
+        }
+        return std::string();
+    }
+
+private:
+    std::mt19937_64* rng_;
+    std::vector<std::string> ids_;
+    std::discrete_distribution<size_t> distribution_;
+};
+
+// Totals of one report interval
+struct Totals {
+    uint64_t messages = 0;
+    uint64_t updates = 0;
+    uint64_t snapshots = 0;
+    HdrHistogram latency{kMaxTrackedLatencyNs, kLatencyDigits};
+};
+
+void Collect(std::vector<std::unique_ptr<ThreadStats>>& stats, Totals* totals) {
+    for (auto& thread_stats : stats) {
+        std::lock_guard<std::mutex> lock(thread_stats->mutex);
+        totals->messages += thread_stats->messages;
+        totals->updates += thread_stats->updates;
+        totals->snapshots += thread_stats->snapshots;
+        totals->latency.Add(thread_stats->latency);
+        thread_stats->messages = 0;
+        thread_stats->updates = 0;
+        thread_stats->snapshots = 0;
+        thread_stats->latency.Reset();
+    }
+}
+
+void PrintReport(double elapsed, double seconds, size_t live_streams, size_t subscriptions, uint64_t churn,
+                 const Totals& totals) {
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(1);
+    report << "[" << std::setw(6) << elapsed << "s] streams " << live_streams << ", subscriptions " << subscriptions
+           << ", msgs/s " << static_cast<uint64_t>(totals.messages / seconds)
+           << ", updates/s " << static_cast<uint64_t>(totals.updates / seconds)
+           << ", snapshots/s " << static_cast<uint64_t>(totals.snapshots / seconds)
+           << ", churn/s " << static_cast<uint64_t>(churn / seconds) << ", latency us ";
+    if (totals.latency.count() == 0) {
+        report << "n/a";
+    } else {
+        report << "p50 " << totals.latency.ValueAtPercentile(50) / 1e3
+               << " p99 " << totals.latency.ValueAtPercentile(99) / 1e3
+               << " p99.9 " << totals.latency.ValueAtPercentile(99.9) / 1e3
+               << " max " << totals.latency.max() / 1e3;
+    }
+    std::cout << report.str() << std::endl;
+}
+
+void PrintUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "  --server=HOST:PORT       Server to load (default localhost:50051)\n"
+              << "  --streams=N              Subscribe streams to open (default 100)\n"
+              << "  --channels=N             Connections the streams are spread over (default 4)\n"
+              << "  --cq-threads=N           Completion queue threads driving the streams (default 2)\n"
+              << "  --instruments=N          Instruments SYM0..SYM<N-1> to subscribe to (default 100)\n"
+              << "  --subscriptions=N        Instruments per stream (default 4)\n"
+              << "  --mix=uniform|hot        Instrument popularity: even, or weighted by 1/rank\n"
+              << "  --conflate-fraction=F    Share of streams that subscribe with conflation (default 0)\n"
+              << "  --conflate-max-rate=N    Updates/s limit for conflated subscriptions (default none)\n"
+              << "  --depth=N                Subscribe to the best N levels per side only (default full depth)\n"
+              << "  --churn=N                Subscription changes per second over all streams (default 0)\n"
+              << "  --duration-s=N           How long to run (default 30)\n"
+              << "  --report-ms=N            Interval between reports (default 1000)\n"
+              << "  --seed=N                 Seed for subscription choices (default 1)\n"
+              << "  --profile=latency|throughput  gRPC transport settings, as given to the server" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    LoadOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        std::string value;
+        size_t count = 0;
+        int64_t seconds = 0;
+        int64_t millis = 0;
+        double factor = 0;
+        if (FlagValue(arg, "--server", &value)) {
+            options.server_address = value;
+        } else if (FlagValue(arg, "--streams", &value) && ParseNumber(value, &options.streams)) {
+        } else if (FlagValue(arg, "--channels", &value) && ParseNumber(value, &count)) {
+            options.channels = std::max<size_t>(1, count);
+        } else if (FlagValue(arg, "--cq-threads", &value) && ParseNumber(value, &count)) {
+            options.cq_threads = std::max<size_t>(1, count);
+        } else if (FlagValue(arg, "--instruments", &value) && ParseNumber(value, &count)) {
+            options.instruments = std::max<size_t>(1, count);
+        } else if (FlagValue(arg, "--subscriptions", &value) && ParseNumber(value, &options.subscriptions_per_stream)) {
+        } else if (FlagValue(arg, "--mix", &value) && (value == "uniform" || value == "hot")) {
+            options.hot_mix = value == "hot";
+        } else if (FlagValue(arg, "--conflate-fraction", &value) && ParseNumber(value, &factor) && factor >= 0 &&
+                   factor <= 1) {
+            options.conflate_fraction = factor;
+        } else if (FlagValue(arg, "--depth", &value) && ParseNumber(value, &options.depth)) {
+        } else if (FlagValue(arg, "--conflate-max-rate", &value) && ParseNumber(value, &options.conflate_max_rate)) {
+        } else if (FlagValue(arg, "--churn", &value) && ParseNumber(value, &factor) && factor >= 0) {
+            options.churn_per_second = factor;
+        } else if (FlagValue(arg, "--duration-s", &value) && ParseNumber(value, &seconds) && seconds >= 0) {
+            options.duration = std::chrono::seconds(seconds);
+        } else if (FlagValue(arg, "--report-ms", &value) && ParseNumber(value, &millis) && millis >= 0) {
+            options.report_interval = std::chrono::milliseconds(std::max<int64_t>(1, millis));
+        } else if (FlagValue(arg, "--seed", &value) && ParseNumber(value, &options.seed)) {
+        } else if (FlagValue(arg, "--profile", &value) && ParseTransportProfile(value, &options.profile)) {
+        } else {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+    options.subscriptions_per_stream = std::min(options.subscriptions_per_stream, options.instruments);
+
+    // Separate subchannel pools keep the channels from sharing one connection
+    std::vector<std::unique_ptr<MarketDataService::Stub>> stubs;
+    for (size_t i = 0; i < options.channels; ++i) {
+        ChannelArguments args;
+        args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+        ApplyTransportProfile(options.profile, &args);
+        stubs.push_back(MarketDataService::NewStub(
+            grpc::CreateCustomChannel(options.server_address, grpc::InsecureChannelCredentials(), args)));
+    }
+
+    std::vector<std::unique_ptr<CompletionQueue>> queues;
+    std::vector<std::unique_ptr<ThreadStats>> stats;
+    for (size_t i = 0; i < options.cq_threads; ++i) {
+        queues.push_back(std::make_unique<CompletionQueue>());
+        stats.push_back(std::make_unique<ThreadStats>());
+    }
+
+    std::mt19937_64 rng(options.seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    InstrumentMix mix(options, &rng);
+
+    // Subscriptions of each stream, owned by this thread
+    std::vector<std::unique_ptr<LoadStream>> streams;
+    std::vector<std::vector<std::string>> subscriptions(options.streams);
+    size_t total_subscriptions = 0;
+    for (size_t i = 0; i < options.streams; ++i) {
+        size_t queue = i % queues.size();
+        streams.push_back(std::make_unique<LoadStream>(stubs[i % stubs.size()].get(), queues[queue].get(),
+                                                       stats[queue].get(), uniform(rng) < options.conflate_fraction,
+                                                       options.conflate_max_rate, options.depth));
+        for (size_t j = 0; j < options.subscriptions_per_stream; ++j) {
+            std::string id = mix.Draw(subscriptions[i]);
+            if (id.empty()) {
+                break;
+            }
+            subscriptions[i].push_back(std::move(id));
+            ++total_subscriptions;
+        }
+        if (!subscriptions[i].empty()) {
+            streams[i]->Send(SubscriptionRequest::SUBSCRIBE, subscriptions[i]);
+        }
+    }
+
+    std::vector<std::thread> threads;
+    for (auto& cq : queues) {
+        threads.emplace_back(PollQueue, cq.get());
+    }
+    std::cout << "Load generator starting " << options.streams << " streams over " << options.channels
+              << " channels on " << options.cq_threads << " completion queue threads, " << total_subscriptions
+              << " subscriptions against " << options.server_address << std::endl;
+    for (auto& stream : streams) {
+        stream->Start();
+    }
+
+    // Drive churn and reports until the run is over
+    auto start = std::chrono::steady_clock::now();
+    auto end = start + options.duration;
+    auto last_report = start;
+    auto last_tick = start;
+    double churn_credit = 0;
+    uint64_t churn = 0;
+    uint64_t total_churn = 0;
+    Totals overall;
+    while (std::chrono::steady_clock::now() < end) {
+        std::this_thread::sleep_for(kDriverTick);
+        auto now = std::chrono::steady_clock::now();
+        churn_credit += options.churn_per_second * std::chrono::duration<double>(now - last_tick).count();
+        last_tick = now;
+        while (churn_credit >= 1 && !streams.empty()) {
+            churn_credit -= 1;
+            size_t i = std::uniform_int_distribution<size_t>(0, streams.size() - 1)(rng);
+            if (subscriptions[i].empty()) {
+                continue;
+            }
+            size_t slot = std::uniform_int_distribution<size_t>(0, subscriptions[i].size() - 1)(rng);
+            std::string id = mix.Draw(subscriptions[i]);
+            if (id.empty()) {
+                continue;
+            }
+            streams[i]->Send(SubscriptionRequest::UNSUBSCRIBE, subscriptions[i][slot]);
+            streams[i]->Send(SubscriptionRequest::SUBSCRIBE, id);
+            subscriptions[i][slot] = std::move(id);
+            ++churn;
+        }
+
+        if (now - last_report >= options.report_interval) {
+            Totals totals;
+            Collect(stats, &totals);
+            size_t live = std::count_if(streams.begin(), streams.end(), [](const auto& s) { return !s->finished(); });
+            PrintReport(std::chrono::duration<double>(now - start).count(),
+                        std::chrono::duration<double>(now - last_report).count(), live, total_subscriptions, churn,
+                        totals);
+            overall.messages += totals.messages;
+            overall.updates += totals.updates;
+            overall.snapshots += totals.snapshots;
+            overall.latency.Add(totals.latency);
+            total_churn += churn;
+            churn = 0;
+            last_report = now;
+        }
+    }
+
+    // Cancel every stream and wait for the calls to finish before tearing down the queues
+    for (auto& stream : streams) {
+        stream->Cancel();
+    }
+    while (!std::all_of(streams.begin(), streams.end(), [](const auto& s) { return s->finished(); })) {
+        std::this_thread::sleep_for(kDriverTick);
+    }
+    for (auto& cq : queues) {
+        cq->Shutdown();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    Totals totals;
+    Collect(stats, &totals);
+    overall.messages += totals.messages;
+    overall.updates += totals.updates;
+    overall.snapshots += totals.snapshots;
+    overall.latency.Add(totals.latency);
+    size_t failed = std::count_if(streams.begin(), streams.end(), [](const auto& s) { return s->failed(); });
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Load generator finished: " << failed << " of " << streams.size() << " streams failed. Overall:"
+              << std::endl;
+    PrintReport(seconds, seconds, 0, total_subscriptions, total_churn + churn, overall);
+    return 0;
+}
@@ -0,0 +1,152 @@
+#include "log.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Period the rate limit is counted over
+constexpr std::chrono::seconds kRateWindow(1);
+
+class Logger {
+public:
+    Logger() : thread_([this]() { WriterLoop(); }) {}
+
+    ~Logger() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        thread_.join();
+    }
+
+    void Configure(const LogOptions& options) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        options_ = options;
+    }
+
+    // Decides whether a line may be logged, counting it against the rate limit.
+    bool Admit(LogLevel level) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (level == LogLevel::kInfo && options_.quiet) {
+            return false;
+        }
+        RollWindow(std::chrono::steady_clock::now());
+        if (window_lines_ >= options_.max_lines_per_second) {
+            ++suppressed_;
+            return false;
+        }
+        ++window_lines_;
+        return true;
+    }
+
+    void Push(LogLevel level, std::string line) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_.emplace_back(level, std::move(line));
+            ++queued_;
+        }
+        cv_.notify_all();
+    }
+
+    void Flush() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        uint64_t target = queued_;
+        cv_.wait(lock, [this, target]() { return written_ >= target; });
+    }
+
+private:
+    // Starts a new rate window once the current one is over, reporting what it dropped.
+    // Called with mutex_ held.
+    void RollWindow(std::chrono::steady_clock::time_point now) {
+        if (now - window_start_ < kRateWindow) {
+            return;
+        }
+        if (suppressed_ > 0) {
+            pending_.emplace_back(LogLevel::kError,
+                                  "Suppressed " + std::to_string(suppressed_) + " log lines over the rate limit.");
+            ++queued_;
+            suppressed_ = 0;
+        }
+        window_start_ = now;
+        window_lines_ = 0;
+    }
+
+    void WriterLoop() {
+        std::vector<std::pair<LogLevel, std::string>> writing;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait_for(lock, kRateWindow, [this]() { return !pending_.empty() || stopping_; });
+            RollWindow(std::chrono::steady_clock::now());
+            if (pending_.empty()) {
+                if (stopping_) {
+                    return;
+                }
+                continue;
+            }
+
+            writing.swap(pending_);
+            lock.unlock();
+            for (const auto& entry : writing) {
+                FILE* out = entry.first == LogLevel::kError ? stderr : stdout;
+                std::fwrite(entry.second.data(), 1, entry.second.size(), out);
+                std::fputc('\n', out);
+            }
+            std::fflush(stdout);
+            std::fflush(stderr);
+            lock.lock();
+            written_ += writing.size();
+            writing.clear();
+            cv_.notify_all();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    LogOptions options_;
+    std::vector<std::pair<LogLevel, std::string>> pending_;
+    uint64_t queued_ = 0;
+    uint64_t written_ = 0;
+    bool stopping_ = false;
+
+    std::chrono::steady_clock::time_point window_start_;
+    size_t window_lines_ = 0;
+    uint64_t suppressed_ = 0;
+
+    std::thread thread_;
+};
+
+Logger& GetLogger() {
+    static Logger logger;
+    return logger;
+}
+
+} // namespace
+
+void ConfigureLogging(const LogOptions& options) {
+    GetLogger().Configure(options);
+}
+
+void FlushLog() {
+    GetLogger().Flush();
+}
+
+Log::Log(LogLevel level) : level_(level) {
+    if (GetLogger().Admit(level)) {
+        line_.emplace();
+    }
+}
+
+Log::~Log() {
+    if (line_) {
+        GetLogger().Push(level_, line_->str());
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <cstddef>
+#include <optional>
+#include <sstream>
+
+enum class LogLevel {
+    kInfo,   // Written to stdout; dropped in quiet mode
+    kError,  // Written to stderr
+};
+
+struct LogOptions {
+    // Drop info lines, for benchmark runs
+    bool quiet = false;
+    // Lines written per second before further ones are dropped and only counted
+    size_t max_lines_per_second = 1000;
+};
+
+// Applies to lines logged from now on.
+void ConfigureLogging(const LogOptions& options);
+
+// Blocks until every line logged so far has been written.
+void FlushLog();
+
+// One log line, written when the Log goes out of scope:
+//
+//     Log() << "Client connected.";
+//     Log(LogLevel::kError) << "Failed to write update.";
+//
+// The calling thread only formats the line and queues it; a background thread writes
+// queued lines in batches, flushing once per batch rather than once per line. Lines
+// beyond the rate limit are dropped and reported as a count, so a burst of logging
+// cannot throttle the thread doing it. A suppressed line is not even formatted.
+class Log {
+public:
+    explicit Log(LogLevel level = LogLevel::kInfo);
+    ~Log();
+    Log(const Log&) = delete;
+    Log& operator=(const Log&) = delete;
+
+    template <typename T>
+    Log& operator<<(const T& value) {
+        if (line_) {
+            *line_ << value;
+        }
+        return *this;
+    }
+
+private:
+    LogLevel level_;
+    std::optional<std::ostringstream> line_;
+};
+
+#endif // LOG_H
@@ -15,7 +15,7 @@
 #include <grpcpp/support/method_handler.h>
 #include <grpcpp/impl/rpc_service_method.h>
 #include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
 #include <grpcpp/server_context.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/support/sync_stream.h>
@@ -23,6 +23,7 @@ namespace marketdata {
 
 static const char* MarketDataService_method_names[] = {
   "/marketdata.MarketDataService/Subscribe",
+  "/marketdata.MarketDataService/GetStats",
 };
 
 std::unique_ptr< MarketDataService::Stub> MarketDataService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -33,6 +34,7 @@ std::unique_ptr< MarketDataService::Stub> MarketDataService::NewStub(const std::
 
 MarketDataService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
   : channel_(channel), rpcmethod_Subscribe_(MarketDataService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_GetStats_(MarketDataService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::ClientReaderWriter< ::marketdata::SubscriptionRequest, ::marketdata::MarketDataUpdate>* MarketDataService::Stub::SubscribeRaw(::grpc::ClientContext* context) {
@@ -51,6 +53,29 @@ void MarketDataService::Stub::async::Subscribe(::grpc::ClientContext* context, :
   return ::grpc::internal::ClientAsyncReaderWriterFactory< ::marketdata::SubscriptionRequest, ::marketdata::MarketDataUpdate>::Create(channel_.get(), cq, rpcmethod_Subscribe_, context, false, nullptr);
 }
 
+::grpc::Status MarketDataService::Stub::GetStats(::grpc::ClientContext* context, const ::marketdata::StatsRequest& request, ::marketdata::ServerStats* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::marketdata::StatsRequest, ::marketdata::ServerStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetStats_, context, request, response);
+}
+
+void MarketDataService::Stub::async::GetStats(::grpc::ClientContext* context, const ::marketdata::StatsRequest* request, ::marketdata::ServerStats* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::marketdata::StatsRequest, ::marketdata::ServerStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetStats_, context, request, response, std::move(f));
+}
+
+void MarketDataService::Stub::async::GetStats(::grpc::ClientContext* context, const ::marketdata::StatsRequest* request, ::marketdata::ServerStats* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetStats_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::marketdata::ServerStats>* MarketDataService::Stub::PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::marketdata::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::marketdata::ServerStats, ::marketdata::StatsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetStats_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::marketdata::ServerStats>* MarketDataService::Stub::AsyncGetStatsRaw(::grpc::ClientContext* context, const ::marketdata::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetStatsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 MarketDataService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       MarketDataService_method_names[0],
@@ -62,6 +87,16 @@ MarketDataService::Service::Service() {
              ::marketdata::SubscriptionRequest>* stream) {
                return service->Subscribe(ctx, stream);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MarketDataService_method_names[1],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MarketDataService::Service, ::marketdata::StatsRequest, ::marketdata::ServerStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MarketDataService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::marketdata::StatsRequest* req,
+             ::marketdata::ServerStats* resp) {
+               return service->GetStats(ctx, req, resp);
+             }, this)));
 }
 
 MarketDataService::Service::~Service() {
@@ -73,6 +108,13 @@ MarketDataService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status MarketDataService::Service::GetStats(::grpc::ServerContext* context, const ::marketdata::StatsRequest* request, ::marketdata::ServerStats* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace marketdata
 
@@ -15,16 +15,15 @@
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/support/message_allocator.h>
 #include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/proto_utils.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
 #include <grpcpp/impl/rpc_method.h>
 #include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
 #include <grpcpp/server_context.h>
 #include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/status.h>
+#include <grpcpp/impl/codegen/status.h>
 #include <grpcpp/support/stub_options.h>
 #include <grpcpp/support/sync_stream.h>
-#include <grpcpp/ports_def.inc>
 
 namespace marketdata {
 
@@ -47,11 +46,22 @@ class MarketDataService final {
     std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::marketdata::SubscriptionRequest, ::marketdata::MarketDataUpdate>> PrepareAsyncSubscribe(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::marketdata::SubscriptionRequest, ::marketdata::MarketDataUpdate>>(PrepareAsyncSubscribeRaw(context, cq));
     }
+    // Returns the server's counters, for monitoring
+    virtual ::grpc::Status GetStats(::grpc::ClientContext* context, const ::marketdata::StatsRequest& request, ::marketdata::ServerStats* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::marketdata::ServerStats>> AsyncGetStats(::grpc::ClientContext* context, const ::marketdata::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::marketdata::ServerStats>>(AsyncGetStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::marketdata::ServerStats>> PrepareAsyncGetStats(::grpc::ClientContext* context, const ::marketdata::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::marketdata::ServerStats>>(PrepareAsyncGetStatsRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
       // Bidirectional stream for subscribing and receiving market data
       virtual void Subscribe(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::marketdata::SubscriptionRequest,::marketdata::MarketDataUpdate>* reactor) = 0;
+      // Returns the server's counters, for monitoring
+      virtual void GetStats(::grpc::ClientContext* context, const ::marketdata::StatsRequest* request, ::marketdata::ServerStats* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetStats(::grpc::ClientContext* context, const ::marketdata::StatsRequest* request, ::marketdata::ServerStats* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -60,6 +70,8 @@ class MarketDataService final {
     virtual ::grpc::ClientReaderWriterInterface< ::marketdata::SubscriptionRequest, ::marketdata::MarketDataUpdate>* SubscribeRaw(::grpc::ClientContext* context) = 0;
     virtual ::grpc::ClientAsyncReaderWriterInterface< ::marketdata::SubscriptionRequest, ::marketdata::MarketDataUpdate>* AsyncSubscribeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
     virtual ::grpc::ClientAsyncReaderWriterInterface< ::marketdata::SubscriptionRequest, ::marketdata::MarketDataUpdate>* PrepareAsyncSubscribeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::marketdata::ServerStats>* AsyncGetStatsRaw(::grpc::ClientContext* context, const ::marketdata::StatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::marketdata::ServerStats>* PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::marketdata::StatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -73,10 +85,19 @@ class MarketDataService final {
     std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::marketdata::SubscriptionRequest, ::marketdata::MarketDataUpdate>> PrepareAsyncSubscribe(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::marketdata::SubscriptionRequest, ::marketdata::MarketDataUpdate>>(PrepareAsyncSubscribeRaw(context, cq));
     }
+    ::grpc::Status GetStats(::grpc::ClientContext* context, const ::marketdata::StatsRequest& request, ::marketdata::ServerStats* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::marketdata::ServerStats>> AsyncGetStats(::grpc::ClientContext* context, const ::marketdata::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::marketdata::ServerStats>>(AsyncGetStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::marketdata::ServerStats>> PrepareAsyncGetStats(::grpc::ClientContext* context, const ::marketdata::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::marketdata::ServerStats>>(PrepareAsyncGetStatsRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
       void Subscribe(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::marketdata::SubscriptionRequest,::marketdata::MarketDataUpdate>* reactor) override;
+      void GetStats(::grpc::ClientContext* context, const ::marketdata::StatsRequest* request, ::marketdata::ServerStats* response, std::function<void(::grpc::Status)>) override;
+      void GetStats(::grpc::ClientContext* context, const ::marketdata::StatsRequest* request, ::marketdata::ServerStats* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -91,7 +112,10 @@ class MarketDataService final {
     ::grpc::ClientReaderWriter< ::marketdata::SubscriptionRequest, ::marketdata::MarketDataUpdate>* SubscribeRaw(::grpc::ClientContext* context) override;
     ::grpc::ClientAsyncReaderWriter< ::marketdata::SubscriptionRequest, ::marketdata::MarketDataUpdate>* AsyncSubscribeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
     ::grpc::ClientAsyncReaderWriter< ::marketdata::SubscriptionRequest, ::marketdata::MarketDataUpdate>* PrepareAsyncSubscribeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::marketdata::ServerStats>* AsyncGetStatsRaw(::grpc::ClientContext* context, const ::marketdata::StatsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::marketdata::ServerStats>* PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::marketdata::StatsRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_Subscribe_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetStats_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -101,6 +125,8 @@ class MarketDataService final {
     virtual ~Service();
     // Bidirectional stream for subscribing and receiving market data
     virtual ::grpc::Status Subscribe(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::marketdata::MarketDataUpdate, ::marketdata::SubscriptionRequest>* stream);
+    // Returns the server's counters, for monitoring
+    virtual ::grpc::Status GetStats(::grpc::ServerContext* context, const ::marketdata::StatsRequest* request, ::marketdata::ServerStats* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_Subscribe : public BaseClass {
@@ -122,7 +148,27 @@ class MarketDataService final {
       ::grpc::Service::RequestAsyncBidiStreaming(0, context, stream, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_Subscribe<Service > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetStats() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::marketdata::StatsRequest* /*request*/, ::marketdata::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetStats(::grpc::ServerContext* context, ::marketdata::StatsRequest* request, ::grpc::ServerAsyncResponseWriter< ::marketdata::ServerStats>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_Subscribe<WithAsyncMethod_GetStats<Service > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_Subscribe : public BaseClass {
    private:
@@ -146,7 +192,34 @@ class MarketDataService final {
       ::grpc::CallbackServerContext* /*context*/)
       { return nullptr; }
   };
-  typedef WithCallbackMethod_Subscribe<Service > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetStats() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::marketdata::StatsRequest, ::marketdata::ServerStats>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::marketdata::StatsRequest* request, ::marketdata::ServerStats* response) { return this->GetStats(context, request, response); }));}
+    void SetMessageAllocatorFor_GetStats(
+        ::grpc::MessageAllocator< ::marketdata::StatsRequest, ::marketdata::ServerStats>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::marketdata::StatsRequest, ::marketdata::ServerStats>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::marketdata::StatsRequest* /*request*/, ::marketdata::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::marketdata::StatsRequest* /*request*/, ::marketdata::ServerStats* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_Subscribe<WithCallbackMethod_GetStats<Service > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_Subscribe : public BaseClass {
@@ -166,6 +239,23 @@ class MarketDataService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetStats() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::marketdata::StatsRequest* /*request*/, ::marketdata::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Subscribe : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -186,6 +276,26 @@ class MarketDataService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetStats() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::marketdata::StatsRequest* /*request*/, ::marketdata::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetStats(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_Subscribe : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -208,13 +318,61 @@ class MarketDataService final {
       ::grpc::CallbackServerContext* /*context*/)
       { return nullptr; }
   };
-  typedef Service StreamedUnaryService;
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetStats() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetStats(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::marketdata::StatsRequest* /*request*/, ::marketdata::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetStats() {
+      ::grpc::Service::MarkMethodStreamed(1,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::marketdata::StatsRequest, ::marketdata::ServerStats>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::marketdata::StatsRequest, ::marketdata::ServerStats>* streamer) {
+                       return this->StreamedGetStats(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::marketdata::StatsRequest* /*request*/, ::marketdata::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetStats(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::marketdata::StatsRequest,::marketdata::ServerStats>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_GetStats<Service > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef Service StreamedService;
+  typedef WithStreamedUnaryMethod_GetStats<Service > StreamedService;
 };
 
 }  // namespace marketdata
 
 
-#include <grpcpp/ports_undef.inc>
 #endif  // GRPC_market_5fdata_2eproto__INCLUDED
@@ -1,540 +1,805 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
 // source: market_data.proto
-// Protobuf C++ Version: 5.29.3
 
 #include "market_data.pb.h"
 
 #include <algorithm>
-#include <type_traits>
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/generated_message_tctable_impl.h"
-#include "google/protobuf/extension_set.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "google/protobuf/descriptor.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/reflection_ops.h"
-#include "google/protobuf/wire_format.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-// Must be included last.
-#include "google/protobuf/port_def.inc"
 PROTOBUF_PRAGMA_INIT_SEG
-namespace _pb = ::google::protobuf;
-namespace _pbi = ::google::protobuf::internal;
-namespace _fl = ::google::protobuf::internal::field_layout;
-namespace marketdata {
 
-inline constexpr SubscriptionRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : instrument_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        action_{static_cast< ::marketdata::SubscriptionRequest_Action >(0)},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR SubscriptionRequest::SubscriptionRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace marketdata {
+PROTOBUF_CONSTEXPR SubscriptionRequest::SubscriptionRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.instrument_ids_)*/{}
+  , /*decltype(_impl_.instrument_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.action_)*/0
+  , /*decltype(_impl_.conflate_)*/false
+  , /*decltype(_impl_.max_updates_per_second_)*/0u
+  , /*decltype(_impl_.depth_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct SubscriptionRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SubscriptionRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR SubscriptionRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~SubscriptionRequestDefaultTypeInternal() {}
   union {
     SubscriptionRequest _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubscriptionRequestDefaultTypeInternal _SubscriptionRequest_default_instance_;
-
-inline constexpr PriceLevel::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : price_{0},
-        quantity_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR PriceLevel::PriceLevel(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct PriceLevelDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR PriceLevelDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~PriceLevelDefaultTypeInternal() {}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubscriptionRequestDefaultTypeInternal _SubscriptionRequest_default_instance_;
+PROTOBUF_CONSTEXPR MarketDataUpdate::MarketDataUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.update_type_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct MarketDataUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MarketDataUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MarketDataUpdateDefaultTypeInternal() {}
   union {
-    PriceLevel _instance;
+    MarketDataUpdate _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PriceLevelDefaultTypeInternal _PriceLevel_default_instance_;
-
-inline constexpr OrderBookSnapshot::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : bids_{},
-        asks_{},
-        instrument_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR OrderBookSnapshot::OrderBookSnapshot(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MarketDataUpdateDefaultTypeInternal _MarketDataUpdate_default_instance_;
+PROTOBUF_CONSTEXPR MarketDataBatch::MarketDataBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.updates_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MarketDataBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MarketDataBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MarketDataBatchDefaultTypeInternal() {}
+  union {
+    MarketDataBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MarketDataBatchDefaultTypeInternal _MarketDataBatch_default_instance_;
+PROTOBUF_CONSTEXPR SymbolDirectory_Entry::SymbolDirectory_Entry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.instrument_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.instrument_handle_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SymbolDirectory_EntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SymbolDirectory_EntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SymbolDirectory_EntryDefaultTypeInternal() {}
+  union {
+    SymbolDirectory_Entry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SymbolDirectory_EntryDefaultTypeInternal _SymbolDirectory_Entry_default_instance_;
+PROTOBUF_CONSTEXPR SymbolDirectory::SymbolDirectory(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SymbolDirectoryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SymbolDirectoryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SymbolDirectoryDefaultTypeInternal() {}
+  union {
+    SymbolDirectory _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SymbolDirectoryDefaultTypeInternal _SymbolDirectory_default_instance_;
+PROTOBUF_CONSTEXPR OrderBookSnapshot::OrderBookSnapshot(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bids_)*/{}
+  , /*decltype(_impl_.asks_)*/{}
+  , /*decltype(_impl_.instrument_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.tick_size_)*/0
+  , /*decltype(_impl_.lot_size_)*/0
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct OrderBookSnapshotDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR OrderBookSnapshotDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR OrderBookSnapshotDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~OrderBookSnapshotDefaultTypeInternal() {}
   union {
     OrderBookSnapshot _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OrderBookSnapshotDefaultTypeInternal _OrderBookSnapshot_default_instance_;
-
-inline constexpr OrderBookIncrementalUpdate::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : bid_updates_{},
-        ask_updates_{},
-        instrument_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR OrderBookIncrementalUpdate::OrderBookIncrementalUpdate(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OrderBookSnapshotDefaultTypeInternal _OrderBookSnapshot_default_instance_;
+PROTOBUF_CONSTEXPR OrderBookIncrementalUpdate::OrderBookIncrementalUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bid_updates_)*/{}
+  , /*decltype(_impl_.ask_updates_)*/{}
+  , /*decltype(_impl_.price_deltas_)*/{}
+  , /*decltype(_impl_._price_deltas_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.quantity_lots_)*/{}
+  , /*decltype(_impl_._quantity_lots_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.instrument_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.first_sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.publish_timestamp_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.instrument_handle_)*/0u
+  , /*decltype(_impl_.bid_count_)*/0u
+  , /*decltype(_impl_.base_price_ticks_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct OrderBookIncrementalUpdateDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR OrderBookIncrementalUpdateDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR OrderBookIncrementalUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~OrderBookIncrementalUpdateDefaultTypeInternal() {}
   union {
     OrderBookIncrementalUpdate _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OrderBookIncrementalUpdateDefaultTypeInternal _OrderBookIncrementalUpdate_default_instance_;
-
-inline constexpr MarketDataUpdate::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : update_type_{},
-        _cached_size_{0},
-        _oneof_case_{} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR MarketDataUpdate::MarketDataUpdate(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct MarketDataUpdateDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR MarketDataUpdateDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~MarketDataUpdateDefaultTypeInternal() {}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OrderBookIncrementalUpdateDefaultTypeInternal _OrderBookIncrementalUpdate_default_instance_;
+PROTOBUF_CONSTEXPR PriceLevel::PriceLevel(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.price_)*/0
+  , /*decltype(_impl_.quantity_)*/0
+  , /*decltype(_impl_.price_ticks_)*/int64_t{0}
+  , /*decltype(_impl_.quantity_lots_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PriceLevelDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PriceLevelDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PriceLevelDefaultTypeInternal() {}
   union {
-    MarketDataUpdate _instance;
+    PriceLevel _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MarketDataUpdateDefaultTypeInternal _MarketDataUpdate_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PriceLevelDefaultTypeInternal _PriceLevel_default_instance_;
+PROTOBUF_CONSTEXPR StatsRequest::StatsRequest(
+    ::_pbi::ConstantInitialized) {}
+struct StatsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsRequestDefaultTypeInternal() {}
+  union {
+    StatsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsRequestDefaultTypeInternal _StatsRequest_default_instance_;
+PROTOBUF_CONSTEXPR StreamStats::StreamStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.peer_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.stream_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.messages_sent_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_sent_)*/uint64_t{0u}
+  , /*decltype(_impl_.write_blocked_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.queue_depth_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_queue_depth_)*/uint64_t{0u}
+  , /*decltype(_impl_.updates_conflated_)*/uint64_t{0u}
+  , /*decltype(_impl_.updates_dropped_)*/uint64_t{0u}
+  , /*decltype(_impl_.subscriptions_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StreamStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StreamStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StreamStatsDefaultTypeInternal() {}
+  union {
+    StreamStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StreamStatsDefaultTypeInternal _StreamStats_default_instance_;
+PROTOBUF_CONSTEXPR InstrumentStats::InstrumentStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.instrument_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.updates_published_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_published_)*/uint64_t{0u}
+  , /*decltype(_impl_.deliveries_)*/uint64_t{0u}
+  , /*decltype(_impl_.snapshots_sent_)*/uint64_t{0u}
+  , /*decltype(_impl_.snapshots_built_)*/uint64_t{0u}
+  , /*decltype(_impl_.subscribers_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InstrumentStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InstrumentStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InstrumentStatsDefaultTypeInternal() {}
+  union {
+    InstrumentStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InstrumentStatsDefaultTypeInternal _InstrumentStats_default_instance_;
+PROTOBUF_CONSTEXPR ServerStats::ServerStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.streams_)*/{}
+  , /*decltype(_impl_.instruments_)*/{}
+  , /*decltype(_impl_.closed_streams_)*/nullptr
+  , /*decltype(_impl_.streams_opened_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServerStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerStatsDefaultTypeInternal() {}
+  union {
+    ServerStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerStatsDefaultTypeInternal _ServerStats_default_instance_;
 }  // namespace marketdata
+static ::_pb::Metadata file_level_metadata_market_5fdata_2eproto[12];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_market_5fdata_2eproto[1];
-static constexpr const ::_pb::ServiceDescriptor**
-    file_level_service_descriptors_market_5fdata_2eproto = nullptr;
-const ::uint32_t
-    TableStruct_market_5fdata_2eproto::offsets[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-        protodesc_cold) = {
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::marketdata::SubscriptionRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::marketdata::SubscriptionRequest, _impl_.action_),
-        PROTOBUF_FIELD_OFFSET(::marketdata::SubscriptionRequest, _impl_.instrument_id_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::marketdata::MarketDataUpdate, _internal_metadata_),
-        ~0u,  // no _extensions_
-        PROTOBUF_FIELD_OFFSET(::marketdata::MarketDataUpdate, _impl_._oneof_case_[0]),
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        ::_pbi::kInvalidFieldOffsetTag,
-        ::_pbi::kInvalidFieldOffsetTag,
-        PROTOBUF_FIELD_OFFSET(::marketdata::MarketDataUpdate, _impl_.update_type_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookSnapshot, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookSnapshot, _impl_.instrument_id_),
-        PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookSnapshot, _impl_.bids_),
-        PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookSnapshot, _impl_.asks_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _impl_.instrument_id_),
-        PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _impl_.bid_updates_),
-        PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _impl_.ask_updates_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::marketdata::PriceLevel, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::marketdata::PriceLevel, _impl_.price_),
-        PROTOBUF_FIELD_OFFSET(::marketdata::PriceLevel, _impl_.quantity_),
-};
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_market_5fdata_2eproto = nullptr;
 
-static const ::_pbi::MigrationSchema
-    schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-        {0, -1, -1, sizeof(::marketdata::SubscriptionRequest)},
-        {10, -1, -1, sizeof(::marketdata::MarketDataUpdate)},
-        {21, -1, -1, sizeof(::marketdata::OrderBookSnapshot)},
-        {32, -1, -1, sizeof(::marketdata::OrderBookIncrementalUpdate)},
-        {43, -1, -1, sizeof(::marketdata::PriceLevel)},
+const uint32_t TableStruct_market_5fdata_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::marketdata::SubscriptionRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::marketdata::SubscriptionRequest, _impl_.action_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::SubscriptionRequest, _impl_.instrument_id_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::SubscriptionRequest, _impl_.conflate_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::SubscriptionRequest, _impl_.max_updates_per_second_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::SubscriptionRequest, _impl_.depth_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::SubscriptionRequest, _impl_.instrument_ids_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::marketdata::MarketDataUpdate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::marketdata::MarketDataUpdate, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::marketdata::MarketDataUpdate, _impl_.update_type_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::marketdata::MarketDataBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::marketdata::MarketDataBatch, _impl_.updates_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::marketdata::SymbolDirectory_Entry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::marketdata::SymbolDirectory_Entry, _impl_.instrument_id_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::SymbolDirectory_Entry, _impl_.instrument_handle_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::marketdata::SymbolDirectory, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::marketdata::SymbolDirectory, _impl_.entries_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookSnapshot, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookSnapshot, _impl_.instrument_id_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookSnapshot, _impl_.bids_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookSnapshot, _impl_.asks_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookSnapshot, _impl_.tick_size_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookSnapshot, _impl_.lot_size_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookSnapshot, _impl_.sequence_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _impl_.instrument_id_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _impl_.bid_updates_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _impl_.ask_updates_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _impl_.instrument_handle_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _impl_.first_sequence_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _impl_.publish_timestamp_ns_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _impl_.base_price_ticks_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _impl_.price_deltas_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _impl_.quantity_lots_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::OrderBookIncrementalUpdate, _impl_.bid_count_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::marketdata::PriceLevel, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::marketdata::PriceLevel, _impl_.price_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::PriceLevel, _impl_.quantity_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::PriceLevel, _impl_.price_ticks_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::PriceLevel, _impl_.quantity_lots_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::marketdata::StatsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::marketdata::StreamStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::marketdata::StreamStats, _impl_.stream_id_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::StreamStats, _impl_.peer_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::StreamStats, _impl_.subscriptions_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::StreamStats, _impl_.messages_sent_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::StreamStats, _impl_.bytes_sent_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::StreamStats, _impl_.write_blocked_ns_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::StreamStats, _impl_.queue_depth_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::StreamStats, _impl_.max_queue_depth_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::StreamStats, _impl_.updates_conflated_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::StreamStats, _impl_.updates_dropped_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::marketdata::InstrumentStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::marketdata::InstrumentStats, _impl_.instrument_id_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::InstrumentStats, _impl_.subscribers_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::InstrumentStats, _impl_.updates_published_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::InstrumentStats, _impl_.bytes_published_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::InstrumentStats, _impl_.deliveries_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::InstrumentStats, _impl_.snapshots_sent_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::InstrumentStats, _impl_.snapshots_built_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::marketdata::ServerStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::marketdata::ServerStats, _impl_.streams_opened_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::ServerStats, _impl_.streams_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::ServerStats, _impl_.closed_streams_),
+  PROTOBUF_FIELD_OFFSET(::marketdata::ServerStats, _impl_.instruments_),
 };
-static const ::_pb::Message* const file_default_instances[] = {
-    &::marketdata::_SubscriptionRequest_default_instance_._instance,
-    &::marketdata::_MarketDataUpdate_default_instance_._instance,
-    &::marketdata::_OrderBookSnapshot_default_instance_._instance,
-    &::marketdata::_OrderBookIncrementalUpdate_default_instance_._instance,
-    &::marketdata::_PriceLevel_default_instance_._instance,
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::marketdata::SubscriptionRequest)},
+  { 12, -1, -1, sizeof(::marketdata::MarketDataUpdate)},
+  { 23, -1, -1, sizeof(::marketdata::MarketDataBatch)},
+  { 30, -1, -1, sizeof(::marketdata::SymbolDirectory_Entry)},
+  { 38, -1, -1, sizeof(::marketdata::SymbolDirectory)},
+  { 45, -1, -1, sizeof(::marketdata::OrderBookSnapshot)},
+  { 57, -1, -1, sizeof(::marketdata::OrderBookIncrementalUpdate)},
+  { 74, -1, -1, sizeof(::marketdata::PriceLevel)},
+  { 84, -1, -1, sizeof(::marketdata::StatsRequest)},
+  { 90, -1, -1, sizeof(::marketdata::StreamStats)},
+  { 106, -1, -1, sizeof(::marketdata::InstrumentStats)},
+  { 119, -1, -1, sizeof(::marketdata::ServerStats)},
 };
-const char descriptor_table_protodef_market_5fdata_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-    protodesc_cold) = {
-    "\n\021market_data.proto\022\nmarketdata\"\216\001\n\023Subs"
-    "criptionRequest\0226\n\006action\030\001 \001(\0162&.market"
-    "data.SubscriptionRequest.Action\022\025\n\rinstr"
-    "ument_id\030\002 \001(\t\"(\n\006Action\022\r\n\tSUBSCRIBE\020\000\022"
-    "\017\n\013UNSUBSCRIBE\020\001\"\232\001\n\020MarketDataUpdate\0221\n"
-    "\010snapshot\030\001 \001(\0132\035.marketdata.OrderBookSn"
-    "apshotH\000\022D\n\022incremental_update\030\002 \001(\0132&.m"
-    "arketdata.OrderBookIncrementalUpdateH\000B\r"
-    "\n\013update_type\"v\n\021OrderBookSnapshot\022\025\n\rin"
-    "strument_id\030\001 \001(\t\022$\n\004bids\030\002 \003(\0132\026.market"
-    "data.PriceLevel\022$\n\004asks\030\003 \003(\0132\026.marketda"
-    "ta.PriceLevel\"\215\001\n\032OrderBookIncrementalUp"
-    "date\022\025\n\rinstrument_id\030\001 \001(\t\022+\n\013bid_updat"
-    "es\030\002 \003(\0132\026.marketdata.PriceLevel\022+\n\013ask_"
-    "updates\030\003 \003(\0132\026.marketdata.PriceLevel\"-\n"
-    "\nPriceLevel\022\r\n\005price\030\001 \001(\001\022\020\n\010quantity\030\002"
-    " \001(\0012c\n\021MarketDataService\022N\n\tSubscribe\022\037"
-    ".marketdata.SubscriptionRequest\032\034.market"
-    "data.MarketDataUpdate(\0010\001b\006proto3"
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::marketdata::_SubscriptionRequest_default_instance_._instance,
+  &::marketdata::_MarketDataUpdate_default_instance_._instance,
+  &::marketdata::_MarketDataBatch_default_instance_._instance,
+  &::marketdata::_SymbolDirectory_Entry_default_instance_._instance,
+  &::marketdata::_SymbolDirectory_default_instance_._instance,
+  &::marketdata::_OrderBookSnapshot_default_instance_._instance,
+  &::marketdata::_OrderBookIncrementalUpdate_default_instance_._instance,
+  &::marketdata::_PriceLevel_default_instance_._instance,
+  &::marketdata::_StatsRequest_default_instance_._instance,
+  &::marketdata::_StreamStats_default_instance_._instance,
+  &::marketdata::_InstrumentStats_default_instance_._instance,
+  &::marketdata::_ServerStats_default_instance_._instance,
 };
-static ::absl::once_flag descriptor_table_market_5fdata_2eproto_once;
-PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_market_5fdata_2eproto = {
-    false,
-    false,
-    753,
-    descriptor_table_protodef_market_5fdata_2eproto,
+
+const char descriptor_table_protodef_market_5fdata_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021market_data.proto\022\nmarketdata\"\210\002\n\023Subs"
+  "criptionRequest\0226\n\006action\030\001 \001(\0162&.market"
+  "data.SubscriptionRequest.Action\022\025\n\rinstr"
+  "ument_id\030\002 \001(\t\022\020\n\010conflate\030\003 \001(\010\022\036\n\026max_"
+  "updates_per_second\030\004 \001(\r\022\r\n\005depth\030\005 \001(\r\022"
+  "\026\n\016instrument_ids\030\006 \003(\t\"I\n\006Action\022\r\n\tSUB"
+  "SCRIBE\020\000\022\017\n\013UNSUBSCRIBE\020\001\022\014\n\010SNAPSHOT\020\002\022"
+  "\021\n\rSNAPSHOT_ONLY\020\003\"\201\002\n\020MarketDataUpdate\022"
+  "1\n\010snapshot\030\001 \001(\0132\035.marketdata.OrderBook"
+  "SnapshotH\000\022D\n\022incremental_update\030\002 \001(\0132&"
+  ".marketdata.OrderBookIncrementalUpdateH\000"
+  "\0227\n\020symbol_directory\030\003 \001(\0132\033.marketdata."
+  "SymbolDirectoryH\000\022,\n\005batch\030\004 \001(\0132\033.marke"
+  "tdata.MarketDataBatchH\000B\r\n\013update_type\"@"
+  "\n\017MarketDataBatch\022-\n\007updates\030\001 \003(\0132\034.mar"
+  "ketdata.MarketDataUpdate\"\200\001\n\017SymbolDirec"
+  "tory\0222\n\007entries\030\001 \003(\0132!.marketdata.Symbo"
+  "lDirectory.Entry\0329\n\005Entry\022\025\n\rinstrument_"
+  "id\030\001 \001(\t\022\031\n\021instrument_handle\030\002 \001(\r\"\255\001\n\021"
+  "OrderBookSnapshot\022\025\n\rinstrument_id\030\001 \001(\t"
+  "\022$\n\004bids\030\002 \003(\0132\026.marketdata.PriceLevel\022$"
+  "\n\004asks\030\003 \003(\0132\026.marketdata.PriceLevel\022\021\n\t"
+  "tick_size\030\004 \001(\001\022\020\n\010lot_size\030\005 \001(\001\022\020\n\010seq"
+  "uence\030\006 \001(\004\"\312\002\n\032OrderBookIncrementalUpda"
+  "te\022\025\n\rinstrument_id\030\001 \001(\t\022+\n\013bid_updates"
+  "\030\002 \003(\0132\026.marketdata.PriceLevel\022+\n\013ask_up"
+  "dates\030\003 \003(\0132\026.marketdata.PriceLevel\022\031\n\021i"
+  "nstrument_handle\030\004 \001(\r\022\020\n\010sequence\030\005 \001(\004"
+  "\022\026\n\016first_sequence\030\006 \001(\004\022\034\n\024publish_time"
+  "stamp_ns\030\007 \001(\006\022\030\n\020base_price_ticks\030\010 \001(\022"
+  "\022\024\n\014price_deltas\030\t \003(\021\022\025\n\rquantity_lots\030"
+  "\n \003(\004\022\021\n\tbid_count\030\013 \001(\r\"Y\n\nPriceLevel\022\r"
+  "\n\005price\030\001 \001(\001\022\020\n\010quantity\030\002 \001(\001\022\023\n\013price"
+  "_ticks\030\003 \001(\022\022\025\n\rquantity_lots\030\004 \001(\003\"\016\n\014S"
+  "tatsRequest\"\354\001\n\013StreamStats\022\021\n\tstream_id"
+  "\030\001 \001(\004\022\014\n\004peer\030\002 \001(\t\022\025\n\rsubscriptions\030\003 "
+  "\001(\r\022\025\n\rmessages_sent\030\004 \001(\004\022\022\n\nbytes_sent"
+  "\030\005 \001(\004\022\030\n\020write_blocked_ns\030\006 \001(\004\022\023\n\013queu"
+  "e_depth\030\007 \001(\004\022\027\n\017max_queue_depth\030\010 \001(\004\022\031"
+  "\n\021updates_conflated\030\t \001(\004\022\027\n\017updates_dro"
+  "pped\030\n \001(\004\"\266\001\n\017InstrumentStats\022\025\n\rinstru"
+  "ment_id\030\001 \001(\t\022\023\n\013subscribers\030\002 \001(\r\022\031\n\021up"
+  "dates_published\030\003 \001(\004\022\027\n\017bytes_published"
+  "\030\004 \001(\004\022\022\n\ndeliveries\030\005 \001(\004\022\026\n\016snapshots_"
+  "sent\030\006 \001(\004\022\027\n\017snapshots_built\030\007 \001(\004\"\262\001\n\013"
+  "ServerStats\022\026\n\016streams_opened\030\001 \001(\004\022(\n\007s"
+  "treams\030\002 \003(\0132\027.marketdata.StreamStats\022/\n"
+  "\016closed_streams\030\003 \001(\0132\027.marketdata.Strea"
+  "mStats\0220\n\013instruments\030\004 \003(\0132\033.marketdata"
+  ".InstrumentStats2\242\001\n\021MarketDataService\022N"
+  "\n\tSubscribe\022\037.marketdata.SubscriptionReq"
+  "uest\032\034.marketdata.MarketDataUpdate(\0010\001\022="
+  "\n\010GetStats\022\030.marketdata.StatsRequest\032\027.m"
+  "arketdata.ServerStatsB\003\370\001\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_market_5fdata_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_market_5fdata_2eproto = {
+    false, false, 2154, descriptor_table_protodef_market_5fdata_2eproto,
     "market_data.proto",
-    &descriptor_table_market_5fdata_2eproto_once,
-    nullptr,
-    0,
-    5,
-    schemas,
-    file_default_instances,
-    TableStruct_market_5fdata_2eproto::offsets,
-    file_level_enum_descriptors_market_5fdata_2eproto,
+    &descriptor_table_market_5fdata_2eproto_once, nullptr, 0, 12,
+    schemas, file_default_instances, TableStruct_market_5fdata_2eproto::offsets,
+    file_level_metadata_market_5fdata_2eproto, file_level_enum_descriptors_market_5fdata_2eproto,
     file_level_service_descriptors_market_5fdata_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_market_5fdata_2eproto_getter() {
+  return &descriptor_table_market_5fdata_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_market_5fdata_2eproto(&descriptor_table_market_5fdata_2eproto);
 namespace marketdata {
-const ::google::protobuf::EnumDescriptor* SubscriptionRequest_Action_descriptor() {
-  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_market_5fdata_2eproto);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SubscriptionRequest_Action_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_market_5fdata_2eproto);
   return file_level_enum_descriptors_market_5fdata_2eproto[0];
 }
-PROTOBUF_CONSTINIT const uint32_t SubscriptionRequest_Action_internal_data_[] = {
-    131072u, 0u, };
 bool SubscriptionRequest_Action_IsValid(int value) {
-  return 0 <= value && value <= 1;
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
 }
-#if (__cplusplus < 201703) && \
-  (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 constexpr SubscriptionRequest_Action SubscriptionRequest::SUBSCRIBE;
 constexpr SubscriptionRequest_Action SubscriptionRequest::UNSUBSCRIBE;
+constexpr SubscriptionRequest_Action SubscriptionRequest::SNAPSHOT;
+constexpr SubscriptionRequest_Action SubscriptionRequest::SNAPSHOT_ONLY;
 constexpr SubscriptionRequest_Action SubscriptionRequest::Action_MIN;
 constexpr SubscriptionRequest_Action SubscriptionRequest::Action_MAX;
 constexpr int SubscriptionRequest::Action_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
-#endif  // (__cplusplus < 201703) &&
-        // (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 // ===================================================================
 
 class SubscriptionRequest::_Internal {
  public:
 };
 
-SubscriptionRequest::SubscriptionRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
+SubscriptionRequest::SubscriptionRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:marketdata.SubscriptionRequest)
 }
-inline PROTOBUF_NDEBUG_INLINE SubscriptionRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::marketdata::SubscriptionRequest& from_msg)
-      : instrument_id_(arena, from.instrument_id_),
-        _cached_size_{0} {}
-
-SubscriptionRequest::SubscriptionRequest(
-    ::google::protobuf::Arena* arena,
-    const SubscriptionRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SubscriptionRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.action_ = from._impl_.action_;
+SubscriptionRequest::SubscriptionRequest(const SubscriptionRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SubscriptionRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.instrument_ids_){from._impl_.instrument_ids_}
+    , decltype(_impl_.instrument_id_){}
+    , decltype(_impl_.action_){}
+    , decltype(_impl_.conflate_){}
+    , decltype(_impl_.max_updates_per_second_){}
+    , decltype(_impl_.depth_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.instrument_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_instrument_id().empty()) {
+    _this->_impl_.instrument_id_.Set(from._internal_instrument_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.action_, &from._impl_.action_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.depth_) -
+    reinterpret_cast<char*>(&_impl_.action_)) + sizeof(_impl_.depth_));
   // @@protoc_insertion_point(copy_constructor:marketdata.SubscriptionRequest)
 }
-inline PROTOBUF_NDEBUG_INLINE SubscriptionRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : instrument_id_(arena),
-        _cached_size_{0} {}
 
-inline void SubscriptionRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.action_ = {};
+inline void SubscriptionRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.instrument_ids_){arena}
+    , decltype(_impl_.instrument_id_){}
+    , decltype(_impl_.action_){0}
+    , decltype(_impl_.conflate_){false}
+    , decltype(_impl_.max_updates_per_second_){0u}
+    , decltype(_impl_.depth_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.instrument_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
+
 SubscriptionRequest::~SubscriptionRequest() {
   // @@protoc_insertion_point(destructor:marketdata.SubscriptionRequest)
-  SharedDtor(*this);
-}
-inline void SubscriptionRequest::SharedDtor(MessageLite& self) {
-  SubscriptionRequest& this_ = static_cast<SubscriptionRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.instrument_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* SubscriptionRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) SubscriptionRequest(arena);
-}
-constexpr auto SubscriptionRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(SubscriptionRequest),
-                                            alignof(SubscriptionRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull SubscriptionRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_SubscriptionRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &SubscriptionRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<SubscriptionRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &SubscriptionRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<SubscriptionRequest>(), &SubscriptionRequest::ByteSizeLong,
-            &SubscriptionRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(SubscriptionRequest, _impl_._cached_size_),
-        false,
-    },
-    &SubscriptionRequest::kDescriptorMethods,
-    &descriptor_table_market_5fdata_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* SubscriptionRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubscriptionRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.instrument_ids_.~RepeatedPtrField();
+  _impl_.instrument_id_.Destroy();
+}
+
+void SubscriptionRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 52, 2> SubscriptionRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::marketdata::SubscriptionRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string instrument_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(SubscriptionRequest, _impl_.instrument_id_)}},
-    // .marketdata.SubscriptionRequest.Action action = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SubscriptionRequest, _impl_.action_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(SubscriptionRequest, _impl_.action_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .marketdata.SubscriptionRequest.Action action = 1;
-    {PROTOBUF_FIELD_OFFSET(SubscriptionRequest, _impl_.action_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-    // string instrument_id = 2;
-    {PROTOBUF_FIELD_OFFSET(SubscriptionRequest, _impl_.instrument_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\36\0\15\0\0\0\0\0"
-    "marketdata.SubscriptionRequest"
-    "instrument_id"
-  }},
-};
 
-PROTOBUF_NOINLINE void SubscriptionRequest::Clear() {
+void SubscriptionRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:marketdata.SubscriptionRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.instrument_ids_.Clear();
   _impl_.instrument_id_.ClearToEmpty();
-  _impl_.action_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* SubscriptionRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const SubscriptionRequest& this_ = static_cast<const SubscriptionRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* SubscriptionRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const SubscriptionRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:marketdata.SubscriptionRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // .marketdata.SubscriptionRequest.Action action = 1;
-          if (this_._internal_action() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteEnumToArray(
-                1, this_._internal_action(), target);
-          }
-
-          // string instrument_id = 2;
-          if (!this_._internal_instrument_id().empty()) {
-            const std::string& _s = this_._internal_instrument_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "marketdata.SubscriptionRequest.instrument_id");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:marketdata.SubscriptionRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t SubscriptionRequest::ByteSizeLong(const MessageLite& base) {
-          const SubscriptionRequest& this_ = static_cast<const SubscriptionRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t SubscriptionRequest::ByteSizeLong() const {
-          const SubscriptionRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:marketdata.SubscriptionRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string instrument_id = 2;
-            if (!this_._internal_instrument_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_instrument_id());
-            }
-            // .marketdata.SubscriptionRequest.Action action = 1;
-            if (this_._internal_action() != 0) {
-              total_size += 1 +
-                            ::_pbi::WireFormatLite::EnumSize(this_._internal_action());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void SubscriptionRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  ::memset(&_impl_.action_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.depth_) -
+      reinterpret_cast<char*>(&_impl_.action_)) + sizeof(_impl_.depth_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SubscriptionRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .marketdata.SubscriptionRequest.Action action = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_action(static_cast<::marketdata::SubscriptionRequest_Action>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string instrument_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_instrument_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "marketdata.SubscriptionRequest.instrument_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool conflate = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.conflate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 max_updates_per_second = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.max_updates_per_second_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 depth = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string instrument_ids = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_instrument_ids();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "marketdata.SubscriptionRequest.instrument_ids"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubscriptionRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:marketdata.SubscriptionRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .marketdata.SubscriptionRequest.Action action = 1;
+  if (this->_internal_action() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_action(), target);
+  }
+
+  // string instrument_id = 2;
+  if (!this->_internal_instrument_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_instrument_id().data(), static_cast<int>(this->_internal_instrument_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "marketdata.SubscriptionRequest.instrument_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_instrument_id(), target);
+  }
+
+  // bool conflate = 3;
+  if (this->_internal_conflate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_conflate(), target);
+  }
+
+  // uint32 max_updates_per_second = 4;
+  if (this->_internal_max_updates_per_second() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_max_updates_per_second(), target);
+  }
+
+  // uint32 depth = 5;
+  if (this->_internal_depth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_depth(), target);
+  }
+
+  // repeated string instrument_ids = 6;
+  for (int i = 0, n = this->_internal_instrument_ids_size(); i < n; i++) {
+    const auto& s = this->_internal_instrument_ids(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "marketdata.SubscriptionRequest.instrument_ids");
+    target = stream->WriteString(6, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:marketdata.SubscriptionRequest)
+  return target;
+}
+
+size_t SubscriptionRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:marketdata.SubscriptionRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string instrument_ids = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.instrument_ids_.size());
+  for (int i = 0, n = _impl_.instrument_ids_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.instrument_ids_.Get(i));
+  }
+
+  // string instrument_id = 2;
+  if (!this->_internal_instrument_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_instrument_id());
+  }
+
+  // .marketdata.SubscriptionRequest.Action action = 1;
+  if (this->_internal_action() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_action());
+  }
+
+  // bool conflate = 3;
+  if (this->_internal_conflate() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 max_updates_per_second = 4;
+  if (this->_internal_max_updates_per_second() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_updates_per_second());
+  }
+
+  // uint32 depth = 5;
+  if (this->_internal_depth() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_depth());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SubscriptionRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SubscriptionRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SubscriptionRequest::GetClassData() const { return &_class_data_; }
+
+
+void SubscriptionRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
   auto* const _this = static_cast<SubscriptionRequest*>(&to_msg);
   auto& from = static_cast<const SubscriptionRequest&>(from_msg);
   // @@protoc_insertion_point(class_specific_merge_from_start:marketdata.SubscriptionRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  _this->_impl_.instrument_ids_.MergeFrom(from._impl_.instrument_ids_);
   if (!from._internal_instrument_id().empty()) {
     _this->_internal_set_instrument_id(from._internal_instrument_id());
   }
   if (from._internal_action() != 0) {
-    _this->_impl_.action_ = from._impl_.action_;
+    _this->_internal_set_action(from._internal_action());
+  }
+  if (from._internal_conflate() != 0) {
+    _this->_internal_set_conflate(from._internal_conflate());
+  }
+  if (from._internal_max_updates_per_second() != 0) {
+    _this->_internal_set_max_updates_per_second(from._internal_max_updates_per_second());
   }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_depth() != 0) {
+    _this->_internal_set_depth(from._internal_depth());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SubscriptionRequest::CopyFrom(const SubscriptionRequest& from) {
@@ -544,34 +809,69 @@ void SubscriptionRequest::CopyFrom(const SubscriptionRequest& from) {
   MergeFrom(from);
 }
 
+bool SubscriptionRequest::IsInitialized() const {
+  return true;
+}
 
-void SubscriptionRequest::InternalSwap(SubscriptionRequest* PROTOBUF_RESTRICT other) {
+void SubscriptionRequest::InternalSwap(SubscriptionRequest* other) {
   using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.instrument_id_, &other->_impl_.instrument_id_, arena);
-  swap(_impl_.action_, other->_impl_.action_);
+  _impl_.instrument_ids_.InternalSwap(&other->_impl_.instrument_ids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.instrument_id_, lhs_arena,
+      &other->_impl_.instrument_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubscriptionRequest, _impl_.depth_)
+      + sizeof(SubscriptionRequest::_impl_.depth_)
+      - PROTOBUF_FIELD_OFFSET(SubscriptionRequest, _impl_.action_)>(
+          reinterpret_cast<char*>(&_impl_.action_),
+          reinterpret_cast<char*>(&other->_impl_.action_));
 }
 
-::google::protobuf::Metadata SubscriptionRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+::PROTOBUF_NAMESPACE_ID::Metadata SubscriptionRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_market_5fdata_2eproto_getter, &descriptor_table_market_5fdata_2eproto_once,
+      file_level_metadata_market_5fdata_2eproto[0]);
 }
+
 // ===================================================================
 
 class MarketDataUpdate::_Internal {
  public:
-  static constexpr ::int32_t kOneofCaseOffset =
-      PROTOBUF_FIELD_OFFSET(::marketdata::MarketDataUpdate, _impl_._oneof_case_);
+  static const ::marketdata::OrderBookSnapshot& snapshot(const MarketDataUpdate* msg);
+  static const ::marketdata::OrderBookIncrementalUpdate& incremental_update(const MarketDataUpdate* msg);
+  static const ::marketdata::SymbolDirectory& symbol_directory(const MarketDataUpdate* msg);
+  static const ::marketdata::MarketDataBatch& batch(const MarketDataUpdate* msg);
 };
 
+const ::marketdata::OrderBookSnapshot&
+MarketDataUpdate::_Internal::snapshot(const MarketDataUpdate* msg) {
+  return *msg->_impl_.update_type_.snapshot_;
+}
+const ::marketdata::OrderBookIncrementalUpdate&
+MarketDataUpdate::_Internal::incremental_update(const MarketDataUpdate* msg) {
+  return *msg->_impl_.update_type_.incremental_update_;
+}
+const ::marketdata::SymbolDirectory&
+MarketDataUpdate::_Internal::symbol_directory(const MarketDataUpdate* msg) {
+  return *msg->_impl_.update_type_.symbol_directory_;
+}
+const ::marketdata::MarketDataBatch&
+MarketDataUpdate::_Internal::batch(const MarketDataUpdate* msg) {
+  return *msg->_impl_.update_type_.batch_;
+}
 void MarketDataUpdate::set_allocated_snapshot(::marketdata::OrderBookSnapshot* snapshot) {
-  ::google::protobuf::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_update_type();
   if (snapshot) {
-    ::google::protobuf::Arena* submessage_arena = snapshot->GetArena();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(snapshot);
     if (message_arena != submessage_arena) {
-      snapshot = ::google::protobuf::internal::GetOwnedMessage(message_arena, snapshot, submessage_arena);
+      snapshot = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, snapshot, submessage_arena);
     }
     set_has_snapshot();
     _impl_.update_type_.snapshot_ = snapshot;
@@ -579,101 +879,150 @@ void MarketDataUpdate::set_allocated_snapshot(::marketdata::OrderBookSnapshot* s
   // @@protoc_insertion_point(field_set_allocated:marketdata.MarketDataUpdate.snapshot)
 }
 void MarketDataUpdate::set_allocated_incremental_update(::marketdata::OrderBookIncrementalUpdate* incremental_update) {
-  ::google::protobuf::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_update_type();
   if (incremental_update) {
-    ::google::protobuf::Arena* submessage_arena = incremental_update->GetArena();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(incremental_update);
     if (message_arena != submessage_arena) {
-      incremental_update = ::google::protobuf::internal::GetOwnedMessage(message_arena, incremental_update, submessage_arena);
+      incremental_update = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, incremental_update, submessage_arena);
     }
     set_has_incremental_update();
     _impl_.update_type_.incremental_update_ = incremental_update;
   }
   // @@protoc_insertion_point(field_set_allocated:marketdata.MarketDataUpdate.incremental_update)
 }
-MarketDataUpdate::MarketDataUpdate(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
+void MarketDataUpdate::set_allocated_symbol_directory(::marketdata::SymbolDirectory* symbol_directory) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_update_type();
+  if (symbol_directory) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(symbol_directory);
+    if (message_arena != submessage_arena) {
+      symbol_directory = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, symbol_directory, submessage_arena);
+    }
+    set_has_symbol_directory();
+    _impl_.update_type_.symbol_directory_ = symbol_directory;
+  }
+  // @@protoc_insertion_point(field_set_allocated:marketdata.MarketDataUpdate.symbol_directory)
+}
+void MarketDataUpdate::set_allocated_batch(::marketdata::MarketDataBatch* batch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_update_type();
+  if (batch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(batch);
+    if (message_arena != submessage_arena) {
+      batch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, batch, submessage_arena);
+    }
+    set_has_batch();
+    _impl_.update_type_.batch_ = batch;
+  }
+  // @@protoc_insertion_point(field_set_allocated:marketdata.MarketDataUpdate.batch)
+}
+MarketDataUpdate::MarketDataUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:marketdata.MarketDataUpdate)
 }
-inline PROTOBUF_NDEBUG_INLINE MarketDataUpdate::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::marketdata::MarketDataUpdate& from_msg)
-      : update_type_{},
-        _cached_size_{0},
-        _oneof_case_{from._oneof_case_[0]} {}
-
-MarketDataUpdate::MarketDataUpdate(
-    ::google::protobuf::Arena* arena,
-    const MarketDataUpdate& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  MarketDataUpdate* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  switch (update_type_case()) {
-    case UPDATE_TYPE_NOT_SET:
+MarketDataUpdate::MarketDataUpdate(const MarketDataUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MarketDataUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.update_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_update_type();
+  switch (from.update_type_case()) {
+    case kSnapshot: {
+      _this->_internal_mutable_snapshot()->::marketdata::OrderBookSnapshot::MergeFrom(
+          from._internal_snapshot());
+      break;
+    }
+    case kIncrementalUpdate: {
+      _this->_internal_mutable_incremental_update()->::marketdata::OrderBookIncrementalUpdate::MergeFrom(
+          from._internal_incremental_update());
+      break;
+    }
+    case kSymbolDirectory: {
+      _this->_internal_mutable_symbol_directory()->::marketdata::SymbolDirectory::MergeFrom(
+          from._internal_symbol_directory());
+      break;
+    }
+    case kBatch: {
+      _this->_internal_mutable_batch()->::marketdata::MarketDataBatch::MergeFrom(
+          from._internal_batch());
+      break;
+    }
+    case UPDATE_TYPE_NOT_SET: {
       break;
-      case kSnapshot:
-        _impl_.update_type_.snapshot_ = ::google::protobuf::Message::CopyConstruct<::marketdata::OrderBookSnapshot>(arena, *from._impl_.update_type_.snapshot_);
-        break;
-      case kIncrementalUpdate:
-        _impl_.update_type_.incremental_update_ = ::google::protobuf::Message::CopyConstruct<::marketdata::OrderBookIncrementalUpdate>(arena, *from._impl_.update_type_.incremental_update_);
-        break;
+    }
   }
-
   // @@protoc_insertion_point(copy_constructor:marketdata.MarketDataUpdate)
 }
-inline PROTOBUF_NDEBUG_INLINE MarketDataUpdate::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : update_type_{},
-        _cached_size_{0},
-        _oneof_case_{} {}
 
-inline void MarketDataUpdate::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
+inline void MarketDataUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.update_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_update_type();
 }
+
 MarketDataUpdate::~MarketDataUpdate() {
   // @@protoc_insertion_point(destructor:marketdata.MarketDataUpdate)
-  SharedDtor(*this);
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-inline void MarketDataUpdate::SharedDtor(MessageLite& self) {
-  MarketDataUpdate& this_ = static_cast<MarketDataUpdate&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  if (this_.has_update_type()) {
-    this_.clear_update_type();
+
+inline void MarketDataUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_update_type()) {
+    clear_update_type();
   }
-  this_._impl_.~Impl_();
+}
+
+void MarketDataUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void MarketDataUpdate::clear_update_type() {
 // @@protoc_insertion_point(one_of_clear_start:marketdata.MarketDataUpdate)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
   switch (update_type_case()) {
     case kSnapshot: {
-      if (GetArena() == nullptr) {
+      if (GetArenaForAllocation() == nullptr) {
         delete _impl_.update_type_.snapshot_;
-      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.update_type_.snapshot_);
       }
       break;
     }
     case kIncrementalUpdate: {
-      if (GetArena() == nullptr) {
+      if (GetArenaForAllocation() == nullptr) {
         delete _impl_.update_type_.incremental_update_;
-      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.update_type_.incremental_update_);
+      }
+      break;
+    }
+    case kSymbolDirectory: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.update_type_.symbol_directory_;
+      }
+      break;
+    }
+    case kBatch: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.update_type_.batch_;
       }
       break;
     }
@@ -685,206 +1034,204 @@ void MarketDataUpdate::clear_update_type() {
 }
 
 
-inline void* MarketDataUpdate::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) MarketDataUpdate(arena);
-}
-constexpr auto MarketDataUpdate::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(MarketDataUpdate),
-                                            alignof(MarketDataUpdate));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull MarketDataUpdate::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_MarketDataUpdate_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &MarketDataUpdate::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<MarketDataUpdate>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &MarketDataUpdate::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<MarketDataUpdate>(), &MarketDataUpdate::ByteSizeLong,
-            &MarketDataUpdate::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(MarketDataUpdate, _impl_._cached_size_),
-        false,
-    },
-    &MarketDataUpdate::kDescriptorMethods,
-    &descriptor_table_market_5fdata_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* MarketDataUpdate::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
+void MarketDataUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:marketdata.MarketDataUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_update_type();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 2, 2, 0, 2> MarketDataUpdate::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::marketdata::MarketDataUpdate>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
+
+const char* MarketDataUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .marketdata.OrderBookSnapshot snapshot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_snapshot(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .marketdata.OrderBookIncrementalUpdate incremental_update = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_incremental_update(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .marketdata.SymbolDirectory symbol_directory = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_symbol_directory(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .marketdata.MarketDataBatch batch = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_batch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MarketDataUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:marketdata.MarketDataUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .marketdata.OrderBookSnapshot snapshot = 1;
+  if (_internal_has_snapshot()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::snapshot(this),
+        _Internal::snapshot(this).GetCachedSize(), target, stream);
+  }
+
+  // .marketdata.OrderBookIncrementalUpdate incremental_update = 2;
+  if (_internal_has_incremental_update()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::incremental_update(this),
+        _Internal::incremental_update(this).GetCachedSize(), target, stream);
+  }
+
+  // .marketdata.SymbolDirectory symbol_directory = 3;
+  if (_internal_has_symbol_directory()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::symbol_directory(this),
+        _Internal::symbol_directory(this).GetCachedSize(), target, stream);
+  }
+
+  // .marketdata.MarketDataBatch batch = 4;
+  if (_internal_has_batch()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::batch(this),
+        _Internal::batch(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:marketdata.MarketDataUpdate)
+  return target;
+}
+
+size_t MarketDataUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:marketdata.MarketDataUpdate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (update_type_case()) {
     // .marketdata.OrderBookSnapshot snapshot = 1;
-    {PROTOBUF_FIELD_OFFSET(MarketDataUpdate, _impl_.update_type_.snapshot_), _Internal::kOneofCaseOffset + 0, 0,
-    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    case kSnapshot: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.update_type_.snapshot_);
+      break;
+    }
     // .marketdata.OrderBookIncrementalUpdate incremental_update = 2;
-    {PROTOBUF_FIELD_OFFSET(MarketDataUpdate, _impl_.update_type_.incremental_update_), _Internal::kOneofCaseOffset + 0, 1,
-    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::marketdata::OrderBookSnapshot>()},
-    {::_pbi::TcParser::GetTable<::marketdata::OrderBookIncrementalUpdate>()},
-  }}, {{
-  }},
+    case kIncrementalUpdate: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.update_type_.incremental_update_);
+      break;
+    }
+    // .marketdata.SymbolDirectory symbol_directory = 3;
+    case kSymbolDirectory: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.update_type_.symbol_directory_);
+      break;
+    }
+    // .marketdata.MarketDataBatch batch = 4;
+    case kBatch: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.update_type_.batch_);
+      break;
+    }
+    case UPDATE_TYPE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MarketDataUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MarketDataUpdate::MergeImpl
 };
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MarketDataUpdate::GetClassData() const { return &_class_data_; }
 
-PROTOBUF_NOINLINE void MarketDataUpdate::Clear() {
-// @@protoc_insertion_point(message_clear_start:marketdata.MarketDataUpdate)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
 
-  clear_update_type();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* MarketDataUpdate::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const MarketDataUpdate& this_ = static_cast<const MarketDataUpdate&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* MarketDataUpdate::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const MarketDataUpdate& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:marketdata.MarketDataUpdate)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          switch (this_.update_type_case()) {
-            case kSnapshot: {
-              target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                  1, *this_._impl_.update_type_.snapshot_, this_._impl_.update_type_.snapshot_->GetCachedSize(), target,
-                  stream);
-              break;
-            }
-            case kIncrementalUpdate: {
-              target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                  2, *this_._impl_.update_type_.incremental_update_, this_._impl_.update_type_.incremental_update_->GetCachedSize(), target,
-                  stream);
-              break;
-            }
-            default:
-              break;
-          }
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:marketdata.MarketDataUpdate)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t MarketDataUpdate::ByteSizeLong(const MessageLite& base) {
-          const MarketDataUpdate& this_ = static_cast<const MarketDataUpdate&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t MarketDataUpdate::ByteSizeLong() const {
-          const MarketDataUpdate& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:marketdata.MarketDataUpdate)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          switch (this_.update_type_case()) {
-            // .marketdata.OrderBookSnapshot snapshot = 1;
-            case kSnapshot: {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.update_type_.snapshot_);
-              break;
-            }
-            // .marketdata.OrderBookIncrementalUpdate incremental_update = 2;
-            case kIncrementalUpdate: {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.update_type_.incremental_update_);
-              break;
-            }
-            case UPDATE_TYPE_NOT_SET: {
-              break;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void MarketDataUpdate::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+void MarketDataUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
   auto* const _this = static_cast<MarketDataUpdate*>(&to_msg);
   auto& from = static_cast<const MarketDataUpdate&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
   // @@protoc_insertion_point(class_specific_merge_from_start:marketdata.MarketDataUpdate)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (const uint32_t oneof_from_case = from._impl_._oneof_case_[0]) {
-    const uint32_t oneof_to_case = _this->_impl_._oneof_case_[0];
-    const bool oneof_needs_init = oneof_to_case != oneof_from_case;
-    if (oneof_needs_init) {
-      if (oneof_to_case != 0) {
-        _this->clear_update_type();
-      }
-      _this->_impl_._oneof_case_[0] = oneof_from_case;
+  switch (from.update_type_case()) {
+    case kSnapshot: {
+      _this->_internal_mutable_snapshot()->::marketdata::OrderBookSnapshot::MergeFrom(
+          from._internal_snapshot());
+      break;
     }
-
-    switch (oneof_from_case) {
-      case kSnapshot: {
-        if (oneof_needs_init) {
-          _this->_impl_.update_type_.snapshot_ =
-              ::google::protobuf::Message::CopyConstruct<::marketdata::OrderBookSnapshot>(arena, *from._impl_.update_type_.snapshot_);
-        } else {
-          _this->_impl_.update_type_.snapshot_->MergeFrom(from._internal_snapshot());
-        }
-        break;
-      }
-      case kIncrementalUpdate: {
-        if (oneof_needs_init) {
-          _this->_impl_.update_type_.incremental_update_ =
-              ::google::protobuf::Message::CopyConstruct<::marketdata::OrderBookIncrementalUpdate>(arena, *from._impl_.update_type_.incremental_update_);
-        } else {
-          _this->_impl_.update_type_.incremental_update_->MergeFrom(from._internal_incremental_update());
-        }
-        break;
-      }
-      case UPDATE_TYPE_NOT_SET:
-        break;
+    case kIncrementalUpdate: {
+      _this->_internal_mutable_incremental_update()->::marketdata::OrderBookIncrementalUpdate::MergeFrom(
+          from._internal_incremental_update());
+      break;
+    }
+    case kSymbolDirectory: {
+      _this->_internal_mutable_symbol_directory()->::marketdata::SymbolDirectory::MergeFrom(
+          from._internal_symbol_directory());
+      break;
+    }
+    case kBatch: {
+      _this->_internal_mutable_batch()->::marketdata::MarketDataBatch::MergeFrom(
+          from._internal_batch());
+      break;
+    }
+    case UPDATE_TYPE_NOT_SET: {
+      break;
     }
   }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MarketDataUpdate::CopyFrom(const MarketDataUpdate& from) {
@@ -894,307 +1241,965 @@ void MarketDataUpdate::CopyFrom(const MarketDataUpdate& from) {
   MergeFrom(from);
 }
 
+bool MarketDataUpdate::IsInitialized() const {
+  return true;
+}
 
-void MarketDataUpdate::InternalSwap(MarketDataUpdate* PROTOBUF_RESTRICT other) {
+void MarketDataUpdate::InternalSwap(MarketDataUpdate* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_.update_type_, other->_impl_.update_type_);
   swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
-::google::protobuf::Metadata MarketDataUpdate::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+::PROTOBUF_NAMESPACE_ID::Metadata MarketDataUpdate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_market_5fdata_2eproto_getter, &descriptor_table_market_5fdata_2eproto_once,
+      file_level_metadata_market_5fdata_2eproto[1]);
 }
+
 // ===================================================================
 
-class OrderBookSnapshot::_Internal {
+class MarketDataBatch::_Internal {
  public:
 };
 
-OrderBookSnapshot::OrderBookSnapshot(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:marketdata.OrderBookSnapshot)
+MarketDataBatch::MarketDataBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:marketdata.MarketDataBatch)
 }
-inline PROTOBUF_NDEBUG_INLINE OrderBookSnapshot::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::marketdata::OrderBookSnapshot& from_msg)
-      : bids_{visibility, arena, from.bids_},
-        asks_{visibility, arena, from.asks_},
-        instrument_id_(arena, from.instrument_id_),
-        _cached_size_{0} {}
-
-OrderBookSnapshot::OrderBookSnapshot(
-    ::google::protobuf::Arena* arena,
-    const OrderBookSnapshot& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  OrderBookSnapshot* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+MarketDataBatch::MarketDataBatch(const MarketDataBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MarketDataBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.updates_){from._impl_.updates_}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-  // @@protoc_insertion_point(copy_constructor:marketdata.OrderBookSnapshot)
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:marketdata.MarketDataBatch)
 }
-inline PROTOBUF_NDEBUG_INLINE OrderBookSnapshot::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : bids_{visibility, arena},
-        asks_{visibility, arena},
-        instrument_id_(arena),
-        _cached_size_{0} {}
 
-inline void OrderBookSnapshot::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
+inline void MarketDataBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.updates_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
-OrderBookSnapshot::~OrderBookSnapshot() {
-  // @@protoc_insertion_point(destructor:marketdata.OrderBookSnapshot)
-  SharedDtor(*this);
-}
-inline void OrderBookSnapshot::SharedDtor(MessageLite& self) {
-  OrderBookSnapshot& this_ = static_cast<OrderBookSnapshot&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.instrument_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* OrderBookSnapshot::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) OrderBookSnapshot(arena);
-}
-constexpr auto OrderBookSnapshot::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(OrderBookSnapshot, _impl_.bids_) +
-          decltype(OrderBookSnapshot::_impl_.bids_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-      PROTOBUF_FIELD_OFFSET(OrderBookSnapshot, _impl_.asks_) +
-          decltype(OrderBookSnapshot::_impl_.asks_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::CopyInit(
-        sizeof(OrderBookSnapshot), alignof(OrderBookSnapshot), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&OrderBookSnapshot::PlacementNew_,
-                                 sizeof(OrderBookSnapshot),
-                                 alignof(OrderBookSnapshot));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull OrderBookSnapshot::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_OrderBookSnapshot_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &OrderBookSnapshot::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<OrderBookSnapshot>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &OrderBookSnapshot::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<OrderBookSnapshot>(), &OrderBookSnapshot::ByteSizeLong,
-            &OrderBookSnapshot::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(OrderBookSnapshot, _impl_._cached_size_),
-        false,
-    },
-    &OrderBookSnapshot::kDescriptorMethods,
-    &descriptor_table_market_5fdata_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* OrderBookSnapshot::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
+
+MarketDataBatch::~MarketDataBatch() {
+  // @@protoc_insertion_point(destructor:marketdata.MarketDataBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 2, 50, 2> OrderBookSnapshot::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::marketdata::OrderBookSnapshot>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string instrument_id = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(OrderBookSnapshot, _impl_.instrument_id_)}},
-    // repeated .marketdata.PriceLevel bids = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(OrderBookSnapshot, _impl_.bids_)}},
-    // repeated .marketdata.PriceLevel asks = 3;
-    {::_pbi::TcParser::FastMtR1,
-     {26, 63, 1, PROTOBUF_FIELD_OFFSET(OrderBookSnapshot, _impl_.asks_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string instrument_id = 1;
-    {PROTOBUF_FIELD_OFFSET(OrderBookSnapshot, _impl_.instrument_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // repeated .marketdata.PriceLevel bids = 2;
-    {PROTOBUF_FIELD_OFFSET(OrderBookSnapshot, _impl_.bids_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-    // repeated .marketdata.PriceLevel asks = 3;
-    {PROTOBUF_FIELD_OFFSET(OrderBookSnapshot, _impl_.asks_), 0, 1,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::marketdata::PriceLevel>()},
-    {::_pbi::TcParser::GetTable<::marketdata::PriceLevel>()},
-  }}, {{
-    "\34\15\0\0\0\0\0\0"
-    "marketdata.OrderBookSnapshot"
-    "instrument_id"
-  }},
-};
 
-PROTOBUF_NOINLINE void OrderBookSnapshot::Clear() {
-// @@protoc_insertion_point(message_clear_start:marketdata.OrderBookSnapshot)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
+inline void MarketDataBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.updates_.~RepeatedPtrField();
+}
+
+void MarketDataBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MarketDataBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:marketdata.MarketDataBatch)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.bids_.Clear();
-  _impl_.asks_.Clear();
-  _impl_.instrument_id_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* OrderBookSnapshot::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const OrderBookSnapshot& this_ = static_cast<const OrderBookSnapshot&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* OrderBookSnapshot::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const OrderBookSnapshot& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:marketdata.OrderBookSnapshot)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string instrument_id = 1;
-          if (!this_._internal_instrument_id().empty()) {
-            const std::string& _s = this_._internal_instrument_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "marketdata.OrderBookSnapshot.instrument_id");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // repeated .marketdata.PriceLevel bids = 2;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_bids_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_bids().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    2, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          // repeated .marketdata.PriceLevel asks = 3;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_asks_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_asks().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    3, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:marketdata.OrderBookSnapshot)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t OrderBookSnapshot::ByteSizeLong(const MessageLite& base) {
-          const OrderBookSnapshot& this_ = static_cast<const OrderBookSnapshot&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t OrderBookSnapshot::ByteSizeLong() const {
-          const OrderBookSnapshot& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:marketdata.OrderBookSnapshot)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .marketdata.PriceLevel bids = 2;
-            {
-              total_size += 1UL * this_._internal_bids_size();
-              for (const auto& msg : this_._internal_bids()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-            // repeated .marketdata.PriceLevel asks = 3;
-            {
-              total_size += 1UL * this_._internal_asks_size();
-              for (const auto& msg : this_._internal_asks()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // string instrument_id = 1;
-            if (!this_._internal_instrument_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_instrument_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void OrderBookSnapshot::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<OrderBookSnapshot*>(&to_msg);
-  auto& from = static_cast<const OrderBookSnapshot&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:marketdata.OrderBookSnapshot)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  _impl_.updates_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MarketDataBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .marketdata.MarketDataUpdate updates = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_updates(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MarketDataBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:marketdata.MarketDataBatch)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_internal_mutable_bids()->MergeFrom(
-      from._internal_bids());
-  _this->_internal_mutable_asks()->MergeFrom(
-      from._internal_asks());
-  if (!from._internal_instrument_id().empty()) {
-    _this->_internal_set_instrument_id(from._internal_instrument_id());
+  // repeated .marketdata.MarketDataUpdate updates = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_updates_size()); i < n; i++) {
+    const auto& repfield = this->_internal_updates(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:marketdata.MarketDataBatch)
+  return target;
+}
+
+size_t MarketDataBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:marketdata.MarketDataBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .marketdata.MarketDataUpdate updates = 1;
+  total_size += 1UL * this->_internal_updates_size();
+  for (const auto& msg : this->_impl_.updates_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MarketDataBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MarketDataBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MarketDataBatch::GetClassData() const { return &_class_data_; }
+
+
+void MarketDataBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MarketDataBatch*>(&to_msg);
+  auto& from = static_cast<const MarketDataBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:marketdata.MarketDataBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.updates_.MergeFrom(from._impl_.updates_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MarketDataBatch::CopyFrom(const MarketDataBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:marketdata.MarketDataBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MarketDataBatch::IsInitialized() const {
+  return true;
+}
+
+void MarketDataBatch::InternalSwap(MarketDataBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.updates_.InternalSwap(&other->_impl_.updates_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MarketDataBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_market_5fdata_2eproto_getter, &descriptor_table_market_5fdata_2eproto_once,
+      file_level_metadata_market_5fdata_2eproto[2]);
+}
+
+// ===================================================================
+
+class SymbolDirectory_Entry::_Internal {
+ public:
+};
+
+SymbolDirectory_Entry::SymbolDirectory_Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:marketdata.SymbolDirectory.Entry)
+}
+SymbolDirectory_Entry::SymbolDirectory_Entry(const SymbolDirectory_Entry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SymbolDirectory_Entry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.instrument_id_){}
+    , decltype(_impl_.instrument_handle_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.instrument_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_instrument_id().empty()) {
+    _this->_impl_.instrument_id_.Set(from._internal_instrument_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.instrument_handle_ = from._impl_.instrument_handle_;
+  // @@protoc_insertion_point(copy_constructor:marketdata.SymbolDirectory.Entry)
+}
+
+inline void SymbolDirectory_Entry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.instrument_id_){}
+    , decltype(_impl_.instrument_handle_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.instrument_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SymbolDirectory_Entry::~SymbolDirectory_Entry() {
+  // @@protoc_insertion_point(destructor:marketdata.SymbolDirectory.Entry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SymbolDirectory_Entry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.instrument_id_.Destroy();
+}
+
+void SymbolDirectory_Entry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SymbolDirectory_Entry::Clear() {
+// @@protoc_insertion_point(message_clear_start:marketdata.SymbolDirectory.Entry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.instrument_id_.ClearToEmpty();
+  _impl_.instrument_handle_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SymbolDirectory_Entry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string instrument_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_instrument_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "marketdata.SymbolDirectory.Entry.instrument_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 instrument_handle = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.instrument_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SymbolDirectory_Entry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:marketdata.SymbolDirectory.Entry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string instrument_id = 1;
+  if (!this->_internal_instrument_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_instrument_id().data(), static_cast<int>(this->_internal_instrument_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "marketdata.SymbolDirectory.Entry.instrument_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_instrument_id(), target);
+  }
+
+  // uint32 instrument_handle = 2;
+  if (this->_internal_instrument_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_instrument_handle(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:marketdata.SymbolDirectory.Entry)
+  return target;
+}
+
+size_t SymbolDirectory_Entry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:marketdata.SymbolDirectory.Entry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string instrument_id = 1;
+  if (!this->_internal_instrument_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_instrument_id());
+  }
+
+  // uint32 instrument_handle = 2;
+  if (this->_internal_instrument_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_instrument_handle());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SymbolDirectory_Entry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SymbolDirectory_Entry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SymbolDirectory_Entry::GetClassData() const { return &_class_data_; }
+
+
+void SymbolDirectory_Entry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SymbolDirectory_Entry*>(&to_msg);
+  auto& from = static_cast<const SymbolDirectory_Entry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:marketdata.SymbolDirectory.Entry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_instrument_id().empty()) {
+    _this->_internal_set_instrument_id(from._internal_instrument_id());
+  }
+  if (from._internal_instrument_handle() != 0) {
+    _this->_internal_set_instrument_handle(from._internal_instrument_handle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SymbolDirectory_Entry::CopyFrom(const SymbolDirectory_Entry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:marketdata.SymbolDirectory.Entry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SymbolDirectory_Entry::IsInitialized() const {
+  return true;
+}
+
+void SymbolDirectory_Entry::InternalSwap(SymbolDirectory_Entry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.instrument_id_, lhs_arena,
+      &other->_impl_.instrument_id_, rhs_arena
+  );
+  swap(_impl_.instrument_handle_, other->_impl_.instrument_handle_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SymbolDirectory_Entry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_market_5fdata_2eproto_getter, &descriptor_table_market_5fdata_2eproto_once,
+      file_level_metadata_market_5fdata_2eproto[3]);
+}
+
+// ===================================================================
+
+class SymbolDirectory::_Internal {
+ public:
+};
+
+SymbolDirectory::SymbolDirectory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:marketdata.SymbolDirectory)
+}
+SymbolDirectory::SymbolDirectory(const SymbolDirectory& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SymbolDirectory* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:marketdata.SymbolDirectory)
+}
+
+inline void SymbolDirectory::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SymbolDirectory::~SymbolDirectory() {
+  // @@protoc_insertion_point(destructor:marketdata.SymbolDirectory)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SymbolDirectory::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void SymbolDirectory::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SymbolDirectory::Clear() {
+// @@protoc_insertion_point(message_clear_start:marketdata.SymbolDirectory)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SymbolDirectory::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .marketdata.SymbolDirectory.Entry entries = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SymbolDirectory::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:marketdata.SymbolDirectory)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .marketdata.SymbolDirectory.Entry entries = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:marketdata.SymbolDirectory)
+  return target;
+}
+
+size_t SymbolDirectory::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:marketdata.SymbolDirectory)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .marketdata.SymbolDirectory.Entry entries = 1;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SymbolDirectory::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SymbolDirectory::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SymbolDirectory::GetClassData() const { return &_class_data_; }
+
+
+void SymbolDirectory::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SymbolDirectory*>(&to_msg);
+  auto& from = static_cast<const SymbolDirectory&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:marketdata.SymbolDirectory)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SymbolDirectory::CopyFrom(const SymbolDirectory& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:marketdata.SymbolDirectory)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SymbolDirectory::IsInitialized() const {
+  return true;
+}
+
+void SymbolDirectory::InternalSwap(SymbolDirectory* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SymbolDirectory::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_market_5fdata_2eproto_getter, &descriptor_table_market_5fdata_2eproto_once,
+      file_level_metadata_market_5fdata_2eproto[4]);
+}
+
+// ===================================================================
+
+class OrderBookSnapshot::_Internal {
+ public:
+};
+
+OrderBookSnapshot::OrderBookSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:marketdata.OrderBookSnapshot)
+}
+OrderBookSnapshot::OrderBookSnapshot(const OrderBookSnapshot& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OrderBookSnapshot* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bids_){from._impl_.bids_}
+    , decltype(_impl_.asks_){from._impl_.asks_}
+    , decltype(_impl_.instrument_id_){}
+    , decltype(_impl_.tick_size_){}
+    , decltype(_impl_.lot_size_){}
+    , decltype(_impl_.sequence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.instrument_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_instrument_id().empty()) {
+    _this->_impl_.instrument_id_.Set(from._internal_instrument_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.tick_size_, &from._impl_.tick_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sequence_) -
+    reinterpret_cast<char*>(&_impl_.tick_size_)) + sizeof(_impl_.sequence_));
+  // @@protoc_insertion_point(copy_constructor:marketdata.OrderBookSnapshot)
+}
+
+inline void OrderBookSnapshot::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bids_){arena}
+    , decltype(_impl_.asks_){arena}
+    , decltype(_impl_.instrument_id_){}
+    , decltype(_impl_.tick_size_){0}
+    , decltype(_impl_.lot_size_){0}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.instrument_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+OrderBookSnapshot::~OrderBookSnapshot() {
+  // @@protoc_insertion_point(destructor:marketdata.OrderBookSnapshot)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OrderBookSnapshot::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bids_.~RepeatedPtrField();
+  _impl_.asks_.~RepeatedPtrField();
+  _impl_.instrument_id_.Destroy();
+}
+
+void OrderBookSnapshot::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OrderBookSnapshot::Clear() {
+// @@protoc_insertion_point(message_clear_start:marketdata.OrderBookSnapshot)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bids_.Clear();
+  _impl_.asks_.Clear();
+  _impl_.instrument_id_.ClearToEmpty();
+  ::memset(&_impl_.tick_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.sequence_) -
+      reinterpret_cast<char*>(&_impl_.tick_size_)) + sizeof(_impl_.sequence_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OrderBookSnapshot::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string instrument_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_instrument_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "marketdata.OrderBookSnapshot.instrument_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .marketdata.PriceLevel bids = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_bids(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .marketdata.PriceLevel asks = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_asks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // double tick_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.tick_size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double lot_size = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.lot_size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sequence = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OrderBookSnapshot::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:marketdata.OrderBookSnapshot)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string instrument_id = 1;
+  if (!this->_internal_instrument_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_instrument_id().data(), static_cast<int>(this->_internal_instrument_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "marketdata.OrderBookSnapshot.instrument_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_instrument_id(), target);
+  }
+
+  // repeated .marketdata.PriceLevel bids = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_bids_size()); i < n; i++) {
+    const auto& repfield = this->_internal_bids(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .marketdata.PriceLevel asks = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_asks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_asks(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // double tick_size = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_tick_size = this->_internal_tick_size();
+  uint64_t raw_tick_size;
+  memcpy(&raw_tick_size, &tmp_tick_size, sizeof(tmp_tick_size));
+  if (raw_tick_size != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_tick_size(), target);
+  }
+
+  // double lot_size = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lot_size = this->_internal_lot_size();
+  uint64_t raw_lot_size;
+  memcpy(&raw_lot_size, &tmp_lot_size, sizeof(tmp_lot_size));
+  if (raw_lot_size != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_lot_size(), target);
+  }
+
+  // uint64 sequence = 6;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_sequence(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:marketdata.OrderBookSnapshot)
+  return target;
+}
+
+size_t OrderBookSnapshot::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:marketdata.OrderBookSnapshot)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .marketdata.PriceLevel bids = 2;
+  total_size += 1UL * this->_internal_bids_size();
+  for (const auto& msg : this->_impl_.bids_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .marketdata.PriceLevel asks = 3;
+  total_size += 1UL * this->_internal_asks_size();
+  for (const auto& msg : this->_impl_.asks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string instrument_id = 1;
+  if (!this->_internal_instrument_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_instrument_id());
+  }
+
+  // double tick_size = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_tick_size = this->_internal_tick_size();
+  uint64_t raw_tick_size;
+  memcpy(&raw_tick_size, &tmp_tick_size, sizeof(tmp_tick_size));
+  if (raw_tick_size != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double lot_size = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lot_size = this->_internal_lot_size();
+  uint64_t raw_lot_size;
+  memcpy(&raw_lot_size, &tmp_lot_size, sizeof(tmp_lot_size));
+  if (raw_lot_size != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 sequence = 6;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OrderBookSnapshot::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OrderBookSnapshot::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OrderBookSnapshot::GetClassData() const { return &_class_data_; }
+
+
+void OrderBookSnapshot::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OrderBookSnapshot*>(&to_msg);
+  auto& from = static_cast<const OrderBookSnapshot&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:marketdata.OrderBookSnapshot)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bids_.MergeFrom(from._impl_.bids_);
+  _this->_impl_.asks_.MergeFrom(from._impl_.asks_);
+  if (!from._internal_instrument_id().empty()) {
+    _this->_internal_set_instrument_id(from._internal_instrument_id());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_tick_size = from._internal_tick_size();
+  uint64_t raw_tick_size;
+  memcpy(&raw_tick_size, &tmp_tick_size, sizeof(tmp_tick_size));
+  if (raw_tick_size != 0) {
+    _this->_internal_set_tick_size(from._internal_tick_size());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lot_size = from._internal_lot_size();
+  uint64_t raw_lot_size;
+  memcpy(&raw_lot_size, &tmp_lot_size, sizeof(tmp_lot_size));
+  if (raw_lot_size != 0) {
+    _this->_internal_set_lot_size(from._internal_lot_size());
+  }
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
 void OrderBookSnapshot::CopyFrom(const OrderBookSnapshot& from) {
 // @@protoc_insertion_point(class_specific_copy_from_start:marketdata.OrderBookSnapshot)
@@ -1203,580 +2208,2003 @@ void OrderBookSnapshot::CopyFrom(const OrderBookSnapshot& from) {
   MergeFrom(from);
 }
 
+bool OrderBookSnapshot::IsInitialized() const {
+  return true;
+}
+
+void OrderBookSnapshot::InternalSwap(OrderBookSnapshot* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.bids_.InternalSwap(&other->_impl_.bids_);
+  _impl_.asks_.InternalSwap(&other->_impl_.asks_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.instrument_id_, lhs_arena,
+      &other->_impl_.instrument_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OrderBookSnapshot, _impl_.sequence_)
+      + sizeof(OrderBookSnapshot::_impl_.sequence_)
+      - PROTOBUF_FIELD_OFFSET(OrderBookSnapshot, _impl_.tick_size_)>(
+          reinterpret_cast<char*>(&_impl_.tick_size_),
+          reinterpret_cast<char*>(&other->_impl_.tick_size_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OrderBookSnapshot::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_market_5fdata_2eproto_getter, &descriptor_table_market_5fdata_2eproto_once,
+      file_level_metadata_market_5fdata_2eproto[5]);
+}
+
+// ===================================================================
+
+class OrderBookIncrementalUpdate::_Internal {
+ public:
+};
+
+OrderBookIncrementalUpdate::OrderBookIncrementalUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:marketdata.OrderBookIncrementalUpdate)
+}
+OrderBookIncrementalUpdate::OrderBookIncrementalUpdate(const OrderBookIncrementalUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OrderBookIncrementalUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bid_updates_){from._impl_.bid_updates_}
+    , decltype(_impl_.ask_updates_){from._impl_.ask_updates_}
+    , decltype(_impl_.price_deltas_){from._impl_.price_deltas_}
+    , /*decltype(_impl_._price_deltas_cached_byte_size_)*/{0}
+    , decltype(_impl_.quantity_lots_){from._impl_.quantity_lots_}
+    , /*decltype(_impl_._quantity_lots_cached_byte_size_)*/{0}
+    , decltype(_impl_.instrument_id_){}
+    , decltype(_impl_.sequence_){}
+    , decltype(_impl_.first_sequence_){}
+    , decltype(_impl_.publish_timestamp_ns_){}
+    , decltype(_impl_.instrument_handle_){}
+    , decltype(_impl_.bid_count_){}
+    , decltype(_impl_.base_price_ticks_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.instrument_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_instrument_id().empty()) {
+    _this->_impl_.instrument_id_.Set(from._internal_instrument_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.sequence_, &from._impl_.sequence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.base_price_ticks_) -
+    reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.base_price_ticks_));
+  // @@protoc_insertion_point(copy_constructor:marketdata.OrderBookIncrementalUpdate)
+}
+
+inline void OrderBookIncrementalUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bid_updates_){arena}
+    , decltype(_impl_.ask_updates_){arena}
+    , decltype(_impl_.price_deltas_){arena}
+    , /*decltype(_impl_._price_deltas_cached_byte_size_)*/{0}
+    , decltype(_impl_.quantity_lots_){arena}
+    , /*decltype(_impl_._quantity_lots_cached_byte_size_)*/{0}
+    , decltype(_impl_.instrument_id_){}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , decltype(_impl_.first_sequence_){uint64_t{0u}}
+    , decltype(_impl_.publish_timestamp_ns_){uint64_t{0u}}
+    , decltype(_impl_.instrument_handle_){0u}
+    , decltype(_impl_.bid_count_){0u}
+    , decltype(_impl_.base_price_ticks_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.instrument_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+OrderBookIncrementalUpdate::~OrderBookIncrementalUpdate() {
+  // @@protoc_insertion_point(destructor:marketdata.OrderBookIncrementalUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OrderBookIncrementalUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bid_updates_.~RepeatedPtrField();
+  _impl_.ask_updates_.~RepeatedPtrField();
+  _impl_.price_deltas_.~RepeatedField();
+  _impl_.quantity_lots_.~RepeatedField();
+  _impl_.instrument_id_.Destroy();
+}
+
+void OrderBookIncrementalUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OrderBookIncrementalUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:marketdata.OrderBookIncrementalUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bid_updates_.Clear();
+  _impl_.ask_updates_.Clear();
+  _impl_.price_deltas_.Clear();
+  _impl_.quantity_lots_.Clear();
+  _impl_.instrument_id_.ClearToEmpty();
+  ::memset(&_impl_.sequence_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.base_price_ticks_) -
+      reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.base_price_ticks_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OrderBookIncrementalUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string instrument_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_instrument_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "marketdata.OrderBookIncrementalUpdate.instrument_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .marketdata.PriceLevel bid_updates = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_bid_updates(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .marketdata.PriceLevel ask_updates = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ask_updates(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 instrument_handle = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.instrument_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sequence = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 first_sequence = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.first_sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // fixed64 publish_timestamp_ns = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.publish_timestamp_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint64 base_price_ticks = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.base_price_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 price_deltas = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_price_deltas(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 72) {
+          _internal_add_price_deltas(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 quantity_lots = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_quantity_lots(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 80) {
+          _internal_add_quantity_lots(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 bid_count = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.bid_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OrderBookIncrementalUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:marketdata.OrderBookIncrementalUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string instrument_id = 1;
+  if (!this->_internal_instrument_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_instrument_id().data(), static_cast<int>(this->_internal_instrument_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "marketdata.OrderBookIncrementalUpdate.instrument_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_instrument_id(), target);
+  }
+
+  // repeated .marketdata.PriceLevel bid_updates = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_bid_updates_size()); i < n; i++) {
+    const auto& repfield = this->_internal_bid_updates(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .marketdata.PriceLevel ask_updates = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ask_updates_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ask_updates(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint32 instrument_handle = 4;
+  if (this->_internal_instrument_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_instrument_handle(), target);
+  }
+
+  // uint64 sequence = 5;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_sequence(), target);
+  }
+
+  // uint64 first_sequence = 6;
+  if (this->_internal_first_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_first_sequence(), target);
+  }
+
+  // fixed64 publish_timestamp_ns = 7;
+  if (this->_internal_publish_timestamp_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(7, this->_internal_publish_timestamp_ns(), target);
+  }
+
+  // sint64 base_price_ticks = 8;
+  if (this->_internal_base_price_ticks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt64ToArray(8, this->_internal_base_price_ticks(), target);
+  }
+
+  // repeated sint32 price_deltas = 9;
+  {
+    int byte_size = _impl_._price_deltas_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          9, _internal_price_deltas(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 quantity_lots = 10;
+  {
+    int byte_size = _impl_._quantity_lots_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          10, _internal_quantity_lots(), byte_size, target);
+    }
+  }
+
+  // uint32 bid_count = 11;
+  if (this->_internal_bid_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_bid_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:marketdata.OrderBookIncrementalUpdate)
+  return target;
+}
+
+size_t OrderBookIncrementalUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:marketdata.OrderBookIncrementalUpdate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .marketdata.PriceLevel bid_updates = 2;
+  total_size += 1UL * this->_internal_bid_updates_size();
+  for (const auto& msg : this->_impl_.bid_updates_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .marketdata.PriceLevel ask_updates = 3;
+  total_size += 1UL * this->_internal_ask_updates_size();
+  for (const auto& msg : this->_impl_.ask_updates_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated sint32 price_deltas = 9;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.price_deltas_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._price_deltas_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 quantity_lots = 10;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.quantity_lots_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._quantity_lots_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string instrument_id = 1;
+  if (!this->_internal_instrument_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_instrument_id());
+  }
+
+  // uint64 sequence = 5;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+  }
+
+  // uint64 first_sequence = 6;
+  if (this->_internal_first_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_first_sequence());
+  }
+
+  // fixed64 publish_timestamp_ns = 7;
+  if (this->_internal_publish_timestamp_ns() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 instrument_handle = 4;
+  if (this->_internal_instrument_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_instrument_handle());
+  }
+
+  // uint32 bid_count = 11;
+  if (this->_internal_bid_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bid_count());
+  }
+
+  // sint64 base_price_ticks = 8;
+  if (this->_internal_base_price_ticks() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt64SizePlusOne(this->_internal_base_price_ticks());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OrderBookIncrementalUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OrderBookIncrementalUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OrderBookIncrementalUpdate::GetClassData() const { return &_class_data_; }
+
+
+void OrderBookIncrementalUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OrderBookIncrementalUpdate*>(&to_msg);
+  auto& from = static_cast<const OrderBookIncrementalUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:marketdata.OrderBookIncrementalUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bid_updates_.MergeFrom(from._impl_.bid_updates_);
+  _this->_impl_.ask_updates_.MergeFrom(from._impl_.ask_updates_);
+  _this->_impl_.price_deltas_.MergeFrom(from._impl_.price_deltas_);
+  _this->_impl_.quantity_lots_.MergeFrom(from._impl_.quantity_lots_);
+  if (!from._internal_instrument_id().empty()) {
+    _this->_internal_set_instrument_id(from._internal_instrument_id());
+  }
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  if (from._internal_first_sequence() != 0) {
+    _this->_internal_set_first_sequence(from._internal_first_sequence());
+  }
+  if (from._internal_publish_timestamp_ns() != 0) {
+    _this->_internal_set_publish_timestamp_ns(from._internal_publish_timestamp_ns());
+  }
+  if (from._internal_instrument_handle() != 0) {
+    _this->_internal_set_instrument_handle(from._internal_instrument_handle());
+  }
+  if (from._internal_bid_count() != 0) {
+    _this->_internal_set_bid_count(from._internal_bid_count());
+  }
+  if (from._internal_base_price_ticks() != 0) {
+    _this->_internal_set_base_price_ticks(from._internal_base_price_ticks());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OrderBookIncrementalUpdate::CopyFrom(const OrderBookIncrementalUpdate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:marketdata.OrderBookIncrementalUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OrderBookIncrementalUpdate::IsInitialized() const {
+  return true;
+}
+
+void OrderBookIncrementalUpdate::InternalSwap(OrderBookIncrementalUpdate* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.bid_updates_.InternalSwap(&other->_impl_.bid_updates_);
+  _impl_.ask_updates_.InternalSwap(&other->_impl_.ask_updates_);
+  _impl_.price_deltas_.InternalSwap(&other->_impl_.price_deltas_);
+  _impl_.quantity_lots_.InternalSwap(&other->_impl_.quantity_lots_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.instrument_id_, lhs_arena,
+      &other->_impl_.instrument_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OrderBookIncrementalUpdate, _impl_.base_price_ticks_)
+      + sizeof(OrderBookIncrementalUpdate::_impl_.base_price_ticks_)
+      - PROTOBUF_FIELD_OFFSET(OrderBookIncrementalUpdate, _impl_.sequence_)>(
+          reinterpret_cast<char*>(&_impl_.sequence_),
+          reinterpret_cast<char*>(&other->_impl_.sequence_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OrderBookIncrementalUpdate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_market_5fdata_2eproto_getter, &descriptor_table_market_5fdata_2eproto_once,
+      file_level_metadata_market_5fdata_2eproto[6]);
+}
+
+// ===================================================================
+
+class PriceLevel::_Internal {
+ public:
+};
+
+PriceLevel::PriceLevel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:marketdata.PriceLevel)
+}
+PriceLevel::PriceLevel(const PriceLevel& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PriceLevel* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.price_){}
+    , decltype(_impl_.quantity_){}
+    , decltype(_impl_.price_ticks_){}
+    , decltype(_impl_.quantity_lots_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.price_, &from._impl_.price_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.quantity_lots_) -
+    reinterpret_cast<char*>(&_impl_.price_)) + sizeof(_impl_.quantity_lots_));
+  // @@protoc_insertion_point(copy_constructor:marketdata.PriceLevel)
+}
+
+inline void PriceLevel::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.price_){0}
+    , decltype(_impl_.quantity_){0}
+    , decltype(_impl_.price_ticks_){int64_t{0}}
+    , decltype(_impl_.quantity_lots_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PriceLevel::~PriceLevel() {
+  // @@protoc_insertion_point(destructor:marketdata.PriceLevel)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PriceLevel::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PriceLevel::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PriceLevel::Clear() {
+// @@protoc_insertion_point(message_clear_start:marketdata.PriceLevel)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.price_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.quantity_lots_) -
+      reinterpret_cast<char*>(&_impl_.price_)) + sizeof(_impl_.quantity_lots_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PriceLevel::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double price = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.price_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double quantity = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.quantity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint64 price_ticks = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.price_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 quantity_lots = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.quantity_lots_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PriceLevel::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:marketdata.PriceLevel)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double price = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_price = this->_internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_price(), target);
+  }
+
+  // double quantity = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_quantity = this->_internal_quantity();
+  uint64_t raw_quantity;
+  memcpy(&raw_quantity, &tmp_quantity, sizeof(tmp_quantity));
+  if (raw_quantity != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_quantity(), target);
+  }
+
+  // sint64 price_ticks = 3;
+  if (this->_internal_price_ticks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt64ToArray(3, this->_internal_price_ticks(), target);
+  }
+
+  // int64 quantity_lots = 4;
+  if (this->_internal_quantity_lots() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_quantity_lots(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:marketdata.PriceLevel)
+  return target;
+}
+
+size_t PriceLevel::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:marketdata.PriceLevel)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double price = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_price = this->_internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double quantity = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_quantity = this->_internal_quantity();
+  uint64_t raw_quantity;
+  memcpy(&raw_quantity, &tmp_quantity, sizeof(tmp_quantity));
+  if (raw_quantity != 0) {
+    total_size += 1 + 8;
+  }
+
+  // sint64 price_ticks = 3;
+  if (this->_internal_price_ticks() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt64SizePlusOne(this->_internal_price_ticks());
+  }
+
+  // int64 quantity_lots = 4;
+  if (this->_internal_quantity_lots() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_quantity_lots());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PriceLevel::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PriceLevel::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PriceLevel::GetClassData() const { return &_class_data_; }
+
+
+void PriceLevel::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PriceLevel*>(&to_msg);
+  auto& from = static_cast<const PriceLevel&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:marketdata.PriceLevel)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_price = from._internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
+    _this->_internal_set_price(from._internal_price());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_quantity = from._internal_quantity();
+  uint64_t raw_quantity;
+  memcpy(&raw_quantity, &tmp_quantity, sizeof(tmp_quantity));
+  if (raw_quantity != 0) {
+    _this->_internal_set_quantity(from._internal_quantity());
+  }
+  if (from._internal_price_ticks() != 0) {
+    _this->_internal_set_price_ticks(from._internal_price_ticks());
+  }
+  if (from._internal_quantity_lots() != 0) {
+    _this->_internal_set_quantity_lots(from._internal_quantity_lots());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PriceLevel::CopyFrom(const PriceLevel& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:marketdata.PriceLevel)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PriceLevel::IsInitialized() const {
+  return true;
+}
+
+void PriceLevel::InternalSwap(PriceLevel* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.quantity_lots_)
+      + sizeof(PriceLevel::_impl_.quantity_lots_)
+      - PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.price_)>(
+          reinterpret_cast<char*>(&_impl_.price_),
+          reinterpret_cast<char*>(&other->_impl_.price_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PriceLevel::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_market_5fdata_2eproto_getter, &descriptor_table_market_5fdata_2eproto_once,
+      file_level_metadata_market_5fdata_2eproto[7]);
+}
+
+// ===================================================================
+
+class StatsRequest::_Internal {
+ public:
+};
+
+StatsRequest::StatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:marketdata.StatsRequest)
+}
+StatsRequest::StatsRequest(const StatsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  StatsRequest* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:marketdata.StatsRequest)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatsRequest::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_market_5fdata_2eproto_getter, &descriptor_table_market_5fdata_2eproto_once,
+      file_level_metadata_market_5fdata_2eproto[8]);
+}
+
+// ===================================================================
+
+class StreamStats::_Internal {
+ public:
+};
+
+StreamStats::StreamStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:marketdata.StreamStats)
+}
+StreamStats::StreamStats(const StreamStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StreamStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.peer_){}
+    , decltype(_impl_.stream_id_){}
+    , decltype(_impl_.messages_sent_){}
+    , decltype(_impl_.bytes_sent_){}
+    , decltype(_impl_.write_blocked_ns_){}
+    , decltype(_impl_.queue_depth_){}
+    , decltype(_impl_.max_queue_depth_){}
+    , decltype(_impl_.updates_conflated_){}
+    , decltype(_impl_.updates_dropped_){}
+    , decltype(_impl_.subscriptions_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.peer_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.peer_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_peer().empty()) {
+    _this->_impl_.peer_.Set(from._internal_peer(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.stream_id_, &from._impl_.stream_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.subscriptions_) -
+    reinterpret_cast<char*>(&_impl_.stream_id_)) + sizeof(_impl_.subscriptions_));
+  // @@protoc_insertion_point(copy_constructor:marketdata.StreamStats)
+}
+
+inline void StreamStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.peer_){}
+    , decltype(_impl_.stream_id_){uint64_t{0u}}
+    , decltype(_impl_.messages_sent_){uint64_t{0u}}
+    , decltype(_impl_.bytes_sent_){uint64_t{0u}}
+    , decltype(_impl_.write_blocked_ns_){uint64_t{0u}}
+    , decltype(_impl_.queue_depth_){uint64_t{0u}}
+    , decltype(_impl_.max_queue_depth_){uint64_t{0u}}
+    , decltype(_impl_.updates_conflated_){uint64_t{0u}}
+    , decltype(_impl_.updates_dropped_){uint64_t{0u}}
+    , decltype(_impl_.subscriptions_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.peer_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.peer_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+StreamStats::~StreamStats() {
+  // @@protoc_insertion_point(destructor:marketdata.StreamStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StreamStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.peer_.Destroy();
+}
+
+void StreamStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StreamStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:marketdata.StreamStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.peer_.ClearToEmpty();
+  ::memset(&_impl_.stream_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.subscriptions_) -
+      reinterpret_cast<char*>(&_impl_.stream_id_)) + sizeof(_impl_.subscriptions_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StreamStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 stream_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.stream_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string peer = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_peer();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "marketdata.StreamStats.peer"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 subscriptions = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.subscriptions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 messages_sent = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.messages_sent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bytes_sent = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.bytes_sent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 write_blocked_ns = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.write_blocked_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 queue_depth = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.queue_depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max_queue_depth = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.max_queue_depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 updates_conflated = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.updates_conflated_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 updates_dropped = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.updates_dropped_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StreamStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:marketdata.StreamStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 stream_id = 1;
+  if (this->_internal_stream_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_stream_id(), target);
+  }
+
+  // string peer = 2;
+  if (!this->_internal_peer().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_peer().data(), static_cast<int>(this->_internal_peer().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "marketdata.StreamStats.peer");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_peer(), target);
+  }
+
+  // uint32 subscriptions = 3;
+  if (this->_internal_subscriptions() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_subscriptions(), target);
+  }
+
+  // uint64 messages_sent = 4;
+  if (this->_internal_messages_sent() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_messages_sent(), target);
+  }
+
+  // uint64 bytes_sent = 5;
+  if (this->_internal_bytes_sent() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_bytes_sent(), target);
+  }
+
+  // uint64 write_blocked_ns = 6;
+  if (this->_internal_write_blocked_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_write_blocked_ns(), target);
+  }
+
+  // uint64 queue_depth = 7;
+  if (this->_internal_queue_depth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_queue_depth(), target);
+  }
+
+  // uint64 max_queue_depth = 8;
+  if (this->_internal_max_queue_depth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_max_queue_depth(), target);
+  }
+
+  // uint64 updates_conflated = 9;
+  if (this->_internal_updates_conflated() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_updates_conflated(), target);
+  }
+
+  // uint64 updates_dropped = 10;
+  if (this->_internal_updates_dropped() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_updates_dropped(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:marketdata.StreamStats)
+  return target;
+}
+
+size_t StreamStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:marketdata.StreamStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string peer = 2;
+  if (!this->_internal_peer().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_peer());
+  }
+
+  // uint64 stream_id = 1;
+  if (this->_internal_stream_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_stream_id());
+  }
+
+  // uint64 messages_sent = 4;
+  if (this->_internal_messages_sent() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_messages_sent());
+  }
+
+  // uint64 bytes_sent = 5;
+  if (this->_internal_bytes_sent() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes_sent());
+  }
+
+  // uint64 write_blocked_ns = 6;
+  if (this->_internal_write_blocked_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_write_blocked_ns());
+  }
+
+  // uint64 queue_depth = 7;
+  if (this->_internal_queue_depth() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_queue_depth());
+  }
+
+  // uint64 max_queue_depth = 8;
+  if (this->_internal_max_queue_depth() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_queue_depth());
+  }
+
+  // uint64 updates_conflated = 9;
+  if (this->_internal_updates_conflated() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_updates_conflated());
+  }
+
+  // uint64 updates_dropped = 10;
+  if (this->_internal_updates_dropped() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_updates_dropped());
+  }
+
+  // uint32 subscriptions = 3;
+  if (this->_internal_subscriptions() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_subscriptions());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StreamStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StreamStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StreamStats::GetClassData() const { return &_class_data_; }
+
+
+void StreamStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StreamStats*>(&to_msg);
+  auto& from = static_cast<const StreamStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:marketdata.StreamStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_peer().empty()) {
+    _this->_internal_set_peer(from._internal_peer());
+  }
+  if (from._internal_stream_id() != 0) {
+    _this->_internal_set_stream_id(from._internal_stream_id());
+  }
+  if (from._internal_messages_sent() != 0) {
+    _this->_internal_set_messages_sent(from._internal_messages_sent());
+  }
+  if (from._internal_bytes_sent() != 0) {
+    _this->_internal_set_bytes_sent(from._internal_bytes_sent());
+  }
+  if (from._internal_write_blocked_ns() != 0) {
+    _this->_internal_set_write_blocked_ns(from._internal_write_blocked_ns());
+  }
+  if (from._internal_queue_depth() != 0) {
+    _this->_internal_set_queue_depth(from._internal_queue_depth());
+  }
+  if (from._internal_max_queue_depth() != 0) {
+    _this->_internal_set_max_queue_depth(from._internal_max_queue_depth());
+  }
+  if (from._internal_updates_conflated() != 0) {
+    _this->_internal_set_updates_conflated(from._internal_updates_conflated());
+  }
+  if (from._internal_updates_dropped() != 0) {
+    _this->_internal_set_updates_dropped(from._internal_updates_dropped());
+  }
+  if (from._internal_subscriptions() != 0) {
+    _this->_internal_set_subscriptions(from._internal_subscriptions());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StreamStats::CopyFrom(const StreamStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:marketdata.StreamStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StreamStats::IsInitialized() const {
+  return true;
+}
 
-void OrderBookSnapshot::InternalSwap(OrderBookSnapshot* PROTOBUF_RESTRICT other) {
+void StreamStats::InternalSwap(StreamStats* other) {
   using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.bids_.InternalSwap(&other->_impl_.bids_);
-  _impl_.asks_.InternalSwap(&other->_impl_.asks_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.instrument_id_, &other->_impl_.instrument_id_, arena);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.peer_, lhs_arena,
+      &other->_impl_.peer_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StreamStats, _impl_.subscriptions_)
+      + sizeof(StreamStats::_impl_.subscriptions_)
+      - PROTOBUF_FIELD_OFFSET(StreamStats, _impl_.stream_id_)>(
+          reinterpret_cast<char*>(&_impl_.stream_id_),
+          reinterpret_cast<char*>(&other->_impl_.stream_id_));
 }
 
-::google::protobuf::Metadata OrderBookSnapshot::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+::PROTOBUF_NAMESPACE_ID::Metadata StreamStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_market_5fdata_2eproto_getter, &descriptor_table_market_5fdata_2eproto_once,
+      file_level_metadata_market_5fdata_2eproto[9]);
 }
+
 // ===================================================================
 
-class OrderBookIncrementalUpdate::_Internal {
+class InstrumentStats::_Internal {
  public:
 };
 
-OrderBookIncrementalUpdate::OrderBookIncrementalUpdate(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:marketdata.OrderBookIncrementalUpdate)
+InstrumentStats::InstrumentStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:marketdata.InstrumentStats)
 }
-inline PROTOBUF_NDEBUG_INLINE OrderBookIncrementalUpdate::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::marketdata::OrderBookIncrementalUpdate& from_msg)
-      : bid_updates_{visibility, arena, from.bid_updates_},
-        ask_updates_{visibility, arena, from.ask_updates_},
-        instrument_id_(arena, from.instrument_id_),
-        _cached_size_{0} {}
-
-OrderBookIncrementalUpdate::OrderBookIncrementalUpdate(
-    ::google::protobuf::Arena* arena,
-    const OrderBookIncrementalUpdate& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  OrderBookIncrementalUpdate* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+InstrumentStats::InstrumentStats(const InstrumentStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InstrumentStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.instrument_id_){}
+    , decltype(_impl_.updates_published_){}
+    , decltype(_impl_.bytes_published_){}
+    , decltype(_impl_.deliveries_){}
+    , decltype(_impl_.snapshots_sent_){}
+    , decltype(_impl_.snapshots_built_){}
+    , decltype(_impl_.subscribers_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-  // @@protoc_insertion_point(copy_constructor:marketdata.OrderBookIncrementalUpdate)
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.instrument_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_instrument_id().empty()) {
+    _this->_impl_.instrument_id_.Set(from._internal_instrument_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.updates_published_, &from._impl_.updates_published_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.subscribers_) -
+    reinterpret_cast<char*>(&_impl_.updates_published_)) + sizeof(_impl_.subscribers_));
+  // @@protoc_insertion_point(copy_constructor:marketdata.InstrumentStats)
 }
-inline PROTOBUF_NDEBUG_INLINE OrderBookIncrementalUpdate::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : bid_updates_{visibility, arena},
-        ask_updates_{visibility, arena},
-        instrument_id_(arena),
-        _cached_size_{0} {}
 
-inline void OrderBookIncrementalUpdate::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
+inline void InstrumentStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.instrument_id_){}
+    , decltype(_impl_.updates_published_){uint64_t{0u}}
+    , decltype(_impl_.bytes_published_){uint64_t{0u}}
+    , decltype(_impl_.deliveries_){uint64_t{0u}}
+    , decltype(_impl_.snapshots_sent_){uint64_t{0u}}
+    , decltype(_impl_.snapshots_built_){uint64_t{0u}}
+    , decltype(_impl_.subscribers_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.instrument_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
-OrderBookIncrementalUpdate::~OrderBookIncrementalUpdate() {
-  // @@protoc_insertion_point(destructor:marketdata.OrderBookIncrementalUpdate)
-  SharedDtor(*this);
-}
-inline void OrderBookIncrementalUpdate::SharedDtor(MessageLite& self) {
-  OrderBookIncrementalUpdate& this_ = static_cast<OrderBookIncrementalUpdate&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.instrument_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* OrderBookIncrementalUpdate::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) OrderBookIncrementalUpdate(arena);
-}
-constexpr auto OrderBookIncrementalUpdate::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(OrderBookIncrementalUpdate, _impl_.bid_updates_) +
-          decltype(OrderBookIncrementalUpdate::_impl_.bid_updates_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-      PROTOBUF_FIELD_OFFSET(OrderBookIncrementalUpdate, _impl_.ask_updates_) +
-          decltype(OrderBookIncrementalUpdate::_impl_.ask_updates_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::CopyInit(
-        sizeof(OrderBookIncrementalUpdate), alignof(OrderBookIncrementalUpdate), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&OrderBookIncrementalUpdate::PlacementNew_,
-                                 sizeof(OrderBookIncrementalUpdate),
-                                 alignof(OrderBookIncrementalUpdate));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull OrderBookIncrementalUpdate::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_OrderBookIncrementalUpdate_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &OrderBookIncrementalUpdate::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<OrderBookIncrementalUpdate>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &OrderBookIncrementalUpdate::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<OrderBookIncrementalUpdate>(), &OrderBookIncrementalUpdate::ByteSizeLong,
-            &OrderBookIncrementalUpdate::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(OrderBookIncrementalUpdate, _impl_._cached_size_),
-        false,
-    },
-    &OrderBookIncrementalUpdate::kDescriptorMethods,
-    &descriptor_table_market_5fdata_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* OrderBookIncrementalUpdate::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
+
+InstrumentStats::~InstrumentStats() {
+  // @@protoc_insertion_point(destructor:marketdata.InstrumentStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 2, 59, 2> OrderBookIncrementalUpdate::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::marketdata::OrderBookIncrementalUpdate>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string instrument_id = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(OrderBookIncrementalUpdate, _impl_.instrument_id_)}},
-    // repeated .marketdata.PriceLevel bid_updates = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(OrderBookIncrementalUpdate, _impl_.bid_updates_)}},
-    // repeated .marketdata.PriceLevel ask_updates = 3;
-    {::_pbi::TcParser::FastMtR1,
-     {26, 63, 1, PROTOBUF_FIELD_OFFSET(OrderBookIncrementalUpdate, _impl_.ask_updates_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string instrument_id = 1;
-    {PROTOBUF_FIELD_OFFSET(OrderBookIncrementalUpdate, _impl_.instrument_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // repeated .marketdata.PriceLevel bid_updates = 2;
-    {PROTOBUF_FIELD_OFFSET(OrderBookIncrementalUpdate, _impl_.bid_updates_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-    // repeated .marketdata.PriceLevel ask_updates = 3;
-    {PROTOBUF_FIELD_OFFSET(OrderBookIncrementalUpdate, _impl_.ask_updates_), 0, 1,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::marketdata::PriceLevel>()},
-    {::_pbi::TcParser::GetTable<::marketdata::PriceLevel>()},
-  }}, {{
-    "\45\15\0\0\0\0\0\0"
-    "marketdata.OrderBookIncrementalUpdate"
-    "instrument_id"
-  }},
-};
 
-PROTOBUF_NOINLINE void OrderBookIncrementalUpdate::Clear() {
-// @@protoc_insertion_point(message_clear_start:marketdata.OrderBookIncrementalUpdate)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
+inline void InstrumentStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.instrument_id_.Destroy();
+}
+
+void InstrumentStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InstrumentStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:marketdata.InstrumentStats)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.bid_updates_.Clear();
-  _impl_.ask_updates_.Clear();
   _impl_.instrument_id_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* OrderBookIncrementalUpdate::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const OrderBookIncrementalUpdate& this_ = static_cast<const OrderBookIncrementalUpdate&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* OrderBookIncrementalUpdate::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const OrderBookIncrementalUpdate& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:marketdata.OrderBookIncrementalUpdate)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string instrument_id = 1;
-          if (!this_._internal_instrument_id().empty()) {
-            const std::string& _s = this_._internal_instrument_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "marketdata.OrderBookIncrementalUpdate.instrument_id");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // repeated .marketdata.PriceLevel bid_updates = 2;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_bid_updates_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_bid_updates().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    2, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          // repeated .marketdata.PriceLevel ask_updates = 3;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_ask_updates_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_ask_updates().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    3, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:marketdata.OrderBookIncrementalUpdate)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t OrderBookIncrementalUpdate::ByteSizeLong(const MessageLite& base) {
-          const OrderBookIncrementalUpdate& this_ = static_cast<const OrderBookIncrementalUpdate&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t OrderBookIncrementalUpdate::ByteSizeLong() const {
-          const OrderBookIncrementalUpdate& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:marketdata.OrderBookIncrementalUpdate)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .marketdata.PriceLevel bid_updates = 2;
-            {
-              total_size += 1UL * this_._internal_bid_updates_size();
-              for (const auto& msg : this_._internal_bid_updates()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-            // repeated .marketdata.PriceLevel ask_updates = 3;
-            {
-              total_size += 1UL * this_._internal_ask_updates_size();
-              for (const auto& msg : this_._internal_ask_updates()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // string instrument_id = 1;
-            if (!this_._internal_instrument_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_instrument_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void OrderBookIncrementalUpdate::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<OrderBookIncrementalUpdate*>(&to_msg);
-  auto& from = static_cast<const OrderBookIncrementalUpdate&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:marketdata.OrderBookIncrementalUpdate)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  ::memset(&_impl_.updates_published_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.subscribers_) -
+      reinterpret_cast<char*>(&_impl_.updates_published_)) + sizeof(_impl_.subscribers_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InstrumentStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string instrument_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_instrument_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "marketdata.InstrumentStats.instrument_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 subscribers = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.subscribers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 updates_published = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.updates_published_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bytes_published = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.bytes_published_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 deliveries = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.deliveries_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 snapshots_sent = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.snapshots_sent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 snapshots_built = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.snapshots_built_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InstrumentStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:marketdata.InstrumentStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string instrument_id = 1;
+  if (!this->_internal_instrument_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_instrument_id().data(), static_cast<int>(this->_internal_instrument_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "marketdata.InstrumentStats.instrument_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_instrument_id(), target);
+  }
+
+  // uint32 subscribers = 2;
+  if (this->_internal_subscribers() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_subscribers(), target);
+  }
+
+  // uint64 updates_published = 3;
+  if (this->_internal_updates_published() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_updates_published(), target);
+  }
+
+  // uint64 bytes_published = 4;
+  if (this->_internal_bytes_published() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_bytes_published(), target);
+  }
+
+  // uint64 deliveries = 5;
+  if (this->_internal_deliveries() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_deliveries(), target);
+  }
+
+  // uint64 snapshots_sent = 6;
+  if (this->_internal_snapshots_sent() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_snapshots_sent(), target);
+  }
+
+  // uint64 snapshots_built = 7;
+  if (this->_internal_snapshots_built() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_snapshots_built(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:marketdata.InstrumentStats)
+  return target;
+}
+
+size_t InstrumentStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:marketdata.InstrumentStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string instrument_id = 1;
+  if (!this->_internal_instrument_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_instrument_id());
+  }
+
+  // uint64 updates_published = 3;
+  if (this->_internal_updates_published() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_updates_published());
+  }
+
+  // uint64 bytes_published = 4;
+  if (this->_internal_bytes_published() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes_published());
+  }
+
+  // uint64 deliveries = 5;
+  if (this->_internal_deliveries() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_deliveries());
+  }
+
+  // uint64 snapshots_sent = 6;
+  if (this->_internal_snapshots_sent() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_snapshots_sent());
+  }
+
+  // uint64 snapshots_built = 7;
+  if (this->_internal_snapshots_built() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_snapshots_built());
+  }
+
+  // uint32 subscribers = 2;
+  if (this->_internal_subscribers() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_subscribers());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InstrumentStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InstrumentStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InstrumentStats::GetClassData() const { return &_class_data_; }
+
+
+void InstrumentStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InstrumentStats*>(&to_msg);
+  auto& from = static_cast<const InstrumentStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:marketdata.InstrumentStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_internal_mutable_bid_updates()->MergeFrom(
-      from._internal_bid_updates());
-  _this->_internal_mutable_ask_updates()->MergeFrom(
-      from._internal_ask_updates());
   if (!from._internal_instrument_id().empty()) {
     _this->_internal_set_instrument_id(from._internal_instrument_id());
   }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_updates_published() != 0) {
+    _this->_internal_set_updates_published(from._internal_updates_published());
+  }
+  if (from._internal_bytes_published() != 0) {
+    _this->_internal_set_bytes_published(from._internal_bytes_published());
+  }
+  if (from._internal_deliveries() != 0) {
+    _this->_internal_set_deliveries(from._internal_deliveries());
+  }
+  if (from._internal_snapshots_sent() != 0) {
+    _this->_internal_set_snapshots_sent(from._internal_snapshots_sent());
+  }
+  if (from._internal_snapshots_built() != 0) {
+    _this->_internal_set_snapshots_built(from._internal_snapshots_built());
+  }
+  if (from._internal_subscribers() != 0) {
+    _this->_internal_set_subscribers(from._internal_subscribers());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void OrderBookIncrementalUpdate::CopyFrom(const OrderBookIncrementalUpdate& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:marketdata.OrderBookIncrementalUpdate)
+void InstrumentStats::CopyFrom(const InstrumentStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:marketdata.InstrumentStats)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
+bool InstrumentStats::IsInitialized() const {
+  return true;
+}
 
-void OrderBookIncrementalUpdate::InternalSwap(OrderBookIncrementalUpdate* PROTOBUF_RESTRICT other) {
+void InstrumentStats::InternalSwap(InstrumentStats* other) {
   using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.bid_updates_.InternalSwap(&other->_impl_.bid_updates_);
-  _impl_.ask_updates_.InternalSwap(&other->_impl_.ask_updates_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.instrument_id_, &other->_impl_.instrument_id_, arena);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.instrument_id_, lhs_arena,
+      &other->_impl_.instrument_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InstrumentStats, _impl_.subscribers_)
+      + sizeof(InstrumentStats::_impl_.subscribers_)
+      - PROTOBUF_FIELD_OFFSET(InstrumentStats, _impl_.updates_published_)>(
+          reinterpret_cast<char*>(&_impl_.updates_published_),
+          reinterpret_cast<char*>(&other->_impl_.updates_published_));
 }
 
-::google::protobuf::Metadata OrderBookIncrementalUpdate::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+::PROTOBUF_NAMESPACE_ID::Metadata InstrumentStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_market_5fdata_2eproto_getter, &descriptor_table_market_5fdata_2eproto_once,
+      file_level_metadata_market_5fdata_2eproto[10]);
 }
+
 // ===================================================================
 
-class PriceLevel::_Internal {
+class ServerStats::_Internal {
  public:
+  static const ::marketdata::StreamStats& closed_streams(const ServerStats* msg);
 };
 
-PriceLevel::PriceLevel(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:marketdata.PriceLevel)
+const ::marketdata::StreamStats&
+ServerStats::_Internal::closed_streams(const ServerStats* msg) {
+  return *msg->_impl_.closed_streams_;
 }
-PriceLevel::PriceLevel(
-    ::google::protobuf::Arena* arena, const PriceLevel& from)
-    : PriceLevel(arena) {
-  MergeFrom(from);
+ServerStats::ServerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:marketdata.ServerStats)
 }
-inline PROTOBUF_NDEBUG_INLINE PriceLevel::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
+ServerStats::ServerStats(const ServerStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.streams_){from._impl_.streams_}
+    , decltype(_impl_.instruments_){from._impl_.instruments_}
+    , decltype(_impl_.closed_streams_){nullptr}
+    , decltype(_impl_.streams_opened_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-inline void PriceLevel::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, price_),
-           0,
-           offsetof(Impl_, quantity_) -
-               offsetof(Impl_, price_) +
-               sizeof(Impl_::quantity_));
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_closed_streams()) {
+    _this->_impl_.closed_streams_ = new ::marketdata::StreamStats(*from._impl_.closed_streams_);
+  }
+  _this->_impl_.streams_opened_ = from._impl_.streams_opened_;
+  // @@protoc_insertion_point(copy_constructor:marketdata.ServerStats)
 }
-PriceLevel::~PriceLevel() {
-  // @@protoc_insertion_point(destructor:marketdata.PriceLevel)
-  SharedDtor(*this);
-}
-inline void PriceLevel::SharedDtor(MessageLite& self) {
-  PriceLevel& this_ = static_cast<PriceLevel&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* PriceLevel::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) PriceLevel(arena);
-}
-constexpr auto PriceLevel::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(PriceLevel),
-                                            alignof(PriceLevel));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull PriceLevel::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_PriceLevel_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &PriceLevel::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<PriceLevel>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &PriceLevel::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<PriceLevel>(), &PriceLevel::ByteSizeLong,
-            &PriceLevel::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_._cached_size_),
-        false,
-    },
-    &PriceLevel::kDescriptorMethods,
-    &descriptor_table_market_5fdata_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* PriceLevel::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
+
+inline void ServerStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.streams_){arena}
+    , decltype(_impl_.instruments_){arena}
+    , decltype(_impl_.closed_streams_){nullptr}
+    , decltype(_impl_.streams_opened_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 0, 2> PriceLevel::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::marketdata::PriceLevel>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // double quantity = 2;
-    {::_pbi::TcParser::FastF64S1,
-     {17, 63, 0, PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.quantity_)}},
-    // double price = 1;
-    {::_pbi::TcParser::FastF64S1,
-     {9, 63, 0, PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.price_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // double price = 1;
-    {PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.price_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // double quantity = 2;
-    {PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.quantity_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
 
-PROTOBUF_NOINLINE void PriceLevel::Clear() {
-// @@protoc_insertion_point(message_clear_start:marketdata.PriceLevel)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
+ServerStats::~ServerStats() {
+  // @@protoc_insertion_point(destructor:marketdata.ServerStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.streams_.~RepeatedPtrField();
+  _impl_.instruments_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.closed_streams_;
+}
+
+void ServerStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:marketdata.ServerStats)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.price_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.quantity_) -
-      reinterpret_cast<char*>(&_impl_.price_)) + sizeof(_impl_.quantity_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* PriceLevel::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const PriceLevel& this_ = static_cast<const PriceLevel&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* PriceLevel::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const PriceLevel& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:marketdata.PriceLevel)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // double price = 1;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_price()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                1, this_._internal_price(), target);
-          }
-
-          // double quantity = 2;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_quantity()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                2, this_._internal_quantity(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:marketdata.PriceLevel)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t PriceLevel::ByteSizeLong(const MessageLite& base) {
-          const PriceLevel& this_ = static_cast<const PriceLevel&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t PriceLevel::ByteSizeLong() const {
-          const PriceLevel& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:marketdata.PriceLevel)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // double price = 1;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_price()) != 0) {
-              total_size += 9;
-            }
-            // double quantity = 2;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_quantity()) != 0) {
-              total_size += 9;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void PriceLevel::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<PriceLevel*>(&to_msg);
-  auto& from = static_cast<const PriceLevel&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:marketdata.PriceLevel)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  _impl_.streams_.Clear();
+  _impl_.instruments_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.closed_streams_ != nullptr) {
+    delete _impl_.closed_streams_;
+  }
+  _impl_.closed_streams_ = nullptr;
+  _impl_.streams_opened_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 streams_opened = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.streams_opened_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .marketdata.StreamStats streams = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_streams(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .marketdata.StreamStats closed_streams = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_closed_streams(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .marketdata.InstrumentStats instruments = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_instruments(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:marketdata.ServerStats)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (::absl::bit_cast<::uint64_t>(from._internal_price()) != 0) {
-    _this->_impl_.price_ = from._impl_.price_;
+  // uint64 streams_opened = 1;
+  if (this->_internal_streams_opened() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_streams_opened(), target);
+  }
+
+  // repeated .marketdata.StreamStats streams = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_streams_size()); i < n; i++) {
+    const auto& repfield = this->_internal_streams(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
-  if (::absl::bit_cast<::uint64_t>(from._internal_quantity()) != 0) {
-    _this->_impl_.quantity_ = from._impl_.quantity_;
+
+  // .marketdata.StreamStats closed_streams = 3;
+  if (this->_internal_has_closed_streams()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::closed_streams(this),
+        _Internal::closed_streams(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .marketdata.InstrumentStats instruments = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_instruments_size()); i < n; i++) {
+    const auto& repfield = this->_internal_instruments(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(serialize_to_array_end:marketdata.ServerStats)
+  return target;
 }
 
-void PriceLevel::CopyFrom(const PriceLevel& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:marketdata.PriceLevel)
+size_t ServerStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:marketdata.ServerStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .marketdata.StreamStats streams = 2;
+  total_size += 1UL * this->_internal_streams_size();
+  for (const auto& msg : this->_impl_.streams_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .marketdata.InstrumentStats instruments = 4;
+  total_size += 1UL * this->_internal_instruments_size();
+  for (const auto& msg : this->_impl_.instruments_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .marketdata.StreamStats closed_streams = 3;
+  if (this->_internal_has_closed_streams()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.closed_streams_);
+  }
+
+  // uint64 streams_opened = 1;
+  if (this->_internal_streams_opened() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_streams_opened());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerStats::GetClassData() const { return &_class_data_; }
+
+
+void ServerStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerStats*>(&to_msg);
+  auto& from = static_cast<const ServerStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:marketdata.ServerStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.streams_.MergeFrom(from._impl_.streams_);
+  _this->_impl_.instruments_.MergeFrom(from._impl_.instruments_);
+  if (from._internal_has_closed_streams()) {
+    _this->_internal_mutable_closed_streams()->::marketdata::StreamStats::MergeFrom(
+        from._internal_closed_streams());
+  }
+  if (from._internal_streams_opened() != 0) {
+    _this->_internal_set_streams_opened(from._internal_streams_opened());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerStats::CopyFrom(const ServerStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:marketdata.ServerStats)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
+bool ServerStats::IsInitialized() const {
+  return true;
+}
 
-void PriceLevel::InternalSwap(PriceLevel* PROTOBUF_RESTRICT other) {
+void ServerStats::InternalSwap(ServerStats* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.quantity_)
-      + sizeof(PriceLevel::_impl_.quantity_)
-      - PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.price_)>(
-          reinterpret_cast<char*>(&_impl_.price_),
-          reinterpret_cast<char*>(&other->_impl_.price_));
+  _impl_.streams_.InternalSwap(&other->_impl_.streams_);
+  _impl_.instruments_.InternalSwap(&other->_impl_.instruments_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerStats, _impl_.streams_opened_)
+      + sizeof(ServerStats::_impl_.streams_opened_)
+      - PROTOBUF_FIELD_OFFSET(ServerStats, _impl_.closed_streams_)>(
+          reinterpret_cast<char*>(&_impl_.closed_streams_),
+          reinterpret_cast<char*>(&other->_impl_.closed_streams_));
 }
 
-::google::protobuf::Metadata PriceLevel::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+::PROTOBUF_NAMESPACE_ID::Metadata ServerStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_market_5fdata_2eproto_getter, &descriptor_table_market_5fdata_2eproto_once,
+      file_level_metadata_market_5fdata_2eproto[11]);
 }
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace marketdata
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::marketdata::SubscriptionRequest*
+Arena::CreateMaybeMessage< ::marketdata::SubscriptionRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::marketdata::SubscriptionRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::marketdata::MarketDataUpdate*
+Arena::CreateMaybeMessage< ::marketdata::MarketDataUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::marketdata::MarketDataUpdate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::marketdata::MarketDataBatch*
+Arena::CreateMaybeMessage< ::marketdata::MarketDataBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::marketdata::MarketDataBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::marketdata::SymbolDirectory_Entry*
+Arena::CreateMaybeMessage< ::marketdata::SymbolDirectory_Entry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::marketdata::SymbolDirectory_Entry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::marketdata::SymbolDirectory*
+Arena::CreateMaybeMessage< ::marketdata::SymbolDirectory >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::marketdata::SymbolDirectory >(arena);
+}
+template<> PROTOBUF_NOINLINE ::marketdata::OrderBookSnapshot*
+Arena::CreateMaybeMessage< ::marketdata::OrderBookSnapshot >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::marketdata::OrderBookSnapshot >(arena);
+}
+template<> PROTOBUF_NOINLINE ::marketdata::OrderBookIncrementalUpdate*
+Arena::CreateMaybeMessage< ::marketdata::OrderBookIncrementalUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::marketdata::OrderBookIncrementalUpdate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::marketdata::PriceLevel*
+Arena::CreateMaybeMessage< ::marketdata::PriceLevel >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::marketdata::PriceLevel >(arena);
+}
+template<> PROTOBUF_NOINLINE ::marketdata::StatsRequest*
+Arena::CreateMaybeMessage< ::marketdata::StatsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::marketdata::StatsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::marketdata::StreamStats*
+Arena::CreateMaybeMessage< ::marketdata::StreamStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::marketdata::StreamStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::marketdata::InstrumentStats*
+Arena::CreateMaybeMessage< ::marketdata::InstrumentStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::marketdata::InstrumentStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::marketdata::ServerStats*
+Arena::CreateMaybeMessage< ::marketdata::ServerStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::marketdata::ServerStats >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::std::false_type
-    _static_init2_ PROTOBUF_UNUSED =
-        (::_pbi::AddDescriptors(&descriptor_table_market_5fdata_2eproto),
-         ::std::false_type{});
-#include "google/protobuf/port_undef.inc"
+#include <google/protobuf/port_undef.inc>
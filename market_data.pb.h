@@ -1,58 +1,58 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
 // source: market_data.proto
-// Protobuf C++ Version: 5.29.3
 
-#ifndef market_5fdata_2eproto_2epb_2eh
-#define market_5fdata_2eproto_2epb_2eh
+#ifndef GOOGLE_PROTOBUF_INCLUDED_market_5fdata_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_market_5fdata_2eproto
 
 #include <limits>
 #include <string>
-#include <type_traits>
-#include <utility>
-
-#include "google/protobuf/runtime_version.h"
-#if PROTOBUF_VERSION != 5029003
-#error "Protobuf C++ gencode is built with an incompatible version of"
-#error "Protobuf C++ headers/runtime. See"
-#error "https://protobuf.dev/support/cross-version-runtime-guarantee/#cpp"
-#endif
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/arena.h"
-#include "google/protobuf/arenastring.h"
-#include "google/protobuf/generated_message_tctable_decl.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/metadata_lite.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/message.h"
-#include "google/protobuf/message_lite.h"
-#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
-#include "google/protobuf/extension_set.h"  // IWYU pragma: export
-#include "google/protobuf/generated_enum_reflection.h"
-#include "google/protobuf/unknown_field_set.h"
-// @@protoc_insertion_point(includes)
 
-// Must be included last.
-#include "google/protobuf/port_def.inc"
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 #define PROTOBUF_INTERNAL_EXPORT_market_5fdata_2eproto
-
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 namespace internal {
-template <typename T>
-::absl::string_view GetAnyMessageName();
+class AnyMetadata;
 }  // namespace internal
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_market_5fdata_2eproto {
-  static const ::uint32_t offsets[];
+  static const uint32_t offsets[];
 };
-extern const ::google::protobuf::internal::DescriptorTable
-    descriptor_table_market_5fdata_2eproto;
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_market_5fdata_2eproto;
 namespace marketdata {
+class InstrumentStats;
+struct InstrumentStatsDefaultTypeInternal;
+extern InstrumentStatsDefaultTypeInternal _InstrumentStats_default_instance_;
+class MarketDataBatch;
+struct MarketDataBatchDefaultTypeInternal;
+extern MarketDataBatchDefaultTypeInternal _MarketDataBatch_default_instance_;
 class MarketDataUpdate;
 struct MarketDataUpdateDefaultTypeInternal;
 extern MarketDataUpdateDefaultTypeInternal _MarketDataUpdate_default_instance_;
@@ -65,82 +65,94 @@ extern OrderBookSnapshotDefaultTypeInternal _OrderBookSnapshot_default_instance_
 class PriceLevel;
 struct PriceLevelDefaultTypeInternal;
 extern PriceLevelDefaultTypeInternal _PriceLevel_default_instance_;
+class ServerStats;
+struct ServerStatsDefaultTypeInternal;
+extern ServerStatsDefaultTypeInternal _ServerStats_default_instance_;
+class StatsRequest;
+struct StatsRequestDefaultTypeInternal;
+extern StatsRequestDefaultTypeInternal _StatsRequest_default_instance_;
+class StreamStats;
+struct StreamStatsDefaultTypeInternal;
+extern StreamStatsDefaultTypeInternal _StreamStats_default_instance_;
 class SubscriptionRequest;
 struct SubscriptionRequestDefaultTypeInternal;
 extern SubscriptionRequestDefaultTypeInternal _SubscriptionRequest_default_instance_;
+class SymbolDirectory;
+struct SymbolDirectoryDefaultTypeInternal;
+extern SymbolDirectoryDefaultTypeInternal _SymbolDirectory_default_instance_;
+class SymbolDirectory_Entry;
+struct SymbolDirectory_EntryDefaultTypeInternal;
+extern SymbolDirectory_EntryDefaultTypeInternal _SymbolDirectory_Entry_default_instance_;
 }  // namespace marketdata
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-
+PROTOBUF_NAMESPACE_OPEN
+template<> ::marketdata::InstrumentStats* Arena::CreateMaybeMessage<::marketdata::InstrumentStats>(Arena*);
+template<> ::marketdata::MarketDataBatch* Arena::CreateMaybeMessage<::marketdata::MarketDataBatch>(Arena*);
+template<> ::marketdata::MarketDataUpdate* Arena::CreateMaybeMessage<::marketdata::MarketDataUpdate>(Arena*);
+template<> ::marketdata::OrderBookIncrementalUpdate* Arena::CreateMaybeMessage<::marketdata::OrderBookIncrementalUpdate>(Arena*);
+template<> ::marketdata::OrderBookSnapshot* Arena::CreateMaybeMessage<::marketdata::OrderBookSnapshot>(Arena*);
+template<> ::marketdata::PriceLevel* Arena::CreateMaybeMessage<::marketdata::PriceLevel>(Arena*);
+template<> ::marketdata::ServerStats* Arena::CreateMaybeMessage<::marketdata::ServerStats>(Arena*);
+template<> ::marketdata::StatsRequest* Arena::CreateMaybeMessage<::marketdata::StatsRequest>(Arena*);
+template<> ::marketdata::StreamStats* Arena::CreateMaybeMessage<::marketdata::StreamStats>(Arena*);
+template<> ::marketdata::SubscriptionRequest* Arena::CreateMaybeMessage<::marketdata::SubscriptionRequest>(Arena*);
+template<> ::marketdata::SymbolDirectory* Arena::CreateMaybeMessage<::marketdata::SymbolDirectory>(Arena*);
+template<> ::marketdata::SymbolDirectory_Entry* Arena::CreateMaybeMessage<::marketdata::SymbolDirectory_Entry>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace marketdata {
+
 enum SubscriptionRequest_Action : int {
   SubscriptionRequest_Action_SUBSCRIBE = 0,
   SubscriptionRequest_Action_UNSUBSCRIBE = 1,
-  SubscriptionRequest_Action_SubscriptionRequest_Action_INT_MIN_SENTINEL_DO_NOT_USE_ =
-      std::numeric_limits<::int32_t>::min(),
-  SubscriptionRequest_Action_SubscriptionRequest_Action_INT_MAX_SENTINEL_DO_NOT_USE_ =
-      std::numeric_limits<::int32_t>::max(),
+  SubscriptionRequest_Action_SNAPSHOT = 2,
+  SubscriptionRequest_Action_SNAPSHOT_ONLY = 3,
+  SubscriptionRequest_Action_SubscriptionRequest_Action_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  SubscriptionRequest_Action_SubscriptionRequest_Action_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
-
 bool SubscriptionRequest_Action_IsValid(int value);
-extern const uint32_t SubscriptionRequest_Action_internal_data_[];
-constexpr SubscriptionRequest_Action SubscriptionRequest_Action_Action_MIN = static_cast<SubscriptionRequest_Action>(0);
-constexpr SubscriptionRequest_Action SubscriptionRequest_Action_Action_MAX = static_cast<SubscriptionRequest_Action>(1);
-constexpr int SubscriptionRequest_Action_Action_ARRAYSIZE = 1 + 1;
-const ::google::protobuf::EnumDescriptor*
-SubscriptionRequest_Action_descriptor();
-template <typename T>
-const std::string& SubscriptionRequest_Action_Name(T value) {
-  static_assert(std::is_same<T, SubscriptionRequest_Action>::value ||
-                    std::is_integral<T>::value,
-                "Incorrect type passed to Action_Name().");
-  return SubscriptionRequest_Action_Name(static_cast<SubscriptionRequest_Action>(value));
-}
-template <>
-inline const std::string& SubscriptionRequest_Action_Name(SubscriptionRequest_Action value) {
-  return ::google::protobuf::internal::NameOfDenseEnum<SubscriptionRequest_Action_descriptor,
-                                                 0, 1>(
-      static_cast<int>(value));
+constexpr SubscriptionRequest_Action SubscriptionRequest_Action_Action_MIN = SubscriptionRequest_Action_SUBSCRIBE;
+constexpr SubscriptionRequest_Action SubscriptionRequest_Action_Action_MAX = SubscriptionRequest_Action_SNAPSHOT_ONLY;
+constexpr int SubscriptionRequest_Action_Action_ARRAYSIZE = SubscriptionRequest_Action_Action_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SubscriptionRequest_Action_descriptor();
+template<typename T>
+inline const std::string& SubscriptionRequest_Action_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SubscriptionRequest_Action>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SubscriptionRequest_Action_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SubscriptionRequest_Action_descriptor(), enum_t_value);
 }
-inline bool SubscriptionRequest_Action_Parse(absl::string_view name, SubscriptionRequest_Action* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<SubscriptionRequest_Action>(
-      SubscriptionRequest_Action_descriptor(), name, value);
+inline bool SubscriptionRequest_Action_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SubscriptionRequest_Action* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SubscriptionRequest_Action>(
+    SubscriptionRequest_Action_descriptor(), name, value);
 }
-
 // ===================================================================
 
-
-// -------------------------------------------------------------------
-
-class SubscriptionRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:marketdata.SubscriptionRequest) */ {
+class SubscriptionRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:marketdata.SubscriptionRequest) */ {
  public:
   inline SubscriptionRequest() : SubscriptionRequest(nullptr) {}
-  ~SubscriptionRequest() PROTOBUF_FINAL;
+  ~SubscriptionRequest() override;
+  explicit PROTOBUF_CONSTEXPR SubscriptionRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(SubscriptionRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(SubscriptionRequest));
+  SubscriptionRequest(const SubscriptionRequest& from);
+  SubscriptionRequest(SubscriptionRequest&& from) noexcept
+    : SubscriptionRequest() {
+    *this = ::std::move(from);
   }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR SubscriptionRequest(
-      ::google::protobuf::internal::ConstantInitialized);
 
-  inline SubscriptionRequest(const SubscriptionRequest& from) : SubscriptionRequest(nullptr, from) {}
-  inline SubscriptionRequest(SubscriptionRequest&& from) noexcept
-      : SubscriptionRequest(nullptr, std::move(from)) {}
   inline SubscriptionRequest& operator=(const SubscriptionRequest& from) {
     CopyFrom(from);
     return *this;
   }
   inline SubscriptionRequest& operator=(SubscriptionRequest&& from) noexcept {
     if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -148,22 +160,13 @@ class SubscriptionRequest final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
   static const SubscriptionRequest& default_instance() {
@@ -171,203 +174,242 @@ class SubscriptionRequest final : public ::google::protobuf::Message
   }
   static inline const SubscriptionRequest* internal_default_instance() {
     return reinterpret_cast<const SubscriptionRequest*>(
-        &_SubscriptionRequest_default_instance_);
+               &_SubscriptionRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(SubscriptionRequest& a, SubscriptionRequest& b) {
+    a.Swap(&b);
   }
-  static constexpr int kIndexInFileMessages = 0;
-  friend void swap(SubscriptionRequest& a, SubscriptionRequest& b) { a.Swap(&b); }
   inline void Swap(SubscriptionRequest* other) {
     if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
   void UnsafeArenaSwap(SubscriptionRequest* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  SubscriptionRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<SubscriptionRequest>(arena);
+  SubscriptionRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubscriptionRequest>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SubscriptionRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const SubscriptionRequest& from) { SubscriptionRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SubscriptionRequest& from) {
+    SubscriptionRequest::MergeImpl(*this, from);
   }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
   private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
   void InternalSwap(SubscriptionRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "marketdata.SubscriptionRequest"; }
-
- protected:
-  explicit SubscriptionRequest(::google::protobuf::Arena* arena);
-  SubscriptionRequest(::google::protobuf::Arena* arena, const SubscriptionRequest& from);
-  SubscriptionRequest(::google::protobuf::Arena* arena, SubscriptionRequest&& from) noexcept
-      : SubscriptionRequest(arena) {
-    *this = ::std::move(from);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "marketdata.SubscriptionRequest";
   }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+  protected:
+  explicit SubscriptionRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
   // nested types ----------------------------------------------------
-  using Action = SubscriptionRequest_Action;
-  static constexpr Action SUBSCRIBE = SubscriptionRequest_Action_SUBSCRIBE;
-  static constexpr Action UNSUBSCRIBE = SubscriptionRequest_Action_UNSUBSCRIBE;
+
+  typedef SubscriptionRequest_Action Action;
+  static constexpr Action SUBSCRIBE =
+    SubscriptionRequest_Action_SUBSCRIBE;
+  static constexpr Action UNSUBSCRIBE =
+    SubscriptionRequest_Action_UNSUBSCRIBE;
+  static constexpr Action SNAPSHOT =
+    SubscriptionRequest_Action_SNAPSHOT;
+  static constexpr Action SNAPSHOT_ONLY =
+    SubscriptionRequest_Action_SNAPSHOT_ONLY;
   static inline bool Action_IsValid(int value) {
     return SubscriptionRequest_Action_IsValid(value);
   }
-  static constexpr Action Action_MIN = SubscriptionRequest_Action_Action_MIN;
-  static constexpr Action Action_MAX = SubscriptionRequest_Action_Action_MAX;
-  static constexpr int Action_ARRAYSIZE = SubscriptionRequest_Action_Action_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor* Action_descriptor() {
+  static constexpr Action Action_MIN =
+    SubscriptionRequest_Action_Action_MIN;
+  static constexpr Action Action_MAX =
+    SubscriptionRequest_Action_Action_MAX;
+  static constexpr int Action_ARRAYSIZE =
+    SubscriptionRequest_Action_Action_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Action_descriptor() {
     return SubscriptionRequest_Action_descriptor();
   }
-  template <typename T>
-  static inline const std::string& Action_Name(T value) {
-    return SubscriptionRequest_Action_Name(value);
+  template<typename T>
+  static inline const std::string& Action_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Action>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Action_Name.");
+    return SubscriptionRequest_Action_Name(enum_t_value);
   }
-  static inline bool Action_Parse(absl::string_view name, Action* value) {
+  static inline bool Action_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Action* value) {
     return SubscriptionRequest_Action_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
+
   enum : int {
+    kInstrumentIdsFieldNumber = 6,
     kInstrumentIdFieldNumber = 2,
     kActionFieldNumber = 1,
+    kConflateFieldNumber = 3,
+    kMaxUpdatesPerSecondFieldNumber = 4,
+    kDepthFieldNumber = 5,
   };
+  // repeated string instrument_ids = 6;
+  int instrument_ids_size() const;
+  private:
+  int _internal_instrument_ids_size() const;
+  public:
+  void clear_instrument_ids();
+  const std::string& instrument_ids(int index) const;
+  std::string* mutable_instrument_ids(int index);
+  void set_instrument_ids(int index, const std::string& value);
+  void set_instrument_ids(int index, std::string&& value);
+  void set_instrument_ids(int index, const char* value);
+  void set_instrument_ids(int index, const char* value, size_t size);
+  std::string* add_instrument_ids();
+  void add_instrument_ids(const std::string& value);
+  void add_instrument_ids(std::string&& value);
+  void add_instrument_ids(const char* value);
+  void add_instrument_ids(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& instrument_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_instrument_ids();
+  private:
+  const std::string& _internal_instrument_ids(int index) const;
+  std::string* _internal_add_instrument_ids();
+  public:
+
   // string instrument_id = 2;
-  void clear_instrument_id() ;
+  void clear_instrument_id();
   const std::string& instrument_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_instrument_id(Arg_&& arg, Args_... args);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_instrument_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_instrument_id();
   PROTOBUF_NODISCARD std::string* release_instrument_id();
-  void set_allocated_instrument_id(std::string* value);
-
+  void set_allocated_instrument_id(std::string* instrument_id);
   private:
   const std::string& _internal_instrument_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_instrument_id(
-      const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_instrument_id(const std::string& value);
   std::string* _internal_mutable_instrument_id();
-
   public:
+
   // .marketdata.SubscriptionRequest.Action action = 1;
-  void clear_action() ;
+  void clear_action();
   ::marketdata::SubscriptionRequest_Action action() const;
   void set_action(::marketdata::SubscriptionRequest_Action value);
-
   private:
   ::marketdata::SubscriptionRequest_Action _internal_action() const;
   void _internal_set_action(::marketdata::SubscriptionRequest_Action value);
+  public:
+
+  // bool conflate = 3;
+  void clear_conflate();
+  bool conflate() const;
+  void set_conflate(bool value);
+  private:
+  bool _internal_conflate() const;
+  void _internal_set_conflate(bool value);
+  public:
+
+  // uint32 max_updates_per_second = 4;
+  void clear_max_updates_per_second();
+  uint32_t max_updates_per_second() const;
+  void set_max_updates_per_second(uint32_t value);
+  private:
+  uint32_t _internal_max_updates_per_second() const;
+  void _internal_set_max_updates_per_second(uint32_t value);
+  public:
 
+  // uint32 depth = 5;
+  void clear_depth();
+  uint32_t depth() const;
+  void set_depth(uint32_t value);
+  private:
+  uint32_t _internal_depth() const;
+  void _internal_set_depth(uint32_t value);
   public:
+
   // @@protoc_insertion_point(class_scope:marketdata.SubscriptionRequest)
  private:
   class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      52, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const SubscriptionRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr instrument_id_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> instrument_ids_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr instrument_id_;
     int action_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    bool conflate_;
+    uint32_t max_updates_per_second_;
+    uint32_t depth_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_market_5fdata_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PriceLevel final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:marketdata.PriceLevel) */ {
+class MarketDataUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:marketdata.MarketDataUpdate) */ {
  public:
-  inline PriceLevel() : PriceLevel(nullptr) {}
-  ~PriceLevel() PROTOBUF_FINAL;
+  inline MarketDataUpdate() : MarketDataUpdate(nullptr) {}
+  ~MarketDataUpdate() override;
+  explicit PROTOBUF_CONSTEXPR MarketDataUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(PriceLevel* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(PriceLevel));
+  MarketDataUpdate(const MarketDataUpdate& from);
+  MarketDataUpdate(MarketDataUpdate&& from) noexcept
+    : MarketDataUpdate() {
+    *this = ::std::move(from);
   }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR PriceLevel(
-      ::google::protobuf::internal::ConstantInitialized);
 
-  inline PriceLevel(const PriceLevel& from) : PriceLevel(nullptr, from) {}
-  inline PriceLevel(PriceLevel&& from) noexcept
-      : PriceLevel(nullptr, std::move(from)) {}
-  inline PriceLevel& operator=(const PriceLevel& from) {
+  inline MarketDataUpdate& operator=(const MarketDataUpdate& from) {
     CopyFrom(from);
     return *this;
   }
-  inline PriceLevel& operator=(PriceLevel&& from) noexcept {
+  inline MarketDataUpdate& operator=(MarketDataUpdate&& from) noexcept {
     if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -375,201 +417,239 @@ class PriceLevel final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const PriceLevel& default_instance() {
+  static const MarketDataUpdate& default_instance() {
     return *internal_default_instance();
   }
-  static inline const PriceLevel* internal_default_instance() {
-    return reinterpret_cast<const PriceLevel*>(
-        &_PriceLevel_default_instance_);
+  enum UpdateTypeCase {
+    kSnapshot = 1,
+    kIncrementalUpdate = 2,
+    kSymbolDirectory = 3,
+    kBatch = 4,
+    UPDATE_TYPE_NOT_SET = 0,
+  };
+
+  static inline const MarketDataUpdate* internal_default_instance() {
+    return reinterpret_cast<const MarketDataUpdate*>(
+               &_MarketDataUpdate_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 4;
-  friend void swap(PriceLevel& a, PriceLevel& b) { a.Swap(&b); }
-  inline void Swap(PriceLevel* other) {
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(MarketDataUpdate& a, MarketDataUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MarketDataUpdate* other) {
     if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(PriceLevel* other) {
+  void UnsafeArenaSwap(MarketDataUpdate* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  PriceLevel* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<PriceLevel>(arena);
+  MarketDataUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MarketDataUpdate>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const PriceLevel& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const PriceLevel& from) { PriceLevel::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MarketDataUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MarketDataUpdate& from) {
+    MarketDataUpdate::MergeImpl(*this, from);
   }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
   private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(PriceLevel* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "marketdata.PriceLevel"; }
-
- protected:
-  explicit PriceLevel(::google::protobuf::Arena* arena);
-  PriceLevel(::google::protobuf::Arena* arena, const PriceLevel& from);
-  PriceLevel(::google::protobuf::Arena* arena, PriceLevel&& from) noexcept
-      : PriceLevel(arena) {
-    *this = ::std::move(from);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MarketDataUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "marketdata.MarketDataUpdate";
   }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+  protected:
+  explicit MarketDataUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
+
   enum : int {
-    kPriceFieldNumber = 1,
-    kQuantityFieldNumber = 2,
+    kSnapshotFieldNumber = 1,
+    kIncrementalUpdateFieldNumber = 2,
+    kSymbolDirectoryFieldNumber = 3,
+    kBatchFieldNumber = 4,
   };
-  // double price = 1;
-  void clear_price() ;
-  double price() const;
-  void set_price(double value);
-
+  // .marketdata.OrderBookSnapshot snapshot = 1;
+  bool has_snapshot() const;
   private:
-  double _internal_price() const;
-  void _internal_set_price(double value);
+  bool _internal_has_snapshot() const;
+  public:
+  void clear_snapshot();
+  const ::marketdata::OrderBookSnapshot& snapshot() const;
+  PROTOBUF_NODISCARD ::marketdata::OrderBookSnapshot* release_snapshot();
+  ::marketdata::OrderBookSnapshot* mutable_snapshot();
+  void set_allocated_snapshot(::marketdata::OrderBookSnapshot* snapshot);
+  private:
+  const ::marketdata::OrderBookSnapshot& _internal_snapshot() const;
+  ::marketdata::OrderBookSnapshot* _internal_mutable_snapshot();
+  public:
+  void unsafe_arena_set_allocated_snapshot(
+      ::marketdata::OrderBookSnapshot* snapshot);
+  ::marketdata::OrderBookSnapshot* unsafe_arena_release_snapshot();
 
+  // .marketdata.OrderBookIncrementalUpdate incremental_update = 2;
+  bool has_incremental_update() const;
+  private:
+  bool _internal_has_incremental_update() const;
   public:
-  // double quantity = 2;
-  void clear_quantity() ;
-  double quantity() const;
-  void set_quantity(double value);
+  void clear_incremental_update();
+  const ::marketdata::OrderBookIncrementalUpdate& incremental_update() const;
+  PROTOBUF_NODISCARD ::marketdata::OrderBookIncrementalUpdate* release_incremental_update();
+  ::marketdata::OrderBookIncrementalUpdate* mutable_incremental_update();
+  void set_allocated_incremental_update(::marketdata::OrderBookIncrementalUpdate* incremental_update);
+  private:
+  const ::marketdata::OrderBookIncrementalUpdate& _internal_incremental_update() const;
+  ::marketdata::OrderBookIncrementalUpdate* _internal_mutable_incremental_update();
+  public:
+  void unsafe_arena_set_allocated_incremental_update(
+      ::marketdata::OrderBookIncrementalUpdate* incremental_update);
+  ::marketdata::OrderBookIncrementalUpdate* unsafe_arena_release_incremental_update();
 
+  // .marketdata.SymbolDirectory symbol_directory = 3;
+  bool has_symbol_directory() const;
   private:
-  double _internal_quantity() const;
-  void _internal_set_quantity(double value);
+  bool _internal_has_symbol_directory() const;
+  public:
+  void clear_symbol_directory();
+  const ::marketdata::SymbolDirectory& symbol_directory() const;
+  PROTOBUF_NODISCARD ::marketdata::SymbolDirectory* release_symbol_directory();
+  ::marketdata::SymbolDirectory* mutable_symbol_directory();
+  void set_allocated_symbol_directory(::marketdata::SymbolDirectory* symbol_directory);
+  private:
+  const ::marketdata::SymbolDirectory& _internal_symbol_directory() const;
+  ::marketdata::SymbolDirectory* _internal_mutable_symbol_directory();
+  public:
+  void unsafe_arena_set_allocated_symbol_directory(
+      ::marketdata::SymbolDirectory* symbol_directory);
+  ::marketdata::SymbolDirectory* unsafe_arena_release_symbol_directory();
 
+  // .marketdata.MarketDataBatch batch = 4;
+  bool has_batch() const;
+  private:
+  bool _internal_has_batch() const;
   public:
-  // @@protoc_insertion_point(class_scope:marketdata.PriceLevel)
+  void clear_batch();
+  const ::marketdata::MarketDataBatch& batch() const;
+  PROTOBUF_NODISCARD ::marketdata::MarketDataBatch* release_batch();
+  ::marketdata::MarketDataBatch* mutable_batch();
+  void set_allocated_batch(::marketdata::MarketDataBatch* batch);
+  private:
+  const ::marketdata::MarketDataBatch& _internal_batch() const;
+  ::marketdata::MarketDataBatch* _internal_mutable_batch();
+  public:
+  void unsafe_arena_set_allocated_batch(
+      ::marketdata::MarketDataBatch* batch);
+  ::marketdata::MarketDataBatch* unsafe_arena_release_batch();
+
+  void clear_update_type();
+  UpdateTypeCase update_type_case() const;
+  // @@protoc_insertion_point(class_scope:marketdata.MarketDataUpdate)
  private:
   class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      0, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+  void set_has_snapshot();
+  void set_has_incremental_update();
+  void set_has_symbol_directory();
+  void set_has_batch();
+
+  inline bool has_update_type() const;
+  inline void clear_has_update_type();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const PriceLevel& from_msg);
-    double price_;
-    double quantity_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    union UpdateTypeUnion {
+      constexpr UpdateTypeUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::marketdata::OrderBookSnapshot* snapshot_;
+      ::marketdata::OrderBookIncrementalUpdate* incremental_update_;
+      ::marketdata::SymbolDirectory* symbol_directory_;
+      ::marketdata::MarketDataBatch* batch_;
+    } update_type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_market_5fdata_2eproto;
 };
 // -------------------------------------------------------------------
 
-class OrderBookSnapshot final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:marketdata.OrderBookSnapshot) */ {
+class MarketDataBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:marketdata.MarketDataBatch) */ {
  public:
-  inline OrderBookSnapshot() : OrderBookSnapshot(nullptr) {}
-  ~OrderBookSnapshot() PROTOBUF_FINAL;
+  inline MarketDataBatch() : MarketDataBatch(nullptr) {}
+  ~MarketDataBatch() override;
+  explicit PROTOBUF_CONSTEXPR MarketDataBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(OrderBookSnapshot* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(OrderBookSnapshot));
+  MarketDataBatch(const MarketDataBatch& from);
+  MarketDataBatch(MarketDataBatch&& from) noexcept
+    : MarketDataBatch() {
+    *this = ::std::move(from);
   }
-#endif
 
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR OrderBookSnapshot(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline OrderBookSnapshot(const OrderBookSnapshot& from) : OrderBookSnapshot(nullptr, from) {}
-  inline OrderBookSnapshot(OrderBookSnapshot&& from) noexcept
-      : OrderBookSnapshot(nullptr, std::move(from)) {}
-  inline OrderBookSnapshot& operator=(const OrderBookSnapshot& from) {
+  inline MarketDataBatch& operator=(const MarketDataBatch& from) {
     CopyFrom(from);
     return *this;
   }
-  inline OrderBookSnapshot& operator=(OrderBookSnapshot&& from) noexcept {
+  inline MarketDataBatch& operator=(MarketDataBatch&& from) noexcept {
     if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -577,233 +657,156 @@ class OrderBookSnapshot final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const OrderBookSnapshot& default_instance() {
+  static const MarketDataBatch& default_instance() {
     return *internal_default_instance();
   }
-  static inline const OrderBookSnapshot* internal_default_instance() {
-    return reinterpret_cast<const OrderBookSnapshot*>(
-        &_OrderBookSnapshot_default_instance_);
+  static inline const MarketDataBatch* internal_default_instance() {
+    return reinterpret_cast<const MarketDataBatch*>(
+               &_MarketDataBatch_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 2;
-  friend void swap(OrderBookSnapshot& a, OrderBookSnapshot& b) { a.Swap(&b); }
-  inline void Swap(OrderBookSnapshot* other) {
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(MarketDataBatch& a, MarketDataBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MarketDataBatch* other) {
     if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(OrderBookSnapshot* other) {
+  void UnsafeArenaSwap(MarketDataBatch* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  OrderBookSnapshot* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<OrderBookSnapshot>(arena);
+  MarketDataBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MarketDataBatch>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const OrderBookSnapshot& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const OrderBookSnapshot& from) { OrderBookSnapshot::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MarketDataBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MarketDataBatch& from) {
+    MarketDataBatch::MergeImpl(*this, from);
   }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
   private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(OrderBookSnapshot* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "marketdata.OrderBookSnapshot"; }
-
- protected:
-  explicit OrderBookSnapshot(::google::protobuf::Arena* arena);
-  OrderBookSnapshot(::google::protobuf::Arena* arena, const OrderBookSnapshot& from);
-  OrderBookSnapshot(::google::protobuf::Arena* arena, OrderBookSnapshot&& from) noexcept
-      : OrderBookSnapshot(arena) {
-    *this = ::std::move(from);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MarketDataBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "marketdata.MarketDataBatch";
   }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+  protected:
+  explicit MarketDataBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
+
   enum : int {
-    kBidsFieldNumber = 2,
-    kAsksFieldNumber = 3,
-    kInstrumentIdFieldNumber = 1,
+    kUpdatesFieldNumber = 1,
   };
-  // repeated .marketdata.PriceLevel bids = 2;
-  int bids_size() const;
-  private:
-  int _internal_bids_size() const;
-
-  public:
-  void clear_bids() ;
-  ::marketdata::PriceLevel* mutable_bids(int index);
-  ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>* mutable_bids();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>& _internal_bids() const;
-  ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>* _internal_mutable_bids();
-  public:
-  const ::marketdata::PriceLevel& bids(int index) const;
-  ::marketdata::PriceLevel* add_bids();
-  const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>& bids() const;
-  // repeated .marketdata.PriceLevel asks = 3;
-  int asks_size() const;
+  // repeated .marketdata.MarketDataUpdate updates = 1;
+  int updates_size() const;
   private:
-  int _internal_asks_size() const;
-
+  int _internal_updates_size() const;
   public:
-  void clear_asks() ;
-  ::marketdata::PriceLevel* mutable_asks(int index);
-  ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>* mutable_asks();
-
+  void clear_updates();
+  ::marketdata::MarketDataUpdate* mutable_updates(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::MarketDataUpdate >*
+      mutable_updates();
   private:
-  const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>& _internal_asks() const;
-  ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>* _internal_mutable_asks();
+  const ::marketdata::MarketDataUpdate& _internal_updates(int index) const;
+  ::marketdata::MarketDataUpdate* _internal_add_updates();
   public:
-  const ::marketdata::PriceLevel& asks(int index) const;
-  ::marketdata::PriceLevel* add_asks();
-  const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>& asks() const;
-  // string instrument_id = 1;
-  void clear_instrument_id() ;
-  const std::string& instrument_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_instrument_id(Arg_&& arg, Args_... args);
-  std::string* mutable_instrument_id();
-  PROTOBUF_NODISCARD std::string* release_instrument_id();
-  void set_allocated_instrument_id(std::string* value);
-
-  private:
-  const std::string& _internal_instrument_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_instrument_id(
-      const std::string& value);
-  std::string* _internal_mutable_instrument_id();
+  const ::marketdata::MarketDataUpdate& updates(int index) const;
+  ::marketdata::MarketDataUpdate* add_updates();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::MarketDataUpdate >&
+      updates() const;
 
-  public:
-  // @@protoc_insertion_point(class_scope:marketdata.OrderBookSnapshot)
+  // @@protoc_insertion_point(class_scope:marketdata.MarketDataBatch)
  private:
   class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 3, 2,
-      50, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const OrderBookSnapshot& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::marketdata::PriceLevel > bids_;
-    ::google::protobuf::RepeatedPtrField< ::marketdata::PriceLevel > asks_;
-    ::google::protobuf::internal::ArenaStringPtr instrument_id_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::MarketDataUpdate > updates_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_market_5fdata_2eproto;
 };
 // -------------------------------------------------------------------
 
-class OrderBookIncrementalUpdate final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:marketdata.OrderBookIncrementalUpdate) */ {
+class SymbolDirectory_Entry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:marketdata.SymbolDirectory.Entry) */ {
  public:
-  inline OrderBookIncrementalUpdate() : OrderBookIncrementalUpdate(nullptr) {}
-  ~OrderBookIncrementalUpdate() PROTOBUF_FINAL;
+  inline SymbolDirectory_Entry() : SymbolDirectory_Entry(nullptr) {}
+  ~SymbolDirectory_Entry() override;
+  explicit PROTOBUF_CONSTEXPR SymbolDirectory_Entry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(OrderBookIncrementalUpdate* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(OrderBookIncrementalUpdate));
+  SymbolDirectory_Entry(const SymbolDirectory_Entry& from);
+  SymbolDirectory_Entry(SymbolDirectory_Entry&& from) noexcept
+    : SymbolDirectory_Entry() {
+    *this = ::std::move(from);
   }
-#endif
 
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR OrderBookIncrementalUpdate(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline OrderBookIncrementalUpdate(const OrderBookIncrementalUpdate& from) : OrderBookIncrementalUpdate(nullptr, from) {}
-  inline OrderBookIncrementalUpdate(OrderBookIncrementalUpdate&& from) noexcept
-      : OrderBookIncrementalUpdate(nullptr, std::move(from)) {}
-  inline OrderBookIncrementalUpdate& operator=(const OrderBookIncrementalUpdate& from) {
+  inline SymbolDirectory_Entry& operator=(const SymbolDirectory_Entry& from) {
     CopyFrom(from);
     return *this;
   }
-  inline OrderBookIncrementalUpdate& operator=(OrderBookIncrementalUpdate&& from) noexcept {
+  inline SymbolDirectory_Entry& operator=(SymbolDirectory_Entry&& from) noexcept {
     if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -811,233 +814,322 @@ class OrderBookIncrementalUpdate final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const OrderBookIncrementalUpdate& default_instance() {
+  static const SymbolDirectory_Entry& default_instance() {
     return *internal_default_instance();
   }
-  static inline const OrderBookIncrementalUpdate* internal_default_instance() {
-    return reinterpret_cast<const OrderBookIncrementalUpdate*>(
-        &_OrderBookIncrementalUpdate_default_instance_);
+  static inline const SymbolDirectory_Entry* internal_default_instance() {
+    return reinterpret_cast<const SymbolDirectory_Entry*>(
+               &_SymbolDirectory_Entry_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 3;
-  friend void swap(OrderBookIncrementalUpdate& a, OrderBookIncrementalUpdate& b) { a.Swap(&b); }
-  inline void Swap(OrderBookIncrementalUpdate* other) {
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(SymbolDirectory_Entry& a, SymbolDirectory_Entry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SymbolDirectory_Entry* other) {
     if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(OrderBookIncrementalUpdate* other) {
+  void UnsafeArenaSwap(SymbolDirectory_Entry* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  OrderBookIncrementalUpdate* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<OrderBookIncrementalUpdate>(arena);
+  SymbolDirectory_Entry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SymbolDirectory_Entry>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const OrderBookIncrementalUpdate& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const OrderBookIncrementalUpdate& from) { OrderBookIncrementalUpdate::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SymbolDirectory_Entry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SymbolDirectory_Entry& from) {
+    SymbolDirectory_Entry::MergeImpl(*this, from);
   }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
   private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(OrderBookIncrementalUpdate* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "marketdata.OrderBookIncrementalUpdate"; }
-
- protected:
-  explicit OrderBookIncrementalUpdate(::google::protobuf::Arena* arena);
-  OrderBookIncrementalUpdate(::google::protobuf::Arena* arena, const OrderBookIncrementalUpdate& from);
-  OrderBookIncrementalUpdate(::google::protobuf::Arena* arena, OrderBookIncrementalUpdate&& from) noexcept
-      : OrderBookIncrementalUpdate(arena) {
-    *this = ::std::move(from);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SymbolDirectory_Entry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "marketdata.SymbolDirectory.Entry";
   }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+  protected:
+  explicit SymbolDirectory_Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
+
   enum : int {
-    kBidUpdatesFieldNumber = 2,
-    kAskUpdatesFieldNumber = 3,
     kInstrumentIdFieldNumber = 1,
+    kInstrumentHandleFieldNumber = 2,
   };
-  // repeated .marketdata.PriceLevel bid_updates = 2;
-  int bid_updates_size() const;
+  // string instrument_id = 1;
+  void clear_instrument_id();
+  const std::string& instrument_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_instrument_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_instrument_id();
+  PROTOBUF_NODISCARD std::string* release_instrument_id();
+  void set_allocated_instrument_id(std::string* instrument_id);
   private:
-  int _internal_bid_updates_size() const;
+  const std::string& _internal_instrument_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_instrument_id(const std::string& value);
+  std::string* _internal_mutable_instrument_id();
+  public:
 
+  // uint32 instrument_handle = 2;
+  void clear_instrument_handle();
+  uint32_t instrument_handle() const;
+  void set_instrument_handle(uint32_t value);
+  private:
+  uint32_t _internal_instrument_handle() const;
+  void _internal_set_instrument_handle(uint32_t value);
   public:
-  void clear_bid_updates() ;
-  ::marketdata::PriceLevel* mutable_bid_updates(int index);
-  ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>* mutable_bid_updates();
 
+  // @@protoc_insertion_point(class_scope:marketdata.SymbolDirectory.Entry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr instrument_id_;
+    uint32_t instrument_handle_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_market_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SymbolDirectory final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:marketdata.SymbolDirectory) */ {
+ public:
+  inline SymbolDirectory() : SymbolDirectory(nullptr) {}
+  ~SymbolDirectory() override;
+  explicit PROTOBUF_CONSTEXPR SymbolDirectory(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SymbolDirectory(const SymbolDirectory& from);
+  SymbolDirectory(SymbolDirectory&& from) noexcept
+    : SymbolDirectory() {
+    *this = ::std::move(from);
+  }
+
+  inline SymbolDirectory& operator=(const SymbolDirectory& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SymbolDirectory& operator=(SymbolDirectory&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SymbolDirectory& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SymbolDirectory* internal_default_instance() {
+    return reinterpret_cast<const SymbolDirectory*>(
+               &_SymbolDirectory_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(SymbolDirectory& a, SymbolDirectory& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SymbolDirectory* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SymbolDirectory* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SymbolDirectory* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SymbolDirectory>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SymbolDirectory& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SymbolDirectory& from) {
+    SymbolDirectory::MergeImpl(*this, from);
+  }
   private:
-  const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>& _internal_bid_updates() const;
-  ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>* _internal_mutable_bid_updates();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  const ::marketdata::PriceLevel& bid_updates(int index) const;
-  ::marketdata::PriceLevel* add_bid_updates();
-  const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>& bid_updates() const;
-  // repeated .marketdata.PriceLevel ask_updates = 3;
-  int ask_updates_size() const;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  int _internal_ask_updates_size() const;
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SymbolDirectory* other);
 
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "marketdata.SymbolDirectory";
+  }
+  protected:
+  explicit SymbolDirectory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  void clear_ask_updates() ;
-  ::marketdata::PriceLevel* mutable_ask_updates(int index);
-  ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>* mutable_ask_updates();
 
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef SymbolDirectory_Entry Entry;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 1,
+  };
+  // repeated .marketdata.SymbolDirectory.Entry entries = 1;
+  int entries_size() const;
   private:
-  const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>& _internal_ask_updates() const;
-  ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>* _internal_mutable_ask_updates();
+  int _internal_entries_size() const;
   public:
-  const ::marketdata::PriceLevel& ask_updates(int index) const;
-  ::marketdata::PriceLevel* add_ask_updates();
-  const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>& ask_updates() const;
-  // string instrument_id = 1;
-  void clear_instrument_id() ;
-  const std::string& instrument_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_instrument_id(Arg_&& arg, Args_... args);
-  std::string* mutable_instrument_id();
-  PROTOBUF_NODISCARD std::string* release_instrument_id();
-  void set_allocated_instrument_id(std::string* value);
-
+  void clear_entries();
+  ::marketdata::SymbolDirectory_Entry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::SymbolDirectory_Entry >*
+      mutable_entries();
   private:
-  const std::string& _internal_instrument_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_instrument_id(
-      const std::string& value);
-  std::string* _internal_mutable_instrument_id();
-
+  const ::marketdata::SymbolDirectory_Entry& _internal_entries(int index) const;
+  ::marketdata::SymbolDirectory_Entry* _internal_add_entries();
   public:
-  // @@protoc_insertion_point(class_scope:marketdata.OrderBookIncrementalUpdate)
+  const ::marketdata::SymbolDirectory_Entry& entries(int index) const;
+  ::marketdata::SymbolDirectory_Entry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::SymbolDirectory_Entry >&
+      entries() const;
+
+  // @@protoc_insertion_point(class_scope:marketdata.SymbolDirectory)
  private:
   class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 3, 2,
-      59, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const OrderBookIncrementalUpdate& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::marketdata::PriceLevel > bid_updates_;
-    ::google::protobuf::RepeatedPtrField< ::marketdata::PriceLevel > ask_updates_;
-    ::google::protobuf::internal::ArenaStringPtr instrument_id_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::SymbolDirectory_Entry > entries_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_market_5fdata_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MarketDataUpdate final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:marketdata.MarketDataUpdate) */ {
+class OrderBookSnapshot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:marketdata.OrderBookSnapshot) */ {
  public:
-  inline MarketDataUpdate() : MarketDataUpdate(nullptr) {}
-  ~MarketDataUpdate() PROTOBUF_FINAL;
+  inline OrderBookSnapshot() : OrderBookSnapshot(nullptr) {}
+  ~OrderBookSnapshot() override;
+  explicit PROTOBUF_CONSTEXPR OrderBookSnapshot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(MarketDataUpdate* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(MarketDataUpdate));
+  OrderBookSnapshot(const OrderBookSnapshot& from);
+  OrderBookSnapshot(OrderBookSnapshot&& from) noexcept
+    : OrderBookSnapshot() {
+    *this = ::std::move(from);
   }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR MarketDataUpdate(
-      ::google::protobuf::internal::ConstantInitialized);
 
-  inline MarketDataUpdate(const MarketDataUpdate& from) : MarketDataUpdate(nullptr, from) {}
-  inline MarketDataUpdate(MarketDataUpdate&& from) noexcept
-      : MarketDataUpdate(nullptr, std::move(from)) {}
-  inline MarketDataUpdate& operator=(const MarketDataUpdate& from) {
+  inline OrderBookSnapshot& operator=(const OrderBookSnapshot& from) {
     CopyFrom(from);
     return *this;
   }
-  inline MarketDataUpdate& operator=(MarketDataUpdate&& from) noexcept {
+  inline OrderBookSnapshot& operator=(OrderBookSnapshot&& from) noexcept {
     if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -1045,835 +1137,3446 @@ class MarketDataUpdate final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const MarketDataUpdate& default_instance() {
+  static const OrderBookSnapshot& default_instance() {
     return *internal_default_instance();
   }
-  enum UpdateTypeCase {
-    kSnapshot = 1,
-    kIncrementalUpdate = 2,
-    UPDATE_TYPE_NOT_SET = 0,
-  };
-  static inline const MarketDataUpdate* internal_default_instance() {
-    return reinterpret_cast<const MarketDataUpdate*>(
-        &_MarketDataUpdate_default_instance_);
+  static inline const OrderBookSnapshot* internal_default_instance() {
+    return reinterpret_cast<const OrderBookSnapshot*>(
+               &_OrderBookSnapshot_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 1;
-  friend void swap(MarketDataUpdate& a, MarketDataUpdate& b) { a.Swap(&b); }
-  inline void Swap(MarketDataUpdate* other) {
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(OrderBookSnapshot& a, OrderBookSnapshot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OrderBookSnapshot* other) {
     if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(MarketDataUpdate* other) {
+  void UnsafeArenaSwap(OrderBookSnapshot* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  MarketDataUpdate* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<MarketDataUpdate>(arena);
+  OrderBookSnapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OrderBookSnapshot>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const MarketDataUpdate& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const MarketDataUpdate& from) { MarketDataUpdate::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OrderBookSnapshot& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OrderBookSnapshot& from) {
+    OrderBookSnapshot::MergeImpl(*this, from);
   }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
   private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(MarketDataUpdate* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "marketdata.MarketDataUpdate"; }
-
- protected:
-  explicit MarketDataUpdate(::google::protobuf::Arena* arena);
-  MarketDataUpdate(::google::protobuf::Arena* arena, const MarketDataUpdate& from);
-  MarketDataUpdate(::google::protobuf::Arena* arena, MarketDataUpdate&& from) noexcept
-      : MarketDataUpdate(arena) {
-    *this = ::std::move(from);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OrderBookSnapshot* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "marketdata.OrderBookSnapshot";
   }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+  protected:
+  explicit OrderBookSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
+
   enum : int {
-    kSnapshotFieldNumber = 1,
-    kIncrementalUpdateFieldNumber = 2,
+    kBidsFieldNumber = 2,
+    kAsksFieldNumber = 3,
+    kInstrumentIdFieldNumber = 1,
+    kTickSizeFieldNumber = 4,
+    kLotSizeFieldNumber = 5,
+    kSequenceFieldNumber = 6,
   };
-  // .marketdata.OrderBookSnapshot snapshot = 1;
-  bool has_snapshot() const;
+  // repeated .marketdata.PriceLevel bids = 2;
+  int bids_size() const;
   private:
-  bool _internal_has_snapshot() const;
-
+  int _internal_bids_size() const;
   public:
-  void clear_snapshot() ;
-  const ::marketdata::OrderBookSnapshot& snapshot() const;
-  PROTOBUF_NODISCARD ::marketdata::OrderBookSnapshot* release_snapshot();
-  ::marketdata::OrderBookSnapshot* mutable_snapshot();
-  void set_allocated_snapshot(::marketdata::OrderBookSnapshot* value);
-  void unsafe_arena_set_allocated_snapshot(::marketdata::OrderBookSnapshot* value);
-  ::marketdata::OrderBookSnapshot* unsafe_arena_release_snapshot();
-
+  void clear_bids();
+  ::marketdata::PriceLevel* mutable_bids(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >*
+      mutable_bids();
   private:
-  const ::marketdata::OrderBookSnapshot& _internal_snapshot() const;
-  ::marketdata::OrderBookSnapshot* _internal_mutable_snapshot();
+  const ::marketdata::PriceLevel& _internal_bids(int index) const;
+  ::marketdata::PriceLevel* _internal_add_bids();
+  public:
+  const ::marketdata::PriceLevel& bids(int index) const;
+  ::marketdata::PriceLevel* add_bids();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >&
+      bids() const;
 
+  // repeated .marketdata.PriceLevel asks = 3;
+  int asks_size() const;
+  private:
+  int _internal_asks_size() const;
   public:
-  // .marketdata.OrderBookIncrementalUpdate incremental_update = 2;
-  bool has_incremental_update() const;
+  void clear_asks();
+  ::marketdata::PriceLevel* mutable_asks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >*
+      mutable_asks();
   private:
-  bool _internal_has_incremental_update() const;
+  const ::marketdata::PriceLevel& _internal_asks(int index) const;
+  ::marketdata::PriceLevel* _internal_add_asks();
+  public:
+  const ::marketdata::PriceLevel& asks(int index) const;
+  ::marketdata::PriceLevel* add_asks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >&
+      asks() const;
 
+  // string instrument_id = 1;
+  void clear_instrument_id();
+  const std::string& instrument_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_instrument_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_instrument_id();
+  PROTOBUF_NODISCARD std::string* release_instrument_id();
+  void set_allocated_instrument_id(std::string* instrument_id);
+  private:
+  const std::string& _internal_instrument_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_instrument_id(const std::string& value);
+  std::string* _internal_mutable_instrument_id();
   public:
-  void clear_incremental_update() ;
-  const ::marketdata::OrderBookIncrementalUpdate& incremental_update() const;
-  PROTOBUF_NODISCARD ::marketdata::OrderBookIncrementalUpdate* release_incremental_update();
-  ::marketdata::OrderBookIncrementalUpdate* mutable_incremental_update();
-  void set_allocated_incremental_update(::marketdata::OrderBookIncrementalUpdate* value);
-  void unsafe_arena_set_allocated_incremental_update(::marketdata::OrderBookIncrementalUpdate* value);
-  ::marketdata::OrderBookIncrementalUpdate* unsafe_arena_release_incremental_update();
 
+  // double tick_size = 4;
+  void clear_tick_size();
+  double tick_size() const;
+  void set_tick_size(double value);
   private:
-  const ::marketdata::OrderBookIncrementalUpdate& _internal_incremental_update() const;
-  ::marketdata::OrderBookIncrementalUpdate* _internal_mutable_incremental_update();
+  double _internal_tick_size() const;
+  void _internal_set_tick_size(double value);
+  public:
 
+  // double lot_size = 5;
+  void clear_lot_size();
+  double lot_size() const;
+  void set_lot_size(double value);
+  private:
+  double _internal_lot_size() const;
+  void _internal_set_lot_size(double value);
   public:
-  void clear_update_type();
-  UpdateTypeCase update_type_case() const;
-  // @@protoc_insertion_point(class_scope:marketdata.MarketDataUpdate)
+
+  // uint64 sequence = 6;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:marketdata.OrderBookSnapshot)
  private:
   class _Internal;
-  void set_has_snapshot();
-  void set_has_incremental_update();
-  inline bool has_update_type() const;
-  inline void clear_has_update_type();
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 2, 2,
-      0, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const MarketDataUpdate& from_msg);
-    union UpdateTypeUnion {
-      constexpr UpdateTypeUnion() : _constinit_{} {}
-      ::google::protobuf::internal::ConstantInitialized _constinit_;
-      ::marketdata::OrderBookSnapshot* snapshot_;
-      ::marketdata::OrderBookIncrementalUpdate* incremental_update_;
-    } update_type_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::uint32_t _oneof_case_[1];
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel > bids_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel > asks_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr instrument_id_;
+    double tick_size_;
+    double lot_size_;
+    uint64_t sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_market_5fdata_2eproto;
 };
+// -------------------------------------------------------------------
 
-// ===================================================================
-
-
-
+class OrderBookIncrementalUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:marketdata.OrderBookIncrementalUpdate) */ {
+ public:
+  inline OrderBookIncrementalUpdate() : OrderBookIncrementalUpdate(nullptr) {}
+  ~OrderBookIncrementalUpdate() override;
+  explicit PROTOBUF_CONSTEXPR OrderBookIncrementalUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  OrderBookIncrementalUpdate(const OrderBookIncrementalUpdate& from);
+  OrderBookIncrementalUpdate(OrderBookIncrementalUpdate&& from) noexcept
+    : OrderBookIncrementalUpdate() {
+    *this = ::std::move(from);
+  }
 
+  inline OrderBookIncrementalUpdate& operator=(const OrderBookIncrementalUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OrderBookIncrementalUpdate& operator=(OrderBookIncrementalUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// -------------------------------------------------------------------
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OrderBookIncrementalUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OrderBookIncrementalUpdate* internal_default_instance() {
+    return reinterpret_cast<const OrderBookIncrementalUpdate*>(
+               &_OrderBookIncrementalUpdate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(OrderBookIncrementalUpdate& a, OrderBookIncrementalUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OrderBookIncrementalUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OrderBookIncrementalUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OrderBookIncrementalUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OrderBookIncrementalUpdate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OrderBookIncrementalUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OrderBookIncrementalUpdate& from) {
+    OrderBookIncrementalUpdate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OrderBookIncrementalUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "marketdata.OrderBookIncrementalUpdate";
+  }
+  protected:
+  explicit OrderBookIncrementalUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBidUpdatesFieldNumber = 2,
+    kAskUpdatesFieldNumber = 3,
+    kPriceDeltasFieldNumber = 9,
+    kQuantityLotsFieldNumber = 10,
+    kInstrumentIdFieldNumber = 1,
+    kSequenceFieldNumber = 5,
+    kFirstSequenceFieldNumber = 6,
+    kPublishTimestampNsFieldNumber = 7,
+    kInstrumentHandleFieldNumber = 4,
+    kBidCountFieldNumber = 11,
+    kBasePriceTicksFieldNumber = 8,
+  };
+  // repeated .marketdata.PriceLevel bid_updates = 2;
+  int bid_updates_size() const;
+  private:
+  int _internal_bid_updates_size() const;
+  public:
+  void clear_bid_updates();
+  ::marketdata::PriceLevel* mutable_bid_updates(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >*
+      mutable_bid_updates();
+  private:
+  const ::marketdata::PriceLevel& _internal_bid_updates(int index) const;
+  ::marketdata::PriceLevel* _internal_add_bid_updates();
+  public:
+  const ::marketdata::PriceLevel& bid_updates(int index) const;
+  ::marketdata::PriceLevel* add_bid_updates();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >&
+      bid_updates() const;
+
+  // repeated .marketdata.PriceLevel ask_updates = 3;
+  int ask_updates_size() const;
+  private:
+  int _internal_ask_updates_size() const;
+  public:
+  void clear_ask_updates();
+  ::marketdata::PriceLevel* mutable_ask_updates(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >*
+      mutable_ask_updates();
+  private:
+  const ::marketdata::PriceLevel& _internal_ask_updates(int index) const;
+  ::marketdata::PriceLevel* _internal_add_ask_updates();
+  public:
+  const ::marketdata::PriceLevel& ask_updates(int index) const;
+  ::marketdata::PriceLevel* add_ask_updates();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >&
+      ask_updates() const;
+
+  // repeated sint32 price_deltas = 9;
+  int price_deltas_size() const;
+  private:
+  int _internal_price_deltas_size() const;
+  public:
+  void clear_price_deltas();
+  private:
+  int32_t _internal_price_deltas(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_price_deltas() const;
+  void _internal_add_price_deltas(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_price_deltas();
+  public:
+  int32_t price_deltas(int index) const;
+  void set_price_deltas(int index, int32_t value);
+  void add_price_deltas(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      price_deltas() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_price_deltas();
+
+  // repeated uint64 quantity_lots = 10;
+  int quantity_lots_size() const;
+  private:
+  int _internal_quantity_lots_size() const;
+  public:
+  void clear_quantity_lots();
+  private:
+  uint64_t _internal_quantity_lots(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_quantity_lots() const;
+  void _internal_add_quantity_lots(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_quantity_lots();
+  public:
+  uint64_t quantity_lots(int index) const;
+  void set_quantity_lots(int index, uint64_t value);
+  void add_quantity_lots(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      quantity_lots() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_quantity_lots();
+
+  // string instrument_id = 1;
+  void clear_instrument_id();
+  const std::string& instrument_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_instrument_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_instrument_id();
+  PROTOBUF_NODISCARD std::string* release_instrument_id();
+  void set_allocated_instrument_id(std::string* instrument_id);
+  private:
+  const std::string& _internal_instrument_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_instrument_id(const std::string& value);
+  std::string* _internal_mutable_instrument_id();
+  public:
+
+  // uint64 sequence = 5;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // uint64 first_sequence = 6;
+  void clear_first_sequence();
+  uint64_t first_sequence() const;
+  void set_first_sequence(uint64_t value);
+  private:
+  uint64_t _internal_first_sequence() const;
+  void _internal_set_first_sequence(uint64_t value);
+  public:
+
+  // fixed64 publish_timestamp_ns = 7;
+  void clear_publish_timestamp_ns();
+  uint64_t publish_timestamp_ns() const;
+  void set_publish_timestamp_ns(uint64_t value);
+  private:
+  uint64_t _internal_publish_timestamp_ns() const;
+  void _internal_set_publish_timestamp_ns(uint64_t value);
+  public:
+
+  // uint32 instrument_handle = 4;
+  void clear_instrument_handle();
+  uint32_t instrument_handle() const;
+  void set_instrument_handle(uint32_t value);
+  private:
+  uint32_t _internal_instrument_handle() const;
+  void _internal_set_instrument_handle(uint32_t value);
+  public:
+
+  // uint32 bid_count = 11;
+  void clear_bid_count();
+  uint32_t bid_count() const;
+  void set_bid_count(uint32_t value);
+  private:
+  uint32_t _internal_bid_count() const;
+  void _internal_set_bid_count(uint32_t value);
+  public:
+
+  // sint64 base_price_ticks = 8;
+  void clear_base_price_ticks();
+  int64_t base_price_ticks() const;
+  void set_base_price_ticks(int64_t value);
+  private:
+  int64_t _internal_base_price_ticks() const;
+  void _internal_set_base_price_ticks(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:marketdata.OrderBookIncrementalUpdate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel > bid_updates_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel > ask_updates_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > price_deltas_;
+    mutable std::atomic<int> _price_deltas_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > quantity_lots_;
+    mutable std::atomic<int> _quantity_lots_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr instrument_id_;
+    uint64_t sequence_;
+    uint64_t first_sequence_;
+    uint64_t publish_timestamp_ns_;
+    uint32_t instrument_handle_;
+    uint32_t bid_count_;
+    int64_t base_price_ticks_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_market_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PriceLevel final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:marketdata.PriceLevel) */ {
+ public:
+  inline PriceLevel() : PriceLevel(nullptr) {}
+  ~PriceLevel() override;
+  explicit PROTOBUF_CONSTEXPR PriceLevel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PriceLevel(const PriceLevel& from);
+  PriceLevel(PriceLevel&& from) noexcept
+    : PriceLevel() {
+    *this = ::std::move(from);
+  }
+
+  inline PriceLevel& operator=(const PriceLevel& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PriceLevel& operator=(PriceLevel&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PriceLevel& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PriceLevel* internal_default_instance() {
+    return reinterpret_cast<const PriceLevel*>(
+               &_PriceLevel_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(PriceLevel& a, PriceLevel& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PriceLevel* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PriceLevel* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PriceLevel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PriceLevel>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PriceLevel& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PriceLevel& from) {
+    PriceLevel::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PriceLevel* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "marketdata.PriceLevel";
+  }
+  protected:
+  explicit PriceLevel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPriceFieldNumber = 1,
+    kQuantityFieldNumber = 2,
+    kPriceTicksFieldNumber = 3,
+    kQuantityLotsFieldNumber = 4,
+  };
+  // double price = 1;
+  void clear_price();
+  double price() const;
+  void set_price(double value);
+  private:
+  double _internal_price() const;
+  void _internal_set_price(double value);
+  public:
+
+  // double quantity = 2;
+  void clear_quantity();
+  double quantity() const;
+  void set_quantity(double value);
+  private:
+  double _internal_quantity() const;
+  void _internal_set_quantity(double value);
+  public:
+
+  // sint64 price_ticks = 3;
+  void clear_price_ticks();
+  int64_t price_ticks() const;
+  void set_price_ticks(int64_t value);
+  private:
+  int64_t _internal_price_ticks() const;
+  void _internal_set_price_ticks(int64_t value);
+  public:
+
+  // int64 quantity_lots = 4;
+  void clear_quantity_lots();
+  int64_t quantity_lots() const;
+  void set_quantity_lots(int64_t value);
+  private:
+  int64_t _internal_quantity_lots() const;
+  void _internal_set_quantity_lots(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:marketdata.PriceLevel)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double price_;
+    double quantity_;
+    int64_t price_ticks_;
+    int64_t quantity_lots_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_market_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:marketdata.StatsRequest) */ {
+ public:
+  inline StatsRequest() : StatsRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR StatsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsRequest(const StatsRequest& from);
+  StatsRequest(StatsRequest&& from) noexcept
+    : StatsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsRequest& operator=(const StatsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsRequest& operator=(StatsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsRequest* internal_default_instance() {
+    return reinterpret_cast<const StatsRequest*>(
+               &_StatsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(StatsRequest& a, StatsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const StatsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const StatsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "marketdata.StatsRequest";
+  }
+  protected:
+  explicit StatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:marketdata.StatsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_market_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StreamStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:marketdata.StreamStats) */ {
+ public:
+  inline StreamStats() : StreamStats(nullptr) {}
+  ~StreamStats() override;
+  explicit PROTOBUF_CONSTEXPR StreamStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StreamStats(const StreamStats& from);
+  StreamStats(StreamStats&& from) noexcept
+    : StreamStats() {
+    *this = ::std::move(from);
+  }
+
+  inline StreamStats& operator=(const StreamStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StreamStats& operator=(StreamStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StreamStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StreamStats* internal_default_instance() {
+    return reinterpret_cast<const StreamStats*>(
+               &_StreamStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(StreamStats& a, StreamStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StreamStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StreamStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StreamStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StreamStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StreamStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StreamStats& from) {
+    StreamStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StreamStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "marketdata.StreamStats";
+  }
+  protected:
+  explicit StreamStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPeerFieldNumber = 2,
+    kStreamIdFieldNumber = 1,
+    kMessagesSentFieldNumber = 4,
+    kBytesSentFieldNumber = 5,
+    kWriteBlockedNsFieldNumber = 6,
+    kQueueDepthFieldNumber = 7,
+    kMaxQueueDepthFieldNumber = 8,
+    kUpdatesConflatedFieldNumber = 9,
+    kUpdatesDroppedFieldNumber = 10,
+    kSubscriptionsFieldNumber = 3,
+  };
+  // string peer = 2;
+  void clear_peer();
+  const std::string& peer() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_peer(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_peer();
+  PROTOBUF_NODISCARD std::string* release_peer();
+  void set_allocated_peer(std::string* peer);
+  private:
+  const std::string& _internal_peer() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_peer(const std::string& value);
+  std::string* _internal_mutable_peer();
+  public:
+
+  // uint64 stream_id = 1;
+  void clear_stream_id();
+  uint64_t stream_id() const;
+  void set_stream_id(uint64_t value);
+  private:
+  uint64_t _internal_stream_id() const;
+  void _internal_set_stream_id(uint64_t value);
+  public:
+
+  // uint64 messages_sent = 4;
+  void clear_messages_sent();
+  uint64_t messages_sent() const;
+  void set_messages_sent(uint64_t value);
+  private:
+  uint64_t _internal_messages_sent() const;
+  void _internal_set_messages_sent(uint64_t value);
+  public:
+
+  // uint64 bytes_sent = 5;
+  void clear_bytes_sent();
+  uint64_t bytes_sent() const;
+  void set_bytes_sent(uint64_t value);
+  private:
+  uint64_t _internal_bytes_sent() const;
+  void _internal_set_bytes_sent(uint64_t value);
+  public:
+
+  // uint64 write_blocked_ns = 6;
+  void clear_write_blocked_ns();
+  uint64_t write_blocked_ns() const;
+  void set_write_blocked_ns(uint64_t value);
+  private:
+  uint64_t _internal_write_blocked_ns() const;
+  void _internal_set_write_blocked_ns(uint64_t value);
+  public:
+
+  // uint64 queue_depth = 7;
+  void clear_queue_depth();
+  uint64_t queue_depth() const;
+  void set_queue_depth(uint64_t value);
+  private:
+  uint64_t _internal_queue_depth() const;
+  void _internal_set_queue_depth(uint64_t value);
+  public:
+
+  // uint64 max_queue_depth = 8;
+  void clear_max_queue_depth();
+  uint64_t max_queue_depth() const;
+  void set_max_queue_depth(uint64_t value);
+  private:
+  uint64_t _internal_max_queue_depth() const;
+  void _internal_set_max_queue_depth(uint64_t value);
+  public:
+
+  // uint64 updates_conflated = 9;
+  void clear_updates_conflated();
+  uint64_t updates_conflated() const;
+  void set_updates_conflated(uint64_t value);
+  private:
+  uint64_t _internal_updates_conflated() const;
+  void _internal_set_updates_conflated(uint64_t value);
+  public:
+
+  // uint64 updates_dropped = 10;
+  void clear_updates_dropped();
+  uint64_t updates_dropped() const;
+  void set_updates_dropped(uint64_t value);
+  private:
+  uint64_t _internal_updates_dropped() const;
+  void _internal_set_updates_dropped(uint64_t value);
+  public:
+
+  // uint32 subscriptions = 3;
+  void clear_subscriptions();
+  uint32_t subscriptions() const;
+  void set_subscriptions(uint32_t value);
+  private:
+  uint32_t _internal_subscriptions() const;
+  void _internal_set_subscriptions(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:marketdata.StreamStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr peer_;
+    uint64_t stream_id_;
+    uint64_t messages_sent_;
+    uint64_t bytes_sent_;
+    uint64_t write_blocked_ns_;
+    uint64_t queue_depth_;
+    uint64_t max_queue_depth_;
+    uint64_t updates_conflated_;
+    uint64_t updates_dropped_;
+    uint32_t subscriptions_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_market_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InstrumentStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:marketdata.InstrumentStats) */ {
+ public:
+  inline InstrumentStats() : InstrumentStats(nullptr) {}
+  ~InstrumentStats() override;
+  explicit PROTOBUF_CONSTEXPR InstrumentStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InstrumentStats(const InstrumentStats& from);
+  InstrumentStats(InstrumentStats&& from) noexcept
+    : InstrumentStats() {
+    *this = ::std::move(from);
+  }
+
+  inline InstrumentStats& operator=(const InstrumentStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InstrumentStats& operator=(InstrumentStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InstrumentStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InstrumentStats* internal_default_instance() {
+    return reinterpret_cast<const InstrumentStats*>(
+               &_InstrumentStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(InstrumentStats& a, InstrumentStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InstrumentStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InstrumentStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InstrumentStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InstrumentStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InstrumentStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InstrumentStats& from) {
+    InstrumentStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InstrumentStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "marketdata.InstrumentStats";
+  }
+  protected:
+  explicit InstrumentStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInstrumentIdFieldNumber = 1,
+    kUpdatesPublishedFieldNumber = 3,
+    kBytesPublishedFieldNumber = 4,
+    kDeliveriesFieldNumber = 5,
+    kSnapshotsSentFieldNumber = 6,
+    kSnapshotsBuiltFieldNumber = 7,
+    kSubscribersFieldNumber = 2,
+  };
+  // string instrument_id = 1;
+  void clear_instrument_id();
+  const std::string& instrument_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_instrument_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_instrument_id();
+  PROTOBUF_NODISCARD std::string* release_instrument_id();
+  void set_allocated_instrument_id(std::string* instrument_id);
+  private:
+  const std::string& _internal_instrument_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_instrument_id(const std::string& value);
+  std::string* _internal_mutable_instrument_id();
+  public:
+
+  // uint64 updates_published = 3;
+  void clear_updates_published();
+  uint64_t updates_published() const;
+  void set_updates_published(uint64_t value);
+  private:
+  uint64_t _internal_updates_published() const;
+  void _internal_set_updates_published(uint64_t value);
+  public:
+
+  // uint64 bytes_published = 4;
+  void clear_bytes_published();
+  uint64_t bytes_published() const;
+  void set_bytes_published(uint64_t value);
+  private:
+  uint64_t _internal_bytes_published() const;
+  void _internal_set_bytes_published(uint64_t value);
+  public:
+
+  // uint64 deliveries = 5;
+  void clear_deliveries();
+  uint64_t deliveries() const;
+  void set_deliveries(uint64_t value);
+  private:
+  uint64_t _internal_deliveries() const;
+  void _internal_set_deliveries(uint64_t value);
+  public:
+
+  // uint64 snapshots_sent = 6;
+  void clear_snapshots_sent();
+  uint64_t snapshots_sent() const;
+  void set_snapshots_sent(uint64_t value);
+  private:
+  uint64_t _internal_snapshots_sent() const;
+  void _internal_set_snapshots_sent(uint64_t value);
+  public:
+
+  // uint64 snapshots_built = 7;
+  void clear_snapshots_built();
+  uint64_t snapshots_built() const;
+  void set_snapshots_built(uint64_t value);
+  private:
+  uint64_t _internal_snapshots_built() const;
+  void _internal_set_snapshots_built(uint64_t value);
+  public:
+
+  // uint32 subscribers = 2;
+  void clear_subscribers();
+  uint32_t subscribers() const;
+  void set_subscribers(uint32_t value);
+  private:
+  uint32_t _internal_subscribers() const;
+  void _internal_set_subscribers(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:marketdata.InstrumentStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr instrument_id_;
+    uint64_t updates_published_;
+    uint64_t bytes_published_;
+    uint64_t deliveries_;
+    uint64_t snapshots_sent_;
+    uint64_t snapshots_built_;
+    uint32_t subscribers_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_market_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:marketdata.ServerStats) */ {
+ public:
+  inline ServerStats() : ServerStats(nullptr) {}
+  ~ServerStats() override;
+  explicit PROTOBUF_CONSTEXPR ServerStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerStats(const ServerStats& from);
+  ServerStats(ServerStats&& from) noexcept
+    : ServerStats() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerStats& operator=(const ServerStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerStats& operator=(ServerStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStats* internal_default_instance() {
+    return reinterpret_cast<const ServerStats*>(
+               &_ServerStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(ServerStats& a, ServerStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerStats& from) {
+    ServerStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "marketdata.ServerStats";
+  }
+  protected:
+  explicit ServerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStreamsFieldNumber = 2,
+    kInstrumentsFieldNumber = 4,
+    kClosedStreamsFieldNumber = 3,
+    kStreamsOpenedFieldNumber = 1,
+  };
+  // repeated .marketdata.StreamStats streams = 2;
+  int streams_size() const;
+  private:
+  int _internal_streams_size() const;
+  public:
+  void clear_streams();
+  ::marketdata::StreamStats* mutable_streams(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::StreamStats >*
+      mutable_streams();
+  private:
+  const ::marketdata::StreamStats& _internal_streams(int index) const;
+  ::marketdata::StreamStats* _internal_add_streams();
+  public:
+  const ::marketdata::StreamStats& streams(int index) const;
+  ::marketdata::StreamStats* add_streams();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::StreamStats >&
+      streams() const;
+
+  // repeated .marketdata.InstrumentStats instruments = 4;
+  int instruments_size() const;
+  private:
+  int _internal_instruments_size() const;
+  public:
+  void clear_instruments();
+  ::marketdata::InstrumentStats* mutable_instruments(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::InstrumentStats >*
+      mutable_instruments();
+  private:
+  const ::marketdata::InstrumentStats& _internal_instruments(int index) const;
+  ::marketdata::InstrumentStats* _internal_add_instruments();
+  public:
+  const ::marketdata::InstrumentStats& instruments(int index) const;
+  ::marketdata::InstrumentStats* add_instruments();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::InstrumentStats >&
+      instruments() const;
+
+  // .marketdata.StreamStats closed_streams = 3;
+  bool has_closed_streams() const;
+  private:
+  bool _internal_has_closed_streams() const;
+  public:
+  void clear_closed_streams();
+  const ::marketdata::StreamStats& closed_streams() const;
+  PROTOBUF_NODISCARD ::marketdata::StreamStats* release_closed_streams();
+  ::marketdata::StreamStats* mutable_closed_streams();
+  void set_allocated_closed_streams(::marketdata::StreamStats* closed_streams);
+  private:
+  const ::marketdata::StreamStats& _internal_closed_streams() const;
+  ::marketdata::StreamStats* _internal_mutable_closed_streams();
+  public:
+  void unsafe_arena_set_allocated_closed_streams(
+      ::marketdata::StreamStats* closed_streams);
+  ::marketdata::StreamStats* unsafe_arena_release_closed_streams();
+
+  // uint64 streams_opened = 1;
+  void clear_streams_opened();
+  uint64_t streams_opened() const;
+  void set_streams_opened(uint64_t value);
+  private:
+  uint64_t _internal_streams_opened() const;
+  void _internal_set_streams_opened(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:marketdata.ServerStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::StreamStats > streams_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::InstrumentStats > instruments_;
+    ::marketdata::StreamStats* closed_streams_;
+    uint64_t streams_opened_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_market_5fdata_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SubscriptionRequest
+
+// .marketdata.SubscriptionRequest.Action action = 1;
+inline void SubscriptionRequest::clear_action() {
+  _impl_.action_ = 0;
+}
+inline ::marketdata::SubscriptionRequest_Action SubscriptionRequest::_internal_action() const {
+  return static_cast< ::marketdata::SubscriptionRequest_Action >(_impl_.action_);
+}
+inline ::marketdata::SubscriptionRequest_Action SubscriptionRequest::action() const {
+  // @@protoc_insertion_point(field_get:marketdata.SubscriptionRequest.action)
+  return _internal_action();
+}
+inline void SubscriptionRequest::_internal_set_action(::marketdata::SubscriptionRequest_Action value) {
+  
+  _impl_.action_ = value;
+}
+inline void SubscriptionRequest::set_action(::marketdata::SubscriptionRequest_Action value) {
+  _internal_set_action(value);
+  // @@protoc_insertion_point(field_set:marketdata.SubscriptionRequest.action)
+}
+
+// string instrument_id = 2;
+inline void SubscriptionRequest::clear_instrument_id() {
+  _impl_.instrument_id_.ClearToEmpty();
+}
+inline const std::string& SubscriptionRequest::instrument_id() const {
+  // @@protoc_insertion_point(field_get:marketdata.SubscriptionRequest.instrument_id)
+  return _internal_instrument_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubscriptionRequest::set_instrument_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.instrument_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:marketdata.SubscriptionRequest.instrument_id)
+}
+inline std::string* SubscriptionRequest::mutable_instrument_id() {
+  std::string* _s = _internal_mutable_instrument_id();
+  // @@protoc_insertion_point(field_mutable:marketdata.SubscriptionRequest.instrument_id)
+  return _s;
+}
+inline const std::string& SubscriptionRequest::_internal_instrument_id() const {
+  return _impl_.instrument_id_.Get();
+}
+inline void SubscriptionRequest::_internal_set_instrument_id(const std::string& value) {
+  
+  _impl_.instrument_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubscriptionRequest::_internal_mutable_instrument_id() {
+  
+  return _impl_.instrument_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubscriptionRequest::release_instrument_id() {
+  // @@protoc_insertion_point(field_release:marketdata.SubscriptionRequest.instrument_id)
+  return _impl_.instrument_id_.Release();
+}
+inline void SubscriptionRequest::set_allocated_instrument_id(std::string* instrument_id) {
+  if (instrument_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.instrument_id_.SetAllocated(instrument_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.instrument_id_.IsDefault()) {
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:marketdata.SubscriptionRequest.instrument_id)
+}
+
+// bool conflate = 3;
+inline void SubscriptionRequest::clear_conflate() {
+  _impl_.conflate_ = false;
+}
+inline bool SubscriptionRequest::_internal_conflate() const {
+  return _impl_.conflate_;
+}
+inline bool SubscriptionRequest::conflate() const {
+  // @@protoc_insertion_point(field_get:marketdata.SubscriptionRequest.conflate)
+  return _internal_conflate();
+}
+inline void SubscriptionRequest::_internal_set_conflate(bool value) {
+  
+  _impl_.conflate_ = value;
+}
+inline void SubscriptionRequest::set_conflate(bool value) {
+  _internal_set_conflate(value);
+  // @@protoc_insertion_point(field_set:marketdata.SubscriptionRequest.conflate)
+}
+
+// uint32 max_updates_per_second = 4;
+inline void SubscriptionRequest::clear_max_updates_per_second() {
+  _impl_.max_updates_per_second_ = 0u;
+}
+inline uint32_t SubscriptionRequest::_internal_max_updates_per_second() const {
+  return _impl_.max_updates_per_second_;
+}
+inline uint32_t SubscriptionRequest::max_updates_per_second() const {
+  // @@protoc_insertion_point(field_get:marketdata.SubscriptionRequest.max_updates_per_second)
+  return _internal_max_updates_per_second();
+}
+inline void SubscriptionRequest::_internal_set_max_updates_per_second(uint32_t value) {
+  
+  _impl_.max_updates_per_second_ = value;
+}
+inline void SubscriptionRequest::set_max_updates_per_second(uint32_t value) {
+  _internal_set_max_updates_per_second(value);
+  // @@protoc_insertion_point(field_set:marketdata.SubscriptionRequest.max_updates_per_second)
+}
+
+// uint32 depth = 5;
+inline void SubscriptionRequest::clear_depth() {
+  _impl_.depth_ = 0u;
+}
+inline uint32_t SubscriptionRequest::_internal_depth() const {
+  return _impl_.depth_;
+}
+inline uint32_t SubscriptionRequest::depth() const {
+  // @@protoc_insertion_point(field_get:marketdata.SubscriptionRequest.depth)
+  return _internal_depth();
+}
+inline void SubscriptionRequest::_internal_set_depth(uint32_t value) {
+  
+  _impl_.depth_ = value;
+}
+inline void SubscriptionRequest::set_depth(uint32_t value) {
+  _internal_set_depth(value);
+  // @@protoc_insertion_point(field_set:marketdata.SubscriptionRequest.depth)
+}
+
+// repeated string instrument_ids = 6;
+inline int SubscriptionRequest::_internal_instrument_ids_size() const {
+  return _impl_.instrument_ids_.size();
+}
+inline int SubscriptionRequest::instrument_ids_size() const {
+  return _internal_instrument_ids_size();
+}
+inline void SubscriptionRequest::clear_instrument_ids() {
+  _impl_.instrument_ids_.Clear();
+}
+inline std::string* SubscriptionRequest::add_instrument_ids() {
+  std::string* _s = _internal_add_instrument_ids();
+  // @@protoc_insertion_point(field_add_mutable:marketdata.SubscriptionRequest.instrument_ids)
+  return _s;
+}
+inline const std::string& SubscriptionRequest::_internal_instrument_ids(int index) const {
+  return _impl_.instrument_ids_.Get(index);
+}
+inline const std::string& SubscriptionRequest::instrument_ids(int index) const {
+  // @@protoc_insertion_point(field_get:marketdata.SubscriptionRequest.instrument_ids)
+  return _internal_instrument_ids(index);
+}
+inline std::string* SubscriptionRequest::mutable_instrument_ids(int index) {
+  // @@protoc_insertion_point(field_mutable:marketdata.SubscriptionRequest.instrument_ids)
+  return _impl_.instrument_ids_.Mutable(index);
+}
+inline void SubscriptionRequest::set_instrument_ids(int index, const std::string& value) {
+  _impl_.instrument_ids_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:marketdata.SubscriptionRequest.instrument_ids)
+}
+inline void SubscriptionRequest::set_instrument_ids(int index, std::string&& value) {
+  _impl_.instrument_ids_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:marketdata.SubscriptionRequest.instrument_ids)
+}
+inline void SubscriptionRequest::set_instrument_ids(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.instrument_ids_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:marketdata.SubscriptionRequest.instrument_ids)
+}
+inline void SubscriptionRequest::set_instrument_ids(int index, const char* value, size_t size) {
+  _impl_.instrument_ids_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:marketdata.SubscriptionRequest.instrument_ids)
+}
+inline std::string* SubscriptionRequest::_internal_add_instrument_ids() {
+  return _impl_.instrument_ids_.Add();
+}
+inline void SubscriptionRequest::add_instrument_ids(const std::string& value) {
+  _impl_.instrument_ids_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:marketdata.SubscriptionRequest.instrument_ids)
+}
+inline void SubscriptionRequest::add_instrument_ids(std::string&& value) {
+  _impl_.instrument_ids_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:marketdata.SubscriptionRequest.instrument_ids)
+}
+inline void SubscriptionRequest::add_instrument_ids(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.instrument_ids_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:marketdata.SubscriptionRequest.instrument_ids)
+}
+inline void SubscriptionRequest::add_instrument_ids(const char* value, size_t size) {
+  _impl_.instrument_ids_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:marketdata.SubscriptionRequest.instrument_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SubscriptionRequest::instrument_ids() const {
+  // @@protoc_insertion_point(field_list:marketdata.SubscriptionRequest.instrument_ids)
+  return _impl_.instrument_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SubscriptionRequest::mutable_instrument_ids() {
+  // @@protoc_insertion_point(field_mutable_list:marketdata.SubscriptionRequest.instrument_ids)
+  return &_impl_.instrument_ids_;
+}
+
+// -------------------------------------------------------------------
+
+// MarketDataUpdate
+
+// .marketdata.OrderBookSnapshot snapshot = 1;
+inline bool MarketDataUpdate::_internal_has_snapshot() const {
+  return update_type_case() == kSnapshot;
+}
+inline bool MarketDataUpdate::has_snapshot() const {
+  return _internal_has_snapshot();
+}
+inline void MarketDataUpdate::set_has_snapshot() {
+  _impl_._oneof_case_[0] = kSnapshot;
+}
+inline void MarketDataUpdate::clear_snapshot() {
+  if (_internal_has_snapshot()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.update_type_.snapshot_;
+    }
+    clear_has_update_type();
+  }
+}
+inline ::marketdata::OrderBookSnapshot* MarketDataUpdate::release_snapshot() {
+  // @@protoc_insertion_point(field_release:marketdata.MarketDataUpdate.snapshot)
+  if (_internal_has_snapshot()) {
+    clear_has_update_type();
+    ::marketdata::OrderBookSnapshot* temp = _impl_.update_type_.snapshot_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.update_type_.snapshot_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::marketdata::OrderBookSnapshot& MarketDataUpdate::_internal_snapshot() const {
+  return _internal_has_snapshot()
+      ? *_impl_.update_type_.snapshot_
+      : reinterpret_cast< ::marketdata::OrderBookSnapshot&>(::marketdata::_OrderBookSnapshot_default_instance_);
+}
+inline const ::marketdata::OrderBookSnapshot& MarketDataUpdate::snapshot() const {
+  // @@protoc_insertion_point(field_get:marketdata.MarketDataUpdate.snapshot)
+  return _internal_snapshot();
+}
+inline ::marketdata::OrderBookSnapshot* MarketDataUpdate::unsafe_arena_release_snapshot() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:marketdata.MarketDataUpdate.snapshot)
+  if (_internal_has_snapshot()) {
+    clear_has_update_type();
+    ::marketdata::OrderBookSnapshot* temp = _impl_.update_type_.snapshot_;
+    _impl_.update_type_.snapshot_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void MarketDataUpdate::unsafe_arena_set_allocated_snapshot(::marketdata::OrderBookSnapshot* snapshot) {
+  clear_update_type();
+  if (snapshot) {
+    set_has_snapshot();
+    _impl_.update_type_.snapshot_ = snapshot;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:marketdata.MarketDataUpdate.snapshot)
+}
+inline ::marketdata::OrderBookSnapshot* MarketDataUpdate::_internal_mutable_snapshot() {
+  if (!_internal_has_snapshot()) {
+    clear_update_type();
+    set_has_snapshot();
+    _impl_.update_type_.snapshot_ = CreateMaybeMessage< ::marketdata::OrderBookSnapshot >(GetArenaForAllocation());
+  }
+  return _impl_.update_type_.snapshot_;
+}
+inline ::marketdata::OrderBookSnapshot* MarketDataUpdate::mutable_snapshot() {
+  ::marketdata::OrderBookSnapshot* _msg = _internal_mutable_snapshot();
+  // @@protoc_insertion_point(field_mutable:marketdata.MarketDataUpdate.snapshot)
+  return _msg;
+}
+
+// .marketdata.OrderBookIncrementalUpdate incremental_update = 2;
+inline bool MarketDataUpdate::_internal_has_incremental_update() const {
+  return update_type_case() == kIncrementalUpdate;
+}
+inline bool MarketDataUpdate::has_incremental_update() const {
+  return _internal_has_incremental_update();
+}
+inline void MarketDataUpdate::set_has_incremental_update() {
+  _impl_._oneof_case_[0] = kIncrementalUpdate;
+}
+inline void MarketDataUpdate::clear_incremental_update() {
+  if (_internal_has_incremental_update()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.update_type_.incremental_update_;
+    }
+    clear_has_update_type();
+  }
+}
+inline ::marketdata::OrderBookIncrementalUpdate* MarketDataUpdate::release_incremental_update() {
+  // @@protoc_insertion_point(field_release:marketdata.MarketDataUpdate.incremental_update)
+  if (_internal_has_incremental_update()) {
+    clear_has_update_type();
+    ::marketdata::OrderBookIncrementalUpdate* temp = _impl_.update_type_.incremental_update_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.update_type_.incremental_update_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::marketdata::OrderBookIncrementalUpdate& MarketDataUpdate::_internal_incremental_update() const {
+  return _internal_has_incremental_update()
+      ? *_impl_.update_type_.incremental_update_
+      : reinterpret_cast< ::marketdata::OrderBookIncrementalUpdate&>(::marketdata::_OrderBookIncrementalUpdate_default_instance_);
+}
+inline const ::marketdata::OrderBookIncrementalUpdate& MarketDataUpdate::incremental_update() const {
+  // @@protoc_insertion_point(field_get:marketdata.MarketDataUpdate.incremental_update)
+  return _internal_incremental_update();
+}
+inline ::marketdata::OrderBookIncrementalUpdate* MarketDataUpdate::unsafe_arena_release_incremental_update() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:marketdata.MarketDataUpdate.incremental_update)
+  if (_internal_has_incremental_update()) {
+    clear_has_update_type();
+    ::marketdata::OrderBookIncrementalUpdate* temp = _impl_.update_type_.incremental_update_;
+    _impl_.update_type_.incremental_update_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void MarketDataUpdate::unsafe_arena_set_allocated_incremental_update(::marketdata::OrderBookIncrementalUpdate* incremental_update) {
+  clear_update_type();
+  if (incremental_update) {
+    set_has_incremental_update();
+    _impl_.update_type_.incremental_update_ = incremental_update;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:marketdata.MarketDataUpdate.incremental_update)
+}
+inline ::marketdata::OrderBookIncrementalUpdate* MarketDataUpdate::_internal_mutable_incremental_update() {
+  if (!_internal_has_incremental_update()) {
+    clear_update_type();
+    set_has_incremental_update();
+    _impl_.update_type_.incremental_update_ = CreateMaybeMessage< ::marketdata::OrderBookIncrementalUpdate >(GetArenaForAllocation());
+  }
+  return _impl_.update_type_.incremental_update_;
+}
+inline ::marketdata::OrderBookIncrementalUpdate* MarketDataUpdate::mutable_incremental_update() {
+  ::marketdata::OrderBookIncrementalUpdate* _msg = _internal_mutable_incremental_update();
+  // @@protoc_insertion_point(field_mutable:marketdata.MarketDataUpdate.incremental_update)
+  return _msg;
+}
 
-// SubscriptionRequest
+// .marketdata.SymbolDirectory symbol_directory = 3;
+inline bool MarketDataUpdate::_internal_has_symbol_directory() const {
+  return update_type_case() == kSymbolDirectory;
+}
+inline bool MarketDataUpdate::has_symbol_directory() const {
+  return _internal_has_symbol_directory();
+}
+inline void MarketDataUpdate::set_has_symbol_directory() {
+  _impl_._oneof_case_[0] = kSymbolDirectory;
+}
+inline void MarketDataUpdate::clear_symbol_directory() {
+  if (_internal_has_symbol_directory()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.update_type_.symbol_directory_;
+    }
+    clear_has_update_type();
+  }
+}
+inline ::marketdata::SymbolDirectory* MarketDataUpdate::release_symbol_directory() {
+  // @@protoc_insertion_point(field_release:marketdata.MarketDataUpdate.symbol_directory)
+  if (_internal_has_symbol_directory()) {
+    clear_has_update_type();
+    ::marketdata::SymbolDirectory* temp = _impl_.update_type_.symbol_directory_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.update_type_.symbol_directory_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::marketdata::SymbolDirectory& MarketDataUpdate::_internal_symbol_directory() const {
+  return _internal_has_symbol_directory()
+      ? *_impl_.update_type_.symbol_directory_
+      : reinterpret_cast< ::marketdata::SymbolDirectory&>(::marketdata::_SymbolDirectory_default_instance_);
+}
+inline const ::marketdata::SymbolDirectory& MarketDataUpdate::symbol_directory() const {
+  // @@protoc_insertion_point(field_get:marketdata.MarketDataUpdate.symbol_directory)
+  return _internal_symbol_directory();
+}
+inline ::marketdata::SymbolDirectory* MarketDataUpdate::unsafe_arena_release_symbol_directory() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:marketdata.MarketDataUpdate.symbol_directory)
+  if (_internal_has_symbol_directory()) {
+    clear_has_update_type();
+    ::marketdata::SymbolDirectory* temp = _impl_.update_type_.symbol_directory_;
+    _impl_.update_type_.symbol_directory_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void MarketDataUpdate::unsafe_arena_set_allocated_symbol_directory(::marketdata::SymbolDirectory* symbol_directory) {
+  clear_update_type();
+  if (symbol_directory) {
+    set_has_symbol_directory();
+    _impl_.update_type_.symbol_directory_ = symbol_directory;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:marketdata.MarketDataUpdate.symbol_directory)
+}
+inline ::marketdata::SymbolDirectory* MarketDataUpdate::_internal_mutable_symbol_directory() {
+  if (!_internal_has_symbol_directory()) {
+    clear_update_type();
+    set_has_symbol_directory();
+    _impl_.update_type_.symbol_directory_ = CreateMaybeMessage< ::marketdata::SymbolDirectory >(GetArenaForAllocation());
+  }
+  return _impl_.update_type_.symbol_directory_;
+}
+inline ::marketdata::SymbolDirectory* MarketDataUpdate::mutable_symbol_directory() {
+  ::marketdata::SymbolDirectory* _msg = _internal_mutable_symbol_directory();
+  // @@protoc_insertion_point(field_mutable:marketdata.MarketDataUpdate.symbol_directory)
+  return _msg;
+}
 
-// .marketdata.SubscriptionRequest.Action action = 1;
-inline void SubscriptionRequest::clear_action() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.action_ = 0;
+// .marketdata.MarketDataBatch batch = 4;
+inline bool MarketDataUpdate::_internal_has_batch() const {
+  return update_type_case() == kBatch;
+}
+inline bool MarketDataUpdate::has_batch() const {
+  return _internal_has_batch();
+}
+inline void MarketDataUpdate::set_has_batch() {
+  _impl_._oneof_case_[0] = kBatch;
+}
+inline void MarketDataUpdate::clear_batch() {
+  if (_internal_has_batch()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.update_type_.batch_;
+    }
+    clear_has_update_type();
+  }
+}
+inline ::marketdata::MarketDataBatch* MarketDataUpdate::release_batch() {
+  // @@protoc_insertion_point(field_release:marketdata.MarketDataUpdate.batch)
+  if (_internal_has_batch()) {
+    clear_has_update_type();
+    ::marketdata::MarketDataBatch* temp = _impl_.update_type_.batch_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.update_type_.batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::marketdata::MarketDataBatch& MarketDataUpdate::_internal_batch() const {
+  return _internal_has_batch()
+      ? *_impl_.update_type_.batch_
+      : reinterpret_cast< ::marketdata::MarketDataBatch&>(::marketdata::_MarketDataBatch_default_instance_);
+}
+inline const ::marketdata::MarketDataBatch& MarketDataUpdate::batch() const {
+  // @@protoc_insertion_point(field_get:marketdata.MarketDataUpdate.batch)
+  return _internal_batch();
+}
+inline ::marketdata::MarketDataBatch* MarketDataUpdate::unsafe_arena_release_batch() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:marketdata.MarketDataUpdate.batch)
+  if (_internal_has_batch()) {
+    clear_has_update_type();
+    ::marketdata::MarketDataBatch* temp = _impl_.update_type_.batch_;
+    _impl_.update_type_.batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void MarketDataUpdate::unsafe_arena_set_allocated_batch(::marketdata::MarketDataBatch* batch) {
+  clear_update_type();
+  if (batch) {
+    set_has_batch();
+    _impl_.update_type_.batch_ = batch;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:marketdata.MarketDataUpdate.batch)
+}
+inline ::marketdata::MarketDataBatch* MarketDataUpdate::_internal_mutable_batch() {
+  if (!_internal_has_batch()) {
+    clear_update_type();
+    set_has_batch();
+    _impl_.update_type_.batch_ = CreateMaybeMessage< ::marketdata::MarketDataBatch >(GetArenaForAllocation());
+  }
+  return _impl_.update_type_.batch_;
+}
+inline ::marketdata::MarketDataBatch* MarketDataUpdate::mutable_batch() {
+  ::marketdata::MarketDataBatch* _msg = _internal_mutable_batch();
+  // @@protoc_insertion_point(field_mutable:marketdata.MarketDataUpdate.batch)
+  return _msg;
+}
+
+inline bool MarketDataUpdate::has_update_type() const {
+  return update_type_case() != UPDATE_TYPE_NOT_SET;
+}
+inline void MarketDataUpdate::clear_has_update_type() {
+  _impl_._oneof_case_[0] = UPDATE_TYPE_NOT_SET;
+}
+inline MarketDataUpdate::UpdateTypeCase MarketDataUpdate::update_type_case() const {
+  return MarketDataUpdate::UpdateTypeCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// MarketDataBatch
+
+// repeated .marketdata.MarketDataUpdate updates = 1;
+inline int MarketDataBatch::_internal_updates_size() const {
+  return _impl_.updates_.size();
+}
+inline int MarketDataBatch::updates_size() const {
+  return _internal_updates_size();
+}
+inline void MarketDataBatch::clear_updates() {
+  _impl_.updates_.Clear();
+}
+inline ::marketdata::MarketDataUpdate* MarketDataBatch::mutable_updates(int index) {
+  // @@protoc_insertion_point(field_mutable:marketdata.MarketDataBatch.updates)
+  return _impl_.updates_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::MarketDataUpdate >*
+MarketDataBatch::mutable_updates() {
+  // @@protoc_insertion_point(field_mutable_list:marketdata.MarketDataBatch.updates)
+  return &_impl_.updates_;
+}
+inline const ::marketdata::MarketDataUpdate& MarketDataBatch::_internal_updates(int index) const {
+  return _impl_.updates_.Get(index);
+}
+inline const ::marketdata::MarketDataUpdate& MarketDataBatch::updates(int index) const {
+  // @@protoc_insertion_point(field_get:marketdata.MarketDataBatch.updates)
+  return _internal_updates(index);
+}
+inline ::marketdata::MarketDataUpdate* MarketDataBatch::_internal_add_updates() {
+  return _impl_.updates_.Add();
+}
+inline ::marketdata::MarketDataUpdate* MarketDataBatch::add_updates() {
+  ::marketdata::MarketDataUpdate* _add = _internal_add_updates();
+  // @@protoc_insertion_point(field_add:marketdata.MarketDataBatch.updates)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::MarketDataUpdate >&
+MarketDataBatch::updates() const {
+  // @@protoc_insertion_point(field_list:marketdata.MarketDataBatch.updates)
+  return _impl_.updates_;
+}
+
+// -------------------------------------------------------------------
+
+// SymbolDirectory_Entry
+
+// string instrument_id = 1;
+inline void SymbolDirectory_Entry::clear_instrument_id() {
+  _impl_.instrument_id_.ClearToEmpty();
+}
+inline const std::string& SymbolDirectory_Entry::instrument_id() const {
+  // @@protoc_insertion_point(field_get:marketdata.SymbolDirectory.Entry.instrument_id)
+  return _internal_instrument_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SymbolDirectory_Entry::set_instrument_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.instrument_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:marketdata.SymbolDirectory.Entry.instrument_id)
+}
+inline std::string* SymbolDirectory_Entry::mutable_instrument_id() {
+  std::string* _s = _internal_mutable_instrument_id();
+  // @@protoc_insertion_point(field_mutable:marketdata.SymbolDirectory.Entry.instrument_id)
+  return _s;
+}
+inline const std::string& SymbolDirectory_Entry::_internal_instrument_id() const {
+  return _impl_.instrument_id_.Get();
+}
+inline void SymbolDirectory_Entry::_internal_set_instrument_id(const std::string& value) {
+  
+  _impl_.instrument_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SymbolDirectory_Entry::_internal_mutable_instrument_id() {
+  
+  return _impl_.instrument_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SymbolDirectory_Entry::release_instrument_id() {
+  // @@protoc_insertion_point(field_release:marketdata.SymbolDirectory.Entry.instrument_id)
+  return _impl_.instrument_id_.Release();
+}
+inline void SymbolDirectory_Entry::set_allocated_instrument_id(std::string* instrument_id) {
+  if (instrument_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.instrument_id_.SetAllocated(instrument_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.instrument_id_.IsDefault()) {
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:marketdata.SymbolDirectory.Entry.instrument_id)
+}
+
+// uint32 instrument_handle = 2;
+inline void SymbolDirectory_Entry::clear_instrument_handle() {
+  _impl_.instrument_handle_ = 0u;
+}
+inline uint32_t SymbolDirectory_Entry::_internal_instrument_handle() const {
+  return _impl_.instrument_handle_;
+}
+inline uint32_t SymbolDirectory_Entry::instrument_handle() const {
+  // @@protoc_insertion_point(field_get:marketdata.SymbolDirectory.Entry.instrument_handle)
+  return _internal_instrument_handle();
+}
+inline void SymbolDirectory_Entry::_internal_set_instrument_handle(uint32_t value) {
+  
+  _impl_.instrument_handle_ = value;
+}
+inline void SymbolDirectory_Entry::set_instrument_handle(uint32_t value) {
+  _internal_set_instrument_handle(value);
+  // @@protoc_insertion_point(field_set:marketdata.SymbolDirectory.Entry.instrument_handle)
+}
+
+// -------------------------------------------------------------------
+
+// SymbolDirectory
+
+// repeated .marketdata.SymbolDirectory.Entry entries = 1;
+inline int SymbolDirectory::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int SymbolDirectory::entries_size() const {
+  return _internal_entries_size();
+}
+inline void SymbolDirectory::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::marketdata::SymbolDirectory_Entry* SymbolDirectory::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:marketdata.SymbolDirectory.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::SymbolDirectory_Entry >*
+SymbolDirectory::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:marketdata.SymbolDirectory.entries)
+  return &_impl_.entries_;
+}
+inline const ::marketdata::SymbolDirectory_Entry& SymbolDirectory::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::marketdata::SymbolDirectory_Entry& SymbolDirectory::entries(int index) const {
+  // @@protoc_insertion_point(field_get:marketdata.SymbolDirectory.entries)
+  return _internal_entries(index);
+}
+inline ::marketdata::SymbolDirectory_Entry* SymbolDirectory::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::marketdata::SymbolDirectory_Entry* SymbolDirectory::add_entries() {
+  ::marketdata::SymbolDirectory_Entry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:marketdata.SymbolDirectory.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::SymbolDirectory_Entry >&
+SymbolDirectory::entries() const {
+  // @@protoc_insertion_point(field_list:marketdata.SymbolDirectory.entries)
+  return _impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
+// OrderBookSnapshot
+
+// string instrument_id = 1;
+inline void OrderBookSnapshot::clear_instrument_id() {
+  _impl_.instrument_id_.ClearToEmpty();
+}
+inline const std::string& OrderBookSnapshot::instrument_id() const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookSnapshot.instrument_id)
+  return _internal_instrument_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OrderBookSnapshot::set_instrument_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.instrument_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:marketdata.OrderBookSnapshot.instrument_id)
+}
+inline std::string* OrderBookSnapshot::mutable_instrument_id() {
+  std::string* _s = _internal_mutable_instrument_id();
+  // @@protoc_insertion_point(field_mutable:marketdata.OrderBookSnapshot.instrument_id)
+  return _s;
+}
+inline const std::string& OrderBookSnapshot::_internal_instrument_id() const {
+  return _impl_.instrument_id_.Get();
+}
+inline void OrderBookSnapshot::_internal_set_instrument_id(const std::string& value) {
+  
+  _impl_.instrument_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OrderBookSnapshot::_internal_mutable_instrument_id() {
+  
+  return _impl_.instrument_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OrderBookSnapshot::release_instrument_id() {
+  // @@protoc_insertion_point(field_release:marketdata.OrderBookSnapshot.instrument_id)
+  return _impl_.instrument_id_.Release();
+}
+inline void OrderBookSnapshot::set_allocated_instrument_id(std::string* instrument_id) {
+  if (instrument_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.instrument_id_.SetAllocated(instrument_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.instrument_id_.IsDefault()) {
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:marketdata.OrderBookSnapshot.instrument_id)
+}
+
+// repeated .marketdata.PriceLevel bids = 2;
+inline int OrderBookSnapshot::_internal_bids_size() const {
+  return _impl_.bids_.size();
+}
+inline int OrderBookSnapshot::bids_size() const {
+  return _internal_bids_size();
+}
+inline void OrderBookSnapshot::clear_bids() {
+  _impl_.bids_.Clear();
+}
+inline ::marketdata::PriceLevel* OrderBookSnapshot::mutable_bids(int index) {
+  // @@protoc_insertion_point(field_mutable:marketdata.OrderBookSnapshot.bids)
+  return _impl_.bids_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >*
+OrderBookSnapshot::mutable_bids() {
+  // @@protoc_insertion_point(field_mutable_list:marketdata.OrderBookSnapshot.bids)
+  return &_impl_.bids_;
+}
+inline const ::marketdata::PriceLevel& OrderBookSnapshot::_internal_bids(int index) const {
+  return _impl_.bids_.Get(index);
+}
+inline const ::marketdata::PriceLevel& OrderBookSnapshot::bids(int index) const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookSnapshot.bids)
+  return _internal_bids(index);
+}
+inline ::marketdata::PriceLevel* OrderBookSnapshot::_internal_add_bids() {
+  return _impl_.bids_.Add();
+}
+inline ::marketdata::PriceLevel* OrderBookSnapshot::add_bids() {
+  ::marketdata::PriceLevel* _add = _internal_add_bids();
+  // @@protoc_insertion_point(field_add:marketdata.OrderBookSnapshot.bids)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >&
+OrderBookSnapshot::bids() const {
+  // @@protoc_insertion_point(field_list:marketdata.OrderBookSnapshot.bids)
+  return _impl_.bids_;
+}
+
+// repeated .marketdata.PriceLevel asks = 3;
+inline int OrderBookSnapshot::_internal_asks_size() const {
+  return _impl_.asks_.size();
+}
+inline int OrderBookSnapshot::asks_size() const {
+  return _internal_asks_size();
+}
+inline void OrderBookSnapshot::clear_asks() {
+  _impl_.asks_.Clear();
+}
+inline ::marketdata::PriceLevel* OrderBookSnapshot::mutable_asks(int index) {
+  // @@protoc_insertion_point(field_mutable:marketdata.OrderBookSnapshot.asks)
+  return _impl_.asks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >*
+OrderBookSnapshot::mutable_asks() {
+  // @@protoc_insertion_point(field_mutable_list:marketdata.OrderBookSnapshot.asks)
+  return &_impl_.asks_;
+}
+inline const ::marketdata::PriceLevel& OrderBookSnapshot::_internal_asks(int index) const {
+  return _impl_.asks_.Get(index);
+}
+inline const ::marketdata::PriceLevel& OrderBookSnapshot::asks(int index) const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookSnapshot.asks)
+  return _internal_asks(index);
+}
+inline ::marketdata::PriceLevel* OrderBookSnapshot::_internal_add_asks() {
+  return _impl_.asks_.Add();
+}
+inline ::marketdata::PriceLevel* OrderBookSnapshot::add_asks() {
+  ::marketdata::PriceLevel* _add = _internal_add_asks();
+  // @@protoc_insertion_point(field_add:marketdata.OrderBookSnapshot.asks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >&
+OrderBookSnapshot::asks() const {
+  // @@protoc_insertion_point(field_list:marketdata.OrderBookSnapshot.asks)
+  return _impl_.asks_;
+}
+
+// double tick_size = 4;
+inline void OrderBookSnapshot::clear_tick_size() {
+  _impl_.tick_size_ = 0;
+}
+inline double OrderBookSnapshot::_internal_tick_size() const {
+  return _impl_.tick_size_;
+}
+inline double OrderBookSnapshot::tick_size() const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookSnapshot.tick_size)
+  return _internal_tick_size();
+}
+inline void OrderBookSnapshot::_internal_set_tick_size(double value) {
+  
+  _impl_.tick_size_ = value;
+}
+inline void OrderBookSnapshot::set_tick_size(double value) {
+  _internal_set_tick_size(value);
+  // @@protoc_insertion_point(field_set:marketdata.OrderBookSnapshot.tick_size)
+}
+
+// double lot_size = 5;
+inline void OrderBookSnapshot::clear_lot_size() {
+  _impl_.lot_size_ = 0;
+}
+inline double OrderBookSnapshot::_internal_lot_size() const {
+  return _impl_.lot_size_;
+}
+inline double OrderBookSnapshot::lot_size() const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookSnapshot.lot_size)
+  return _internal_lot_size();
+}
+inline void OrderBookSnapshot::_internal_set_lot_size(double value) {
+  
+  _impl_.lot_size_ = value;
+}
+inline void OrderBookSnapshot::set_lot_size(double value) {
+  _internal_set_lot_size(value);
+  // @@protoc_insertion_point(field_set:marketdata.OrderBookSnapshot.lot_size)
+}
+
+// uint64 sequence = 6;
+inline void OrderBookSnapshot::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
 }
-inline ::marketdata::SubscriptionRequest_Action SubscriptionRequest::action() const {
-  // @@protoc_insertion_point(field_get:marketdata.SubscriptionRequest.action)
-  return _internal_action();
+inline uint64_t OrderBookSnapshot::_internal_sequence() const {
+  return _impl_.sequence_;
 }
-inline void SubscriptionRequest::set_action(::marketdata::SubscriptionRequest_Action value) {
-  _internal_set_action(value);
-  // @@protoc_insertion_point(field_set:marketdata.SubscriptionRequest.action)
+inline uint64_t OrderBookSnapshot::sequence() const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookSnapshot.sequence)
+  return _internal_sequence();
 }
-inline ::marketdata::SubscriptionRequest_Action SubscriptionRequest::_internal_action() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return static_cast<::marketdata::SubscriptionRequest_Action>(_impl_.action_);
+inline void OrderBookSnapshot::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
 }
-inline void SubscriptionRequest::_internal_set_action(::marketdata::SubscriptionRequest_Action value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.action_ = value;
+inline void OrderBookSnapshot::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:marketdata.OrderBookSnapshot.sequence)
 }
 
-// string instrument_id = 2;
-inline void SubscriptionRequest::clear_instrument_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
+// -------------------------------------------------------------------
+
+// OrderBookIncrementalUpdate
+
+// string instrument_id = 1;
+inline void OrderBookIncrementalUpdate::clear_instrument_id() {
   _impl_.instrument_id_.ClearToEmpty();
 }
-inline const std::string& SubscriptionRequest::instrument_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:marketdata.SubscriptionRequest.instrument_id)
+inline const std::string& OrderBookIncrementalUpdate::instrument_id() const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookIncrementalUpdate.instrument_id)
   return _internal_instrument_id();
 }
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void SubscriptionRequest::set_instrument_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.instrument_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:marketdata.SubscriptionRequest.instrument_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OrderBookIncrementalUpdate::set_instrument_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.instrument_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:marketdata.OrderBookIncrementalUpdate.instrument_id)
 }
-inline std::string* SubscriptionRequest::mutable_instrument_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline std::string* OrderBookIncrementalUpdate::mutable_instrument_id() {
   std::string* _s = _internal_mutable_instrument_id();
-  // @@protoc_insertion_point(field_mutable:marketdata.SubscriptionRequest.instrument_id)
+  // @@protoc_insertion_point(field_mutable:marketdata.OrderBookIncrementalUpdate.instrument_id)
   return _s;
 }
-inline const std::string& SubscriptionRequest::_internal_instrument_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
+inline const std::string& OrderBookIncrementalUpdate::_internal_instrument_id() const {
   return _impl_.instrument_id_.Get();
 }
-inline void SubscriptionRequest::_internal_set_instrument_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.instrument_id_.Set(value, GetArena());
+inline void OrderBookIncrementalUpdate::_internal_set_instrument_id(const std::string& value) {
+  
+  _impl_.instrument_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SubscriptionRequest::_internal_mutable_instrument_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.instrument_id_.Mutable( GetArena());
+inline std::string* OrderBookIncrementalUpdate::_internal_mutable_instrument_id() {
+  
+  return _impl_.instrument_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SubscriptionRequest::release_instrument_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:marketdata.SubscriptionRequest.instrument_id)
+inline std::string* OrderBookIncrementalUpdate::release_instrument_id() {
+  // @@protoc_insertion_point(field_release:marketdata.OrderBookIncrementalUpdate.instrument_id)
   return _impl_.instrument_id_.Release();
 }
-inline void SubscriptionRequest::set_allocated_instrument_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.instrument_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.instrument_id_.IsDefault()) {
-    _impl_.instrument_id_.Set("", GetArena());
+inline void OrderBookIncrementalUpdate::set_allocated_instrument_id(std::string* instrument_id) {
+  if (instrument_id != nullptr) {
+    
+  } else {
+    
   }
-  // @@protoc_insertion_point(field_set_allocated:marketdata.SubscriptionRequest.instrument_id)
+  _impl_.instrument_id_.SetAllocated(instrument_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.instrument_id_.IsDefault()) {
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:marketdata.OrderBookIncrementalUpdate.instrument_id)
+}
+
+// repeated .marketdata.PriceLevel bid_updates = 2;
+inline int OrderBookIncrementalUpdate::_internal_bid_updates_size() const {
+  return _impl_.bid_updates_.size();
+}
+inline int OrderBookIncrementalUpdate::bid_updates_size() const {
+  return _internal_bid_updates_size();
+}
+inline void OrderBookIncrementalUpdate::clear_bid_updates() {
+  _impl_.bid_updates_.Clear();
+}
+inline ::marketdata::PriceLevel* OrderBookIncrementalUpdate::mutable_bid_updates(int index) {
+  // @@protoc_insertion_point(field_mutable:marketdata.OrderBookIncrementalUpdate.bid_updates)
+  return _impl_.bid_updates_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >*
+OrderBookIncrementalUpdate::mutable_bid_updates() {
+  // @@protoc_insertion_point(field_mutable_list:marketdata.OrderBookIncrementalUpdate.bid_updates)
+  return &_impl_.bid_updates_;
+}
+inline const ::marketdata::PriceLevel& OrderBookIncrementalUpdate::_internal_bid_updates(int index) const {
+  return _impl_.bid_updates_.Get(index);
+}
+inline const ::marketdata::PriceLevel& OrderBookIncrementalUpdate::bid_updates(int index) const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookIncrementalUpdate.bid_updates)
+  return _internal_bid_updates(index);
+}
+inline ::marketdata::PriceLevel* OrderBookIncrementalUpdate::_internal_add_bid_updates() {
+  return _impl_.bid_updates_.Add();
+}
+inline ::marketdata::PriceLevel* OrderBookIncrementalUpdate::add_bid_updates() {
+  ::marketdata::PriceLevel* _add = _internal_add_bid_updates();
+  // @@protoc_insertion_point(field_add:marketdata.OrderBookIncrementalUpdate.bid_updates)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >&
+OrderBookIncrementalUpdate::bid_updates() const {
+  // @@protoc_insertion_point(field_list:marketdata.OrderBookIncrementalUpdate.bid_updates)
+  return _impl_.bid_updates_;
+}
+
+// repeated .marketdata.PriceLevel ask_updates = 3;
+inline int OrderBookIncrementalUpdate::_internal_ask_updates_size() const {
+  return _impl_.ask_updates_.size();
+}
+inline int OrderBookIncrementalUpdate::ask_updates_size() const {
+  return _internal_ask_updates_size();
+}
+inline void OrderBookIncrementalUpdate::clear_ask_updates() {
+  _impl_.ask_updates_.Clear();
+}
+inline ::marketdata::PriceLevel* OrderBookIncrementalUpdate::mutable_ask_updates(int index) {
+  // @@protoc_insertion_point(field_mutable:marketdata.OrderBookIncrementalUpdate.ask_updates)
+  return _impl_.ask_updates_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >*
+OrderBookIncrementalUpdate::mutable_ask_updates() {
+  // @@protoc_insertion_point(field_mutable_list:marketdata.OrderBookIncrementalUpdate.ask_updates)
+  return &_impl_.ask_updates_;
+}
+inline const ::marketdata::PriceLevel& OrderBookIncrementalUpdate::_internal_ask_updates(int index) const {
+  return _impl_.ask_updates_.Get(index);
+}
+inline const ::marketdata::PriceLevel& OrderBookIncrementalUpdate::ask_updates(int index) const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookIncrementalUpdate.ask_updates)
+  return _internal_ask_updates(index);
+}
+inline ::marketdata::PriceLevel* OrderBookIncrementalUpdate::_internal_add_ask_updates() {
+  return _impl_.ask_updates_.Add();
+}
+inline ::marketdata::PriceLevel* OrderBookIncrementalUpdate::add_ask_updates() {
+  ::marketdata::PriceLevel* _add = _internal_add_ask_updates();
+  // @@protoc_insertion_point(field_add:marketdata.OrderBookIncrementalUpdate.ask_updates)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::PriceLevel >&
+OrderBookIncrementalUpdate::ask_updates() const {
+  // @@protoc_insertion_point(field_list:marketdata.OrderBookIncrementalUpdate.ask_updates)
+  return _impl_.ask_updates_;
+}
+
+// uint32 instrument_handle = 4;
+inline void OrderBookIncrementalUpdate::clear_instrument_handle() {
+  _impl_.instrument_handle_ = 0u;
+}
+inline uint32_t OrderBookIncrementalUpdate::_internal_instrument_handle() const {
+  return _impl_.instrument_handle_;
+}
+inline uint32_t OrderBookIncrementalUpdate::instrument_handle() const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookIncrementalUpdate.instrument_handle)
+  return _internal_instrument_handle();
+}
+inline void OrderBookIncrementalUpdate::_internal_set_instrument_handle(uint32_t value) {
+  
+  _impl_.instrument_handle_ = value;
+}
+inline void OrderBookIncrementalUpdate::set_instrument_handle(uint32_t value) {
+  _internal_set_instrument_handle(value);
+  // @@protoc_insertion_point(field_set:marketdata.OrderBookIncrementalUpdate.instrument_handle)
+}
+
+// uint64 sequence = 5;
+inline void OrderBookIncrementalUpdate::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+}
+inline uint64_t OrderBookIncrementalUpdate::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t OrderBookIncrementalUpdate::sequence() const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookIncrementalUpdate.sequence)
+  return _internal_sequence();
+}
+inline void OrderBookIncrementalUpdate::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void OrderBookIncrementalUpdate::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:marketdata.OrderBookIncrementalUpdate.sequence)
+}
+
+// uint64 first_sequence = 6;
+inline void OrderBookIncrementalUpdate::clear_first_sequence() {
+  _impl_.first_sequence_ = uint64_t{0u};
+}
+inline uint64_t OrderBookIncrementalUpdate::_internal_first_sequence() const {
+  return _impl_.first_sequence_;
+}
+inline uint64_t OrderBookIncrementalUpdate::first_sequence() const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookIncrementalUpdate.first_sequence)
+  return _internal_first_sequence();
+}
+inline void OrderBookIncrementalUpdate::_internal_set_first_sequence(uint64_t value) {
+  
+  _impl_.first_sequence_ = value;
+}
+inline void OrderBookIncrementalUpdate::set_first_sequence(uint64_t value) {
+  _internal_set_first_sequence(value);
+  // @@protoc_insertion_point(field_set:marketdata.OrderBookIncrementalUpdate.first_sequence)
+}
+
+// fixed64 publish_timestamp_ns = 7;
+inline void OrderBookIncrementalUpdate::clear_publish_timestamp_ns() {
+  _impl_.publish_timestamp_ns_ = uint64_t{0u};
+}
+inline uint64_t OrderBookIncrementalUpdate::_internal_publish_timestamp_ns() const {
+  return _impl_.publish_timestamp_ns_;
+}
+inline uint64_t OrderBookIncrementalUpdate::publish_timestamp_ns() const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookIncrementalUpdate.publish_timestamp_ns)
+  return _internal_publish_timestamp_ns();
+}
+inline void OrderBookIncrementalUpdate::_internal_set_publish_timestamp_ns(uint64_t value) {
+  
+  _impl_.publish_timestamp_ns_ = value;
+}
+inline void OrderBookIncrementalUpdate::set_publish_timestamp_ns(uint64_t value) {
+  _internal_set_publish_timestamp_ns(value);
+  // @@protoc_insertion_point(field_set:marketdata.OrderBookIncrementalUpdate.publish_timestamp_ns)
+}
+
+// sint64 base_price_ticks = 8;
+inline void OrderBookIncrementalUpdate::clear_base_price_ticks() {
+  _impl_.base_price_ticks_ = int64_t{0};
+}
+inline int64_t OrderBookIncrementalUpdate::_internal_base_price_ticks() const {
+  return _impl_.base_price_ticks_;
+}
+inline int64_t OrderBookIncrementalUpdate::base_price_ticks() const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookIncrementalUpdate.base_price_ticks)
+  return _internal_base_price_ticks();
+}
+inline void OrderBookIncrementalUpdate::_internal_set_base_price_ticks(int64_t value) {
+  
+  _impl_.base_price_ticks_ = value;
+}
+inline void OrderBookIncrementalUpdate::set_base_price_ticks(int64_t value) {
+  _internal_set_base_price_ticks(value);
+  // @@protoc_insertion_point(field_set:marketdata.OrderBookIncrementalUpdate.base_price_ticks)
+}
+
+// repeated sint32 price_deltas = 9;
+inline int OrderBookIncrementalUpdate::_internal_price_deltas_size() const {
+  return _impl_.price_deltas_.size();
+}
+inline int OrderBookIncrementalUpdate::price_deltas_size() const {
+  return _internal_price_deltas_size();
+}
+inline void OrderBookIncrementalUpdate::clear_price_deltas() {
+  _impl_.price_deltas_.Clear();
+}
+inline int32_t OrderBookIncrementalUpdate::_internal_price_deltas(int index) const {
+  return _impl_.price_deltas_.Get(index);
+}
+inline int32_t OrderBookIncrementalUpdate::price_deltas(int index) const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookIncrementalUpdate.price_deltas)
+  return _internal_price_deltas(index);
+}
+inline void OrderBookIncrementalUpdate::set_price_deltas(int index, int32_t value) {
+  _impl_.price_deltas_.Set(index, value);
+  // @@protoc_insertion_point(field_set:marketdata.OrderBookIncrementalUpdate.price_deltas)
+}
+inline void OrderBookIncrementalUpdate::_internal_add_price_deltas(int32_t value) {
+  _impl_.price_deltas_.Add(value);
+}
+inline void OrderBookIncrementalUpdate::add_price_deltas(int32_t value) {
+  _internal_add_price_deltas(value);
+  // @@protoc_insertion_point(field_add:marketdata.OrderBookIncrementalUpdate.price_deltas)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+OrderBookIncrementalUpdate::_internal_price_deltas() const {
+  return _impl_.price_deltas_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+OrderBookIncrementalUpdate::price_deltas() const {
+  // @@protoc_insertion_point(field_list:marketdata.OrderBookIncrementalUpdate.price_deltas)
+  return _internal_price_deltas();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+OrderBookIncrementalUpdate::_internal_mutable_price_deltas() {
+  return &_impl_.price_deltas_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+OrderBookIncrementalUpdate::mutable_price_deltas() {
+  // @@protoc_insertion_point(field_mutable_list:marketdata.OrderBookIncrementalUpdate.price_deltas)
+  return _internal_mutable_price_deltas();
+}
+
+// repeated uint64 quantity_lots = 10;
+inline int OrderBookIncrementalUpdate::_internal_quantity_lots_size() const {
+  return _impl_.quantity_lots_.size();
+}
+inline int OrderBookIncrementalUpdate::quantity_lots_size() const {
+  return _internal_quantity_lots_size();
+}
+inline void OrderBookIncrementalUpdate::clear_quantity_lots() {
+  _impl_.quantity_lots_.Clear();
+}
+inline uint64_t OrderBookIncrementalUpdate::_internal_quantity_lots(int index) const {
+  return _impl_.quantity_lots_.Get(index);
+}
+inline uint64_t OrderBookIncrementalUpdate::quantity_lots(int index) const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookIncrementalUpdate.quantity_lots)
+  return _internal_quantity_lots(index);
+}
+inline void OrderBookIncrementalUpdate::set_quantity_lots(int index, uint64_t value) {
+  _impl_.quantity_lots_.Set(index, value);
+  // @@protoc_insertion_point(field_set:marketdata.OrderBookIncrementalUpdate.quantity_lots)
+}
+inline void OrderBookIncrementalUpdate::_internal_add_quantity_lots(uint64_t value) {
+  _impl_.quantity_lots_.Add(value);
+}
+inline void OrderBookIncrementalUpdate::add_quantity_lots(uint64_t value) {
+  _internal_add_quantity_lots(value);
+  // @@protoc_insertion_point(field_add:marketdata.OrderBookIncrementalUpdate.quantity_lots)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+OrderBookIncrementalUpdate::_internal_quantity_lots() const {
+  return _impl_.quantity_lots_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+OrderBookIncrementalUpdate::quantity_lots() const {
+  // @@protoc_insertion_point(field_list:marketdata.OrderBookIncrementalUpdate.quantity_lots)
+  return _internal_quantity_lots();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+OrderBookIncrementalUpdate::_internal_mutable_quantity_lots() {
+  return &_impl_.quantity_lots_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+OrderBookIncrementalUpdate::mutable_quantity_lots() {
+  // @@protoc_insertion_point(field_mutable_list:marketdata.OrderBookIncrementalUpdate.quantity_lots)
+  return _internal_mutable_quantity_lots();
+}
+
+// uint32 bid_count = 11;
+inline void OrderBookIncrementalUpdate::clear_bid_count() {
+  _impl_.bid_count_ = 0u;
+}
+inline uint32_t OrderBookIncrementalUpdate::_internal_bid_count() const {
+  return _impl_.bid_count_;
+}
+inline uint32_t OrderBookIncrementalUpdate::bid_count() const {
+  // @@protoc_insertion_point(field_get:marketdata.OrderBookIncrementalUpdate.bid_count)
+  return _internal_bid_count();
+}
+inline void OrderBookIncrementalUpdate::_internal_set_bid_count(uint32_t value) {
+  
+  _impl_.bid_count_ = value;
+}
+inline void OrderBookIncrementalUpdate::set_bid_count(uint32_t value) {
+  _internal_set_bid_count(value);
+  // @@protoc_insertion_point(field_set:marketdata.OrderBookIncrementalUpdate.bid_count)
 }
 
 // -------------------------------------------------------------------
 
-// MarketDataUpdate
+// PriceLevel
 
-// .marketdata.OrderBookSnapshot snapshot = 1;
-inline bool MarketDataUpdate::has_snapshot() const {
-  return update_type_case() == kSnapshot;
+// double price = 1;
+inline void PriceLevel::clear_price() {
+  _impl_.price_ = 0;
 }
-inline bool MarketDataUpdate::_internal_has_snapshot() const {
-  return update_type_case() == kSnapshot;
+inline double PriceLevel::_internal_price() const {
+  return _impl_.price_;
 }
-inline void MarketDataUpdate::set_has_snapshot() {
-  _impl_._oneof_case_[0] = kSnapshot;
+inline double PriceLevel::price() const {
+  // @@protoc_insertion_point(field_get:marketdata.PriceLevel.price)
+  return _internal_price();
 }
-inline void MarketDataUpdate::clear_snapshot() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (update_type_case() == kSnapshot) {
-    if (GetArena() == nullptr) {
-      delete _impl_.update_type_.snapshot_;
-    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.update_type_.snapshot_);
-    }
-    clear_has_update_type();
-  }
+inline void PriceLevel::_internal_set_price(double value) {
+  
+  _impl_.price_ = value;
 }
-inline ::marketdata::OrderBookSnapshot* MarketDataUpdate::release_snapshot() {
-  // @@protoc_insertion_point(field_release:marketdata.MarketDataUpdate.snapshot)
-  if (update_type_case() == kSnapshot) {
-    clear_has_update_type();
-    auto* temp = _impl_.update_type_.snapshot_;
-    if (GetArena() != nullptr) {
-      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
-    }
-    _impl_.update_type_.snapshot_ = nullptr;
-    return temp;
+inline void PriceLevel::set_price(double value) {
+  _internal_set_price(value);
+  // @@protoc_insertion_point(field_set:marketdata.PriceLevel.price)
+}
+
+// double quantity = 2;
+inline void PriceLevel::clear_quantity() {
+  _impl_.quantity_ = 0;
+}
+inline double PriceLevel::_internal_quantity() const {
+  return _impl_.quantity_;
+}
+inline double PriceLevel::quantity() const {
+  // @@protoc_insertion_point(field_get:marketdata.PriceLevel.quantity)
+  return _internal_quantity();
+}
+inline void PriceLevel::_internal_set_quantity(double value) {
+  
+  _impl_.quantity_ = value;
+}
+inline void PriceLevel::set_quantity(double value) {
+  _internal_set_quantity(value);
+  // @@protoc_insertion_point(field_set:marketdata.PriceLevel.quantity)
+}
+
+// sint64 price_ticks = 3;
+inline void PriceLevel::clear_price_ticks() {
+  _impl_.price_ticks_ = int64_t{0};
+}
+inline int64_t PriceLevel::_internal_price_ticks() const {
+  return _impl_.price_ticks_;
+}
+inline int64_t PriceLevel::price_ticks() const {
+  // @@protoc_insertion_point(field_get:marketdata.PriceLevel.price_ticks)
+  return _internal_price_ticks();
+}
+inline void PriceLevel::_internal_set_price_ticks(int64_t value) {
+  
+  _impl_.price_ticks_ = value;
+}
+inline void PriceLevel::set_price_ticks(int64_t value) {
+  _internal_set_price_ticks(value);
+  // @@protoc_insertion_point(field_set:marketdata.PriceLevel.price_ticks)
+}
+
+// int64 quantity_lots = 4;
+inline void PriceLevel::clear_quantity_lots() {
+  _impl_.quantity_lots_ = int64_t{0};
+}
+inline int64_t PriceLevel::_internal_quantity_lots() const {
+  return _impl_.quantity_lots_;
+}
+inline int64_t PriceLevel::quantity_lots() const {
+  // @@protoc_insertion_point(field_get:marketdata.PriceLevel.quantity_lots)
+  return _internal_quantity_lots();
+}
+inline void PriceLevel::_internal_set_quantity_lots(int64_t value) {
+  
+  _impl_.quantity_lots_ = value;
+}
+inline void PriceLevel::set_quantity_lots(int64_t value) {
+  _internal_set_quantity_lots(value);
+  // @@protoc_insertion_point(field_set:marketdata.PriceLevel.quantity_lots)
+}
+
+// -------------------------------------------------------------------
+
+// StatsRequest
+
+// -------------------------------------------------------------------
+
+// StreamStats
+
+// uint64 stream_id = 1;
+inline void StreamStats::clear_stream_id() {
+  _impl_.stream_id_ = uint64_t{0u};
+}
+inline uint64_t StreamStats::_internal_stream_id() const {
+  return _impl_.stream_id_;
+}
+inline uint64_t StreamStats::stream_id() const {
+  // @@protoc_insertion_point(field_get:marketdata.StreamStats.stream_id)
+  return _internal_stream_id();
+}
+inline void StreamStats::_internal_set_stream_id(uint64_t value) {
+  
+  _impl_.stream_id_ = value;
+}
+inline void StreamStats::set_stream_id(uint64_t value) {
+  _internal_set_stream_id(value);
+  // @@protoc_insertion_point(field_set:marketdata.StreamStats.stream_id)
+}
+
+// string peer = 2;
+inline void StreamStats::clear_peer() {
+  _impl_.peer_.ClearToEmpty();
+}
+inline const std::string& StreamStats::peer() const {
+  // @@protoc_insertion_point(field_get:marketdata.StreamStats.peer)
+  return _internal_peer();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StreamStats::set_peer(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.peer_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:marketdata.StreamStats.peer)
+}
+inline std::string* StreamStats::mutable_peer() {
+  std::string* _s = _internal_mutable_peer();
+  // @@protoc_insertion_point(field_mutable:marketdata.StreamStats.peer)
+  return _s;
+}
+inline const std::string& StreamStats::_internal_peer() const {
+  return _impl_.peer_.Get();
+}
+inline void StreamStats::_internal_set_peer(const std::string& value) {
+  
+  _impl_.peer_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StreamStats::_internal_mutable_peer() {
+  
+  return _impl_.peer_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StreamStats::release_peer() {
+  // @@protoc_insertion_point(field_release:marketdata.StreamStats.peer)
+  return _impl_.peer_.Release();
+}
+inline void StreamStats::set_allocated_peer(std::string* peer) {
+  if (peer != nullptr) {
+    
   } else {
-    return nullptr;
+    
   }
+  _impl_.peer_.SetAllocated(peer, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.peer_.IsDefault()) {
+    _impl_.peer_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:marketdata.StreamStats.peer)
+}
+
+// uint32 subscriptions = 3;
+inline void StreamStats::clear_subscriptions() {
+  _impl_.subscriptions_ = 0u;
+}
+inline uint32_t StreamStats::_internal_subscriptions() const {
+  return _impl_.subscriptions_;
+}
+inline uint32_t StreamStats::subscriptions() const {
+  // @@protoc_insertion_point(field_get:marketdata.StreamStats.subscriptions)
+  return _internal_subscriptions();
+}
+inline void StreamStats::_internal_set_subscriptions(uint32_t value) {
+  
+  _impl_.subscriptions_ = value;
+}
+inline void StreamStats::set_subscriptions(uint32_t value) {
+  _internal_set_subscriptions(value);
+  // @@protoc_insertion_point(field_set:marketdata.StreamStats.subscriptions)
+}
+
+// uint64 messages_sent = 4;
+inline void StreamStats::clear_messages_sent() {
+  _impl_.messages_sent_ = uint64_t{0u};
+}
+inline uint64_t StreamStats::_internal_messages_sent() const {
+  return _impl_.messages_sent_;
+}
+inline uint64_t StreamStats::messages_sent() const {
+  // @@protoc_insertion_point(field_get:marketdata.StreamStats.messages_sent)
+  return _internal_messages_sent();
+}
+inline void StreamStats::_internal_set_messages_sent(uint64_t value) {
+  
+  _impl_.messages_sent_ = value;
+}
+inline void StreamStats::set_messages_sent(uint64_t value) {
+  _internal_set_messages_sent(value);
+  // @@protoc_insertion_point(field_set:marketdata.StreamStats.messages_sent)
+}
+
+// uint64 bytes_sent = 5;
+inline void StreamStats::clear_bytes_sent() {
+  _impl_.bytes_sent_ = uint64_t{0u};
+}
+inline uint64_t StreamStats::_internal_bytes_sent() const {
+  return _impl_.bytes_sent_;
+}
+inline uint64_t StreamStats::bytes_sent() const {
+  // @@protoc_insertion_point(field_get:marketdata.StreamStats.bytes_sent)
+  return _internal_bytes_sent();
+}
+inline void StreamStats::_internal_set_bytes_sent(uint64_t value) {
+  
+  _impl_.bytes_sent_ = value;
 }
-inline const ::marketdata::OrderBookSnapshot& MarketDataUpdate::_internal_snapshot() const {
-  return update_type_case() == kSnapshot ? *_impl_.update_type_.snapshot_ : reinterpret_cast<::marketdata::OrderBookSnapshot&>(::marketdata::_OrderBookSnapshot_default_instance_);
+inline void StreamStats::set_bytes_sent(uint64_t value) {
+  _internal_set_bytes_sent(value);
+  // @@protoc_insertion_point(field_set:marketdata.StreamStats.bytes_sent)
 }
-inline const ::marketdata::OrderBookSnapshot& MarketDataUpdate::snapshot() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:marketdata.MarketDataUpdate.snapshot)
-  return _internal_snapshot();
+
+// uint64 write_blocked_ns = 6;
+inline void StreamStats::clear_write_blocked_ns() {
+  _impl_.write_blocked_ns_ = uint64_t{0u};
 }
-inline ::marketdata::OrderBookSnapshot* MarketDataUpdate::unsafe_arena_release_snapshot() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:marketdata.MarketDataUpdate.snapshot)
-  if (update_type_case() == kSnapshot) {
-    clear_has_update_type();
-    auto* temp = _impl_.update_type_.snapshot_;
-    _impl_.update_type_.snapshot_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline uint64_t StreamStats::_internal_write_blocked_ns() const {
+  return _impl_.write_blocked_ns_;
 }
-inline void MarketDataUpdate::unsafe_arena_set_allocated_snapshot(::marketdata::OrderBookSnapshot* value) {
-  // We rely on the oneof clear method to free the earlier contents
-  // of this oneof. We can directly use the pointer we're given to
-  // set the new value.
-  clear_update_type();
-  if (value) {
-    set_has_snapshot();
-    _impl_.update_type_.snapshot_ = value;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:marketdata.MarketDataUpdate.snapshot)
+inline uint64_t StreamStats::write_blocked_ns() const {
+  // @@protoc_insertion_point(field_get:marketdata.StreamStats.write_blocked_ns)
+  return _internal_write_blocked_ns();
 }
-inline ::marketdata::OrderBookSnapshot* MarketDataUpdate::_internal_mutable_snapshot() {
-  if (update_type_case() != kSnapshot) {
-    clear_update_type();
-    set_has_snapshot();
-    _impl_.update_type_.snapshot_ =
-        ::google::protobuf::Message::DefaultConstruct<::marketdata::OrderBookSnapshot>(GetArena());
-  }
-  return _impl_.update_type_.snapshot_;
+inline void StreamStats::_internal_set_write_blocked_ns(uint64_t value) {
+  
+  _impl_.write_blocked_ns_ = value;
 }
-inline ::marketdata::OrderBookSnapshot* MarketDataUpdate::mutable_snapshot() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::marketdata::OrderBookSnapshot* _msg = _internal_mutable_snapshot();
-  // @@protoc_insertion_point(field_mutable:marketdata.MarketDataUpdate.snapshot)
-  return _msg;
+inline void StreamStats::set_write_blocked_ns(uint64_t value) {
+  _internal_set_write_blocked_ns(value);
+  // @@protoc_insertion_point(field_set:marketdata.StreamStats.write_blocked_ns)
 }
 
-// .marketdata.OrderBookIncrementalUpdate incremental_update = 2;
-inline bool MarketDataUpdate::has_incremental_update() const {
-  return update_type_case() == kIncrementalUpdate;
+// uint64 queue_depth = 7;
+inline void StreamStats::clear_queue_depth() {
+  _impl_.queue_depth_ = uint64_t{0u};
 }
-inline bool MarketDataUpdate::_internal_has_incremental_update() const {
-  return update_type_case() == kIncrementalUpdate;
+inline uint64_t StreamStats::_internal_queue_depth() const {
+  return _impl_.queue_depth_;
 }
-inline void MarketDataUpdate::set_has_incremental_update() {
-  _impl_._oneof_case_[0] = kIncrementalUpdate;
+inline uint64_t StreamStats::queue_depth() const {
+  // @@protoc_insertion_point(field_get:marketdata.StreamStats.queue_depth)
+  return _internal_queue_depth();
 }
-inline void MarketDataUpdate::clear_incremental_update() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (update_type_case() == kIncrementalUpdate) {
-    if (GetArena() == nullptr) {
-      delete _impl_.update_type_.incremental_update_;
-    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.update_type_.incremental_update_);
-    }
-    clear_has_update_type();
-  }
+inline void StreamStats::_internal_set_queue_depth(uint64_t value) {
+  
+  _impl_.queue_depth_ = value;
 }
-inline ::marketdata::OrderBookIncrementalUpdate* MarketDataUpdate::release_incremental_update() {
-  // @@protoc_insertion_point(field_release:marketdata.MarketDataUpdate.incremental_update)
-  if (update_type_case() == kIncrementalUpdate) {
-    clear_has_update_type();
-    auto* temp = _impl_.update_type_.incremental_update_;
-    if (GetArena() != nullptr) {
-      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
-    }
-    _impl_.update_type_.incremental_update_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void StreamStats::set_queue_depth(uint64_t value) {
+  _internal_set_queue_depth(value);
+  // @@protoc_insertion_point(field_set:marketdata.StreamStats.queue_depth)
 }
-inline const ::marketdata::OrderBookIncrementalUpdate& MarketDataUpdate::_internal_incremental_update() const {
-  return update_type_case() == kIncrementalUpdate ? *_impl_.update_type_.incremental_update_ : reinterpret_cast<::marketdata::OrderBookIncrementalUpdate&>(::marketdata::_OrderBookIncrementalUpdate_default_instance_);
+
+// uint64 max_queue_depth = 8;
+inline void StreamStats::clear_max_queue_depth() {
+  _impl_.max_queue_depth_ = uint64_t{0u};
 }
-inline const ::marketdata::OrderBookIncrementalUpdate& MarketDataUpdate::incremental_update() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:marketdata.MarketDataUpdate.incremental_update)
-  return _internal_incremental_update();
+inline uint64_t StreamStats::_internal_max_queue_depth() const {
+  return _impl_.max_queue_depth_;
 }
-inline ::marketdata::OrderBookIncrementalUpdate* MarketDataUpdate::unsafe_arena_release_incremental_update() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:marketdata.MarketDataUpdate.incremental_update)
-  if (update_type_case() == kIncrementalUpdate) {
-    clear_has_update_type();
-    auto* temp = _impl_.update_type_.incremental_update_;
-    _impl_.update_type_.incremental_update_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline uint64_t StreamStats::max_queue_depth() const {
+  // @@protoc_insertion_point(field_get:marketdata.StreamStats.max_queue_depth)
+  return _internal_max_queue_depth();
 }
-inline void MarketDataUpdate::unsafe_arena_set_allocated_incremental_update(::marketdata::OrderBookIncrementalUpdate* value) {
-  // We rely on the oneof clear method to free the earlier contents
-  // of this oneof. We can directly use the pointer we're given to
-  // set the new value.
-  clear_update_type();
-  if (value) {
-    set_has_incremental_update();
-    _impl_.update_type_.incremental_update_ = value;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:marketdata.MarketDataUpdate.incremental_update)
+inline void StreamStats::_internal_set_max_queue_depth(uint64_t value) {
+  
+  _impl_.max_queue_depth_ = value;
 }
-inline ::marketdata::OrderBookIncrementalUpdate* MarketDataUpdate::_internal_mutable_incremental_update() {
-  if (update_type_case() != kIncrementalUpdate) {
-    clear_update_type();
-    set_has_incremental_update();
-    _impl_.update_type_.incremental_update_ =
-        ::google::protobuf::Message::DefaultConstruct<::marketdata::OrderBookIncrementalUpdate>(GetArena());
-  }
-  return _impl_.update_type_.incremental_update_;
+inline void StreamStats::set_max_queue_depth(uint64_t value) {
+  _internal_set_max_queue_depth(value);
+  // @@protoc_insertion_point(field_set:marketdata.StreamStats.max_queue_depth)
 }
-inline ::marketdata::OrderBookIncrementalUpdate* MarketDataUpdate::mutable_incremental_update() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::marketdata::OrderBookIncrementalUpdate* _msg = _internal_mutable_incremental_update();
-  // @@protoc_insertion_point(field_mutable:marketdata.MarketDataUpdate.incremental_update)
-  return _msg;
+
+// uint64 updates_conflated = 9;
+inline void StreamStats::clear_updates_conflated() {
+  _impl_.updates_conflated_ = uint64_t{0u};
+}
+inline uint64_t StreamStats::_internal_updates_conflated() const {
+  return _impl_.updates_conflated_;
+}
+inline uint64_t StreamStats::updates_conflated() const {
+  // @@protoc_insertion_point(field_get:marketdata.StreamStats.updates_conflated)
+  return _internal_updates_conflated();
+}
+inline void StreamStats::_internal_set_updates_conflated(uint64_t value) {
+  
+  _impl_.updates_conflated_ = value;
+}
+inline void StreamStats::set_updates_conflated(uint64_t value) {
+  _internal_set_updates_conflated(value);
+  // @@protoc_insertion_point(field_set:marketdata.StreamStats.updates_conflated)
 }
 
-inline bool MarketDataUpdate::has_update_type() const {
-  return update_type_case() != UPDATE_TYPE_NOT_SET;
+// uint64 updates_dropped = 10;
+inline void StreamStats::clear_updates_dropped() {
+  _impl_.updates_dropped_ = uint64_t{0u};
 }
-inline void MarketDataUpdate::clear_has_update_type() {
-  _impl_._oneof_case_[0] = UPDATE_TYPE_NOT_SET;
+inline uint64_t StreamStats::_internal_updates_dropped() const {
+  return _impl_.updates_dropped_;
 }
-inline MarketDataUpdate::UpdateTypeCase MarketDataUpdate::update_type_case() const {
-  return MarketDataUpdate::UpdateTypeCase(_impl_._oneof_case_[0]);
+inline uint64_t StreamStats::updates_dropped() const {
+  // @@protoc_insertion_point(field_get:marketdata.StreamStats.updates_dropped)
+  return _internal_updates_dropped();
 }
+inline void StreamStats::_internal_set_updates_dropped(uint64_t value) {
+  
+  _impl_.updates_dropped_ = value;
+}
+inline void StreamStats::set_updates_dropped(uint64_t value) {
+  _internal_set_updates_dropped(value);
+  // @@protoc_insertion_point(field_set:marketdata.StreamStats.updates_dropped)
+}
+
 // -------------------------------------------------------------------
 
-// OrderBookSnapshot
+// InstrumentStats
 
 // string instrument_id = 1;
-inline void OrderBookSnapshot::clear_instrument_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
+inline void InstrumentStats::clear_instrument_id() {
   _impl_.instrument_id_.ClearToEmpty();
 }
-inline const std::string& OrderBookSnapshot::instrument_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:marketdata.OrderBookSnapshot.instrument_id)
+inline const std::string& InstrumentStats::instrument_id() const {
+  // @@protoc_insertion_point(field_get:marketdata.InstrumentStats.instrument_id)
   return _internal_instrument_id();
 }
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void OrderBookSnapshot::set_instrument_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.instrument_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:marketdata.OrderBookSnapshot.instrument_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InstrumentStats::set_instrument_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.instrument_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:marketdata.InstrumentStats.instrument_id)
 }
-inline std::string* OrderBookSnapshot::mutable_instrument_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline std::string* InstrumentStats::mutable_instrument_id() {
   std::string* _s = _internal_mutable_instrument_id();
-  // @@protoc_insertion_point(field_mutable:marketdata.OrderBookSnapshot.instrument_id)
+  // @@protoc_insertion_point(field_mutable:marketdata.InstrumentStats.instrument_id)
   return _s;
 }
-inline const std::string& OrderBookSnapshot::_internal_instrument_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
+inline const std::string& InstrumentStats::_internal_instrument_id() const {
   return _impl_.instrument_id_.Get();
 }
-inline void OrderBookSnapshot::_internal_set_instrument_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.instrument_id_.Set(value, GetArena());
+inline void InstrumentStats::_internal_set_instrument_id(const std::string& value) {
+  
+  _impl_.instrument_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* OrderBookSnapshot::_internal_mutable_instrument_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.instrument_id_.Mutable( GetArena());
+inline std::string* InstrumentStats::_internal_mutable_instrument_id() {
+  
+  return _impl_.instrument_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* OrderBookSnapshot::release_instrument_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:marketdata.OrderBookSnapshot.instrument_id)
+inline std::string* InstrumentStats::release_instrument_id() {
+  // @@protoc_insertion_point(field_release:marketdata.InstrumentStats.instrument_id)
   return _impl_.instrument_id_.Release();
 }
-inline void OrderBookSnapshot::set_allocated_instrument_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.instrument_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.instrument_id_.IsDefault()) {
-    _impl_.instrument_id_.Set("", GetArena());
+inline void InstrumentStats::set_allocated_instrument_id(std::string* instrument_id) {
+  if (instrument_id != nullptr) {
+    
+  } else {
+    
   }
-  // @@protoc_insertion_point(field_set_allocated:marketdata.OrderBookSnapshot.instrument_id)
+  _impl_.instrument_id_.SetAllocated(instrument_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.instrument_id_.IsDefault()) {
+    _impl_.instrument_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:marketdata.InstrumentStats.instrument_id)
 }
 
-// repeated .marketdata.PriceLevel bids = 2;
-inline int OrderBookSnapshot::_internal_bids_size() const {
-  return _internal_bids().size();
+// uint32 subscribers = 2;
+inline void InstrumentStats::clear_subscribers() {
+  _impl_.subscribers_ = 0u;
 }
-inline int OrderBookSnapshot::bids_size() const {
-  return _internal_bids_size();
+inline uint32_t InstrumentStats::_internal_subscribers() const {
+  return _impl_.subscribers_;
 }
-inline void OrderBookSnapshot::clear_bids() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.bids_.Clear();
+inline uint32_t InstrumentStats::subscribers() const {
+  // @@protoc_insertion_point(field_get:marketdata.InstrumentStats.subscribers)
+  return _internal_subscribers();
 }
-inline ::marketdata::PriceLevel* OrderBookSnapshot::mutable_bids(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:marketdata.OrderBookSnapshot.bids)
-  return _internal_mutable_bids()->Mutable(index);
+inline void InstrumentStats::_internal_set_subscribers(uint32_t value) {
+  
+  _impl_.subscribers_ = value;
 }
-inline ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>* OrderBookSnapshot::mutable_bids()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:marketdata.OrderBookSnapshot.bids)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_bids();
+inline void InstrumentStats::set_subscribers(uint32_t value) {
+  _internal_set_subscribers(value);
+  // @@protoc_insertion_point(field_set:marketdata.InstrumentStats.subscribers)
 }
-inline const ::marketdata::PriceLevel& OrderBookSnapshot::bids(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:marketdata.OrderBookSnapshot.bids)
-  return _internal_bids().Get(index);
+
+// uint64 updates_published = 3;
+inline void InstrumentStats::clear_updates_published() {
+  _impl_.updates_published_ = uint64_t{0u};
 }
-inline ::marketdata::PriceLevel* OrderBookSnapshot::add_bids() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::marketdata::PriceLevel* _add = _internal_mutable_bids()->Add();
-  // @@protoc_insertion_point(field_add:marketdata.OrderBookSnapshot.bids)
-  return _add;
+inline uint64_t InstrumentStats::_internal_updates_published() const {
+  return _impl_.updates_published_;
 }
-inline const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>& OrderBookSnapshot::bids() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:marketdata.OrderBookSnapshot.bids)
-  return _internal_bids();
+inline uint64_t InstrumentStats::updates_published() const {
+  // @@protoc_insertion_point(field_get:marketdata.InstrumentStats.updates_published)
+  return _internal_updates_published();
 }
-inline const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>&
-OrderBookSnapshot::_internal_bids() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.bids_;
+inline void InstrumentStats::_internal_set_updates_published(uint64_t value) {
+  
+  _impl_.updates_published_ = value;
 }
-inline ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>*
-OrderBookSnapshot::_internal_mutable_bids() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.bids_;
+inline void InstrumentStats::set_updates_published(uint64_t value) {
+  _internal_set_updates_published(value);
+  // @@protoc_insertion_point(field_set:marketdata.InstrumentStats.updates_published)
 }
 
-// repeated .marketdata.PriceLevel asks = 3;
-inline int OrderBookSnapshot::_internal_asks_size() const {
-  return _internal_asks().size();
+// uint64 bytes_published = 4;
+inline void InstrumentStats::clear_bytes_published() {
+  _impl_.bytes_published_ = uint64_t{0u};
 }
-inline int OrderBookSnapshot::asks_size() const {
-  return _internal_asks_size();
+inline uint64_t InstrumentStats::_internal_bytes_published() const {
+  return _impl_.bytes_published_;
 }
-inline void OrderBookSnapshot::clear_asks() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.asks_.Clear();
+inline uint64_t InstrumentStats::bytes_published() const {
+  // @@protoc_insertion_point(field_get:marketdata.InstrumentStats.bytes_published)
+  return _internal_bytes_published();
 }
-inline ::marketdata::PriceLevel* OrderBookSnapshot::mutable_asks(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:marketdata.OrderBookSnapshot.asks)
-  return _internal_mutable_asks()->Mutable(index);
+inline void InstrumentStats::_internal_set_bytes_published(uint64_t value) {
+  
+  _impl_.bytes_published_ = value;
 }
-inline ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>* OrderBookSnapshot::mutable_asks()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:marketdata.OrderBookSnapshot.asks)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_asks();
+inline void InstrumentStats::set_bytes_published(uint64_t value) {
+  _internal_set_bytes_published(value);
+  // @@protoc_insertion_point(field_set:marketdata.InstrumentStats.bytes_published)
 }
-inline const ::marketdata::PriceLevel& OrderBookSnapshot::asks(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:marketdata.OrderBookSnapshot.asks)
-  return _internal_asks().Get(index);
+
+// uint64 deliveries = 5;
+inline void InstrumentStats::clear_deliveries() {
+  _impl_.deliveries_ = uint64_t{0u};
 }
-inline ::marketdata::PriceLevel* OrderBookSnapshot::add_asks() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::marketdata::PriceLevel* _add = _internal_mutable_asks()->Add();
-  // @@protoc_insertion_point(field_add:marketdata.OrderBookSnapshot.asks)
-  return _add;
+inline uint64_t InstrumentStats::_internal_deliveries() const {
+  return _impl_.deliveries_;
 }
-inline const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>& OrderBookSnapshot::asks() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:marketdata.OrderBookSnapshot.asks)
-  return _internal_asks();
+inline uint64_t InstrumentStats::deliveries() const {
+  // @@protoc_insertion_point(field_get:marketdata.InstrumentStats.deliveries)
+  return _internal_deliveries();
 }
-inline const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>&
-OrderBookSnapshot::_internal_asks() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.asks_;
+inline void InstrumentStats::_internal_set_deliveries(uint64_t value) {
+  
+  _impl_.deliveries_ = value;
 }
-inline ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>*
-OrderBookSnapshot::_internal_mutable_asks() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.asks_;
+inline void InstrumentStats::set_deliveries(uint64_t value) {
+  _internal_set_deliveries(value);
+  // @@protoc_insertion_point(field_set:marketdata.InstrumentStats.deliveries)
 }
 
-// -------------------------------------------------------------------
-
-// OrderBookIncrementalUpdate
+// uint64 snapshots_sent = 6;
+inline void InstrumentStats::clear_snapshots_sent() {
+  _impl_.snapshots_sent_ = uint64_t{0u};
+}
+inline uint64_t InstrumentStats::_internal_snapshots_sent() const {
+  return _impl_.snapshots_sent_;
+}
+inline uint64_t InstrumentStats::snapshots_sent() const {
+  // @@protoc_insertion_point(field_get:marketdata.InstrumentStats.snapshots_sent)
+  return _internal_snapshots_sent();
+}
+inline void InstrumentStats::_internal_set_snapshots_sent(uint64_t value) {
+  
+  _impl_.snapshots_sent_ = value;
+}
+inline void InstrumentStats::set_snapshots_sent(uint64_t value) {
+  _internal_set_snapshots_sent(value);
+  // @@protoc_insertion_point(field_set:marketdata.InstrumentStats.snapshots_sent)
+}
 
-// string instrument_id = 1;
-inline void OrderBookIncrementalUpdate::clear_instrument_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.instrument_id_.ClearToEmpty();
+// uint64 snapshots_built = 7;
+inline void InstrumentStats::clear_snapshots_built() {
+  _impl_.snapshots_built_ = uint64_t{0u};
 }
-inline const std::string& OrderBookIncrementalUpdate::instrument_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:marketdata.OrderBookIncrementalUpdate.instrument_id)
-  return _internal_instrument_id();
+inline uint64_t InstrumentStats::_internal_snapshots_built() const {
+  return _impl_.snapshots_built_;
 }
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void OrderBookIncrementalUpdate::set_instrument_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.instrument_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:marketdata.OrderBookIncrementalUpdate.instrument_id)
+inline uint64_t InstrumentStats::snapshots_built() const {
+  // @@protoc_insertion_point(field_get:marketdata.InstrumentStats.snapshots_built)
+  return _internal_snapshots_built();
 }
-inline std::string* OrderBookIncrementalUpdate::mutable_instrument_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_instrument_id();
-  // @@protoc_insertion_point(field_mutable:marketdata.OrderBookIncrementalUpdate.instrument_id)
-  return _s;
+inline void InstrumentStats::_internal_set_snapshots_built(uint64_t value) {
+  
+  _impl_.snapshots_built_ = value;
 }
-inline const std::string& OrderBookIncrementalUpdate::_internal_instrument_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.instrument_id_.Get();
+inline void InstrumentStats::set_snapshots_built(uint64_t value) {
+  _internal_set_snapshots_built(value);
+  // @@protoc_insertion_point(field_set:marketdata.InstrumentStats.snapshots_built)
 }
-inline void OrderBookIncrementalUpdate::_internal_set_instrument_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.instrument_id_.Set(value, GetArena());
+
+// -------------------------------------------------------------------
+
+// ServerStats
+
+// uint64 streams_opened = 1;
+inline void ServerStats::clear_streams_opened() {
+  _impl_.streams_opened_ = uint64_t{0u};
 }
-inline std::string* OrderBookIncrementalUpdate::_internal_mutable_instrument_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.instrument_id_.Mutable( GetArena());
+inline uint64_t ServerStats::_internal_streams_opened() const {
+  return _impl_.streams_opened_;
 }
-inline std::string* OrderBookIncrementalUpdate::release_instrument_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:marketdata.OrderBookIncrementalUpdate.instrument_id)
-  return _impl_.instrument_id_.Release();
+inline uint64_t ServerStats::streams_opened() const {
+  // @@protoc_insertion_point(field_get:marketdata.ServerStats.streams_opened)
+  return _internal_streams_opened();
 }
-inline void OrderBookIncrementalUpdate::set_allocated_instrument_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.instrument_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.instrument_id_.IsDefault()) {
-    _impl_.instrument_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:marketdata.OrderBookIncrementalUpdate.instrument_id)
+inline void ServerStats::_internal_set_streams_opened(uint64_t value) {
+  
+  _impl_.streams_opened_ = value;
+}
+inline void ServerStats::set_streams_opened(uint64_t value) {
+  _internal_set_streams_opened(value);
+  // @@protoc_insertion_point(field_set:marketdata.ServerStats.streams_opened)
 }
 
-// repeated .marketdata.PriceLevel bid_updates = 2;
-inline int OrderBookIncrementalUpdate::_internal_bid_updates_size() const {
-  return _internal_bid_updates().size();
+// repeated .marketdata.StreamStats streams = 2;
+inline int ServerStats::_internal_streams_size() const {
+  return _impl_.streams_.size();
 }
-inline int OrderBookIncrementalUpdate::bid_updates_size() const {
-  return _internal_bid_updates_size();
+inline int ServerStats::streams_size() const {
+  return _internal_streams_size();
 }
-inline void OrderBookIncrementalUpdate::clear_bid_updates() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.bid_updates_.Clear();
+inline void ServerStats::clear_streams() {
+  _impl_.streams_.Clear();
 }
-inline ::marketdata::PriceLevel* OrderBookIncrementalUpdate::mutable_bid_updates(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:marketdata.OrderBookIncrementalUpdate.bid_updates)
-  return _internal_mutable_bid_updates()->Mutable(index);
+inline ::marketdata::StreamStats* ServerStats::mutable_streams(int index) {
+  // @@protoc_insertion_point(field_mutable:marketdata.ServerStats.streams)
+  return _impl_.streams_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>* OrderBookIncrementalUpdate::mutable_bid_updates()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:marketdata.OrderBookIncrementalUpdate.bid_updates)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_bid_updates();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::StreamStats >*
+ServerStats::mutable_streams() {
+  // @@protoc_insertion_point(field_mutable_list:marketdata.ServerStats.streams)
+  return &_impl_.streams_;
 }
-inline const ::marketdata::PriceLevel& OrderBookIncrementalUpdate::bid_updates(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:marketdata.OrderBookIncrementalUpdate.bid_updates)
-  return _internal_bid_updates().Get(index);
+inline const ::marketdata::StreamStats& ServerStats::_internal_streams(int index) const {
+  return _impl_.streams_.Get(index);
 }
-inline ::marketdata::PriceLevel* OrderBookIncrementalUpdate::add_bid_updates() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::marketdata::PriceLevel* _add = _internal_mutable_bid_updates()->Add();
-  // @@protoc_insertion_point(field_add:marketdata.OrderBookIncrementalUpdate.bid_updates)
-  return _add;
+inline const ::marketdata::StreamStats& ServerStats::streams(int index) const {
+  // @@protoc_insertion_point(field_get:marketdata.ServerStats.streams)
+  return _internal_streams(index);
 }
-inline const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>& OrderBookIncrementalUpdate::bid_updates() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:marketdata.OrderBookIncrementalUpdate.bid_updates)
-  return _internal_bid_updates();
+inline ::marketdata::StreamStats* ServerStats::_internal_add_streams() {
+  return _impl_.streams_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>&
-OrderBookIncrementalUpdate::_internal_bid_updates() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.bid_updates_;
+inline ::marketdata::StreamStats* ServerStats::add_streams() {
+  ::marketdata::StreamStats* _add = _internal_add_streams();
+  // @@protoc_insertion_point(field_add:marketdata.ServerStats.streams)
+  return _add;
 }
-inline ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>*
-OrderBookIncrementalUpdate::_internal_mutable_bid_updates() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.bid_updates_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::StreamStats >&
+ServerStats::streams() const {
+  // @@protoc_insertion_point(field_list:marketdata.ServerStats.streams)
+  return _impl_.streams_;
 }
 
-// repeated .marketdata.PriceLevel ask_updates = 3;
-inline int OrderBookIncrementalUpdate::_internal_ask_updates_size() const {
-  return _internal_ask_updates().size();
+// .marketdata.StreamStats closed_streams = 3;
+inline bool ServerStats::_internal_has_closed_streams() const {
+  return this != internal_default_instance() && _impl_.closed_streams_ != nullptr;
 }
-inline int OrderBookIncrementalUpdate::ask_updates_size() const {
-  return _internal_ask_updates_size();
+inline bool ServerStats::has_closed_streams() const {
+  return _internal_has_closed_streams();
 }
-inline void OrderBookIncrementalUpdate::clear_ask_updates() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.ask_updates_.Clear();
+inline void ServerStats::clear_closed_streams() {
+  if (GetArenaForAllocation() == nullptr && _impl_.closed_streams_ != nullptr) {
+    delete _impl_.closed_streams_;
+  }
+  _impl_.closed_streams_ = nullptr;
 }
-inline ::marketdata::PriceLevel* OrderBookIncrementalUpdate::mutable_ask_updates(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:marketdata.OrderBookIncrementalUpdate.ask_updates)
-  return _internal_mutable_ask_updates()->Mutable(index);
+inline const ::marketdata::StreamStats& ServerStats::_internal_closed_streams() const {
+  const ::marketdata::StreamStats* p = _impl_.closed_streams_;
+  return p != nullptr ? *p : reinterpret_cast<const ::marketdata::StreamStats&>(
+      ::marketdata::_StreamStats_default_instance_);
 }
-inline ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>* OrderBookIncrementalUpdate::mutable_ask_updates()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:marketdata.OrderBookIncrementalUpdate.ask_updates)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_ask_updates();
+inline const ::marketdata::StreamStats& ServerStats::closed_streams() const {
+  // @@protoc_insertion_point(field_get:marketdata.ServerStats.closed_streams)
+  return _internal_closed_streams();
 }
-inline const ::marketdata::PriceLevel& OrderBookIncrementalUpdate::ask_updates(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:marketdata.OrderBookIncrementalUpdate.ask_updates)
-  return _internal_ask_updates().Get(index);
+inline void ServerStats::unsafe_arena_set_allocated_closed_streams(
+    ::marketdata::StreamStats* closed_streams) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.closed_streams_);
+  }
+  _impl_.closed_streams_ = closed_streams;
+  if (closed_streams) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:marketdata.ServerStats.closed_streams)
 }
-inline ::marketdata::PriceLevel* OrderBookIncrementalUpdate::add_ask_updates() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::marketdata::PriceLevel* _add = _internal_mutable_ask_updates()->Add();
-  // @@protoc_insertion_point(field_add:marketdata.OrderBookIncrementalUpdate.ask_updates)
-  return _add;
+inline ::marketdata::StreamStats* ServerStats::release_closed_streams() {
+  
+  ::marketdata::StreamStats* temp = _impl_.closed_streams_;
+  _impl_.closed_streams_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>& OrderBookIncrementalUpdate::ask_updates() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:marketdata.OrderBookIncrementalUpdate.ask_updates)
-  return _internal_ask_updates();
+inline ::marketdata::StreamStats* ServerStats::unsafe_arena_release_closed_streams() {
+  // @@protoc_insertion_point(field_release:marketdata.ServerStats.closed_streams)
+  
+  ::marketdata::StreamStats* temp = _impl_.closed_streams_;
+  _impl_.closed_streams_ = nullptr;
+  return temp;
 }
-inline const ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>&
-OrderBookIncrementalUpdate::_internal_ask_updates() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.ask_updates_;
+inline ::marketdata::StreamStats* ServerStats::_internal_mutable_closed_streams() {
+  
+  if (_impl_.closed_streams_ == nullptr) {
+    auto* p = CreateMaybeMessage<::marketdata::StreamStats>(GetArenaForAllocation());
+    _impl_.closed_streams_ = p;
+  }
+  return _impl_.closed_streams_;
 }
-inline ::google::protobuf::RepeatedPtrField<::marketdata::PriceLevel>*
-OrderBookIncrementalUpdate::_internal_mutable_ask_updates() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.ask_updates_;
+inline ::marketdata::StreamStats* ServerStats::mutable_closed_streams() {
+  ::marketdata::StreamStats* _msg = _internal_mutable_closed_streams();
+  // @@protoc_insertion_point(field_mutable:marketdata.ServerStats.closed_streams)
+  return _msg;
+}
+inline void ServerStats::set_allocated_closed_streams(::marketdata::StreamStats* closed_streams) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.closed_streams_;
+  }
+  if (closed_streams) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(closed_streams);
+    if (message_arena != submessage_arena) {
+      closed_streams = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, closed_streams, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.closed_streams_ = closed_streams;
+  // @@protoc_insertion_point(field_set_allocated:marketdata.ServerStats.closed_streams)
 }
 
-// -------------------------------------------------------------------
-
-// PriceLevel
-
-// double price = 1;
-inline void PriceLevel::clear_price() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.price_ = 0;
+// repeated .marketdata.InstrumentStats instruments = 4;
+inline int ServerStats::_internal_instruments_size() const {
+  return _impl_.instruments_.size();
 }
-inline double PriceLevel::price() const {
-  // @@protoc_insertion_point(field_get:marketdata.PriceLevel.price)
-  return _internal_price();
+inline int ServerStats::instruments_size() const {
+  return _internal_instruments_size();
 }
-inline void PriceLevel::set_price(double value) {
-  _internal_set_price(value);
-  // @@protoc_insertion_point(field_set:marketdata.PriceLevel.price)
+inline void ServerStats::clear_instruments() {
+  _impl_.instruments_.Clear();
 }
-inline double PriceLevel::_internal_price() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.price_;
+inline ::marketdata::InstrumentStats* ServerStats::mutable_instruments(int index) {
+  // @@protoc_insertion_point(field_mutable:marketdata.ServerStats.instruments)
+  return _impl_.instruments_.Mutable(index);
 }
-inline void PriceLevel::_internal_set_price(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.price_ = value;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::InstrumentStats >*
+ServerStats::mutable_instruments() {
+  // @@protoc_insertion_point(field_mutable_list:marketdata.ServerStats.instruments)
+  return &_impl_.instruments_;
 }
-
-// double quantity = 2;
-inline void PriceLevel::clear_quantity() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.quantity_ = 0;
+inline const ::marketdata::InstrumentStats& ServerStats::_internal_instruments(int index) const {
+  return _impl_.instruments_.Get(index);
 }
-inline double PriceLevel::quantity() const {
-  // @@protoc_insertion_point(field_get:marketdata.PriceLevel.quantity)
-  return _internal_quantity();
+inline const ::marketdata::InstrumentStats& ServerStats::instruments(int index) const {
+  // @@protoc_insertion_point(field_get:marketdata.ServerStats.instruments)
+  return _internal_instruments(index);
 }
-inline void PriceLevel::set_quantity(double value) {
-  _internal_set_quantity(value);
-  // @@protoc_insertion_point(field_set:marketdata.PriceLevel.quantity)
+inline ::marketdata::InstrumentStats* ServerStats::_internal_add_instruments() {
+  return _impl_.instruments_.Add();
 }
-inline double PriceLevel::_internal_quantity() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.quantity_;
+inline ::marketdata::InstrumentStats* ServerStats::add_instruments() {
+  ::marketdata::InstrumentStats* _add = _internal_add_instruments();
+  // @@protoc_insertion_point(field_add:marketdata.ServerStats.instruments)
+  return _add;
 }
-inline void PriceLevel::_internal_set_quantity(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.quantity_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::marketdata::InstrumentStats >&
+ServerStats::instruments() const {
+  // @@protoc_insertion_point(field_list:marketdata.ServerStats.instruments)
+  return _impl_.instruments_;
 }
 
 #ifdef __GNUC__
-#pragma GCC diagnostic pop
+  #pragma GCC diagnostic pop
 #endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
-}  // namespace marketdata
 
+}  // namespace marketdata
 
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::marketdata::SubscriptionRequest_Action> : ::std::true_type {};
 template <>
-struct is_proto_enum<::marketdata::SubscriptionRequest_Action> : std::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor<::marketdata::SubscriptionRequest_Action>() {
+inline const EnumDescriptor* GetEnumDescriptor< ::marketdata::SubscriptionRequest_Action>() {
   return ::marketdata::SubscriptionRequest_Action_descriptor();
 }
 
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#include "google/protobuf/port_undef.inc"
-
-#endif  // market_5fdata_2eproto_2epb_2eh
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_market_5fdata_2eproto
@@ -0,0 +1,476 @@
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <google/protobuf/arena.h>
+
+#include "market_data.pb.h"
+
+#include "alloc_counter.h"
+#include "compact_levels.h"
+#include "encoded_update.h"
+#include "market_simulator.h"
+#include "order_book.h"
+#include "outbound_queue.h"
+#include "publisher_engine.h"
+
+using google::protobuf::Arena;
+using google::protobuf::ArenaOptions;
+
+using marketdata::MarketDataUpdate;
+using marketdata::OrderBookIncrementalUpdate;
+using marketdata::OrderBookSnapshot;
+
+namespace {
+
+// Updates in each synthetic feed; benchmarks cycle through them
+constexpr size_t kFeedLength = 4096;
+
+// Tick of the mid price the synthetic books are built around
+constexpr int64_t kMidTicks = 10000;
+
+// Chance that an event lands on the next level down rather than the current one,
+// so activity concentrates near the top of the book
+constexpr double kLevelFalloff = 0.7;
+
+// Block the parse benchmark decodes into, as the client does
+constexpr size_t kParseArenaSize = 64 * 1024;
+
+// Levels per side of the bounded book benchmark, as in the feed handler's books
+constexpr size_t kBoundedDepth = 10;
+
+// Describes a synthetic feed: depth levels per side, and the percentage of events
+// that delete a level and add one at another price rather than modify a quantity.
+struct FeedOptions {
+    size_t depth = 10;
+    int churn_percent = 10;
+    PriceEncoding encoding = PriceEncoding::kDouble;
+    uint64_t seed = 1;
+};
+
+// A snapshot and the incremental updates that follow it. Each update carries one
+// event: a quantity change, or with churn a level deleted and another added on the
+// same side. Bids stay below the mid and asks above it, so the book never crosses.
+struct SyntheticFeed {
+    OrderBookSnapshot snapshot;
+    std::vector<MarketDataUpdate> updates;
+    std::vector<std::string> encoded;
+};
+
+SyntheticFeed MakeFeed(const FeedOptions& options) {
+    SyntheticFeed feed;
+    std::mt19937_64 rng(options.seed);
+    std::uniform_real_distribution<double> quantity(1.0, 1000.0);
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::geometric_distribution<size_t> level(1.0 - kLevelFalloff);
+
+    // Each side holds depth of the 2 * depth prices in its half of the book, best first
+    std::vector<int64_t> sides[2];
+    int64_t range = static_cast<int64_t>(2 * options.depth);
+    for (size_t i = 0; i < options.depth; ++i) {
+        sides[0].push_back(kMidTicks - 1 - static_cast<int64_t>(i));
+        sides[1].push_back(kMidTicks + 1 + static_cast<int64_t>(i));
+    }
+    if (options.encoding != PriceEncoding::kDouble) {
+        feed.snapshot.set_tick_size(kSimulatedTickSize);
+        feed.snapshot.set_lot_size(kSimulatedLotSize);
+    }
+    for (int64_t price : sides[0]) {
+        SetPriceLevel(feed.snapshot.add_bids(), price * kSimulatedTickSize, quantity(rng), options.encoding);
+    }
+    for (int64_t price : sides[1]) {
+        SetPriceLevel(feed.snapshot.add_asks(), price * kSimulatedTickSize, quantity(rng), options.encoding);
+    }
+
+    for (size_t n = 0; n < kFeedLength; ++n) {
+        MarketDataUpdate update;
+        OrderBookIncrementalUpdate* incremental_update = update.mutable_incremental_update();
+        incremental_update->set_instrument_handle(1);
+        incremental_update->set_sequence(n + 1);
+        bool bid = percent(rng) < 50;
+        std::vector<int64_t>& side = sides[bid ? 0 : 1];
+        auto add_level = [&](int64_t price, double qty) {
+            marketdata::PriceLevel* level = bid ? incremental_update->add_bid_updates()
+                                                : incremental_update->add_ask_updates();
+            SetPriceLevel(level, price * kSimulatedTickSize, qty, options.encoding);
+        };
+
+        size_t i = std::min(level(rng), side.size() - 1);
+        if (percent(rng) < options.churn_percent) {
+            int64_t removed = side[i];
+            side.erase(side.begin() + i);
+            add_level(removed, 0);
+            // Any free price in this side's half of the book
+            int64_t added;
+            do {
+                int64_t distance = std::uniform_int_distribution<int64_t>(1, range)(rng);
+                added = bid ? kMidTicks - distance : kMidTicks + distance;
+            } while (added == removed || std::find(side.begin(), side.end(), added) != side.end());
+            side.insert(std::find_if(side.begin(), side.end(),
+                                     [&](int64_t price) { return bid ? price < added : price > added; }),
+                        added);
+            add_level(added, quantity(rng));
+        } else {
+            add_level(side[i], quantity(rng));
+        }
+        if (options.encoding == PriceEncoding::kCompact) {
+            CompactLevels(incremental_update);
+        }
+        feed.encoded.push_back(update.SerializeAsString());
+        feed.updates.push_back(std::move(update));
+    }
+    return feed;
+}
+
+FeedOptions FeedFromArgs(const benchmark::State& state) {
+    FeedOptions options;
+    options.depth = static_cast<size_t>(state.range(0));
+    options.churn_percent = static_cast<int>(state.range(1));
+    return options;
+}
+
+// Reports heap allocations per iteration, counted from the given starting count.
+void ReportAllocations(benchmark::State& state, uint64_t allocations_before) {
+    state.counters["allocs/op"] =
+        benchmark::Counter(static_cast<double>(ThreadAllocationCount() - allocations_before),
+                           benchmark::Counter::kAvgIterations);
+}
+
+// The client's original book: one std::map per side keyed by the double price.
+class MapOrderBook {
+public:
+    void ApplySnapshot(const OrderBookSnapshot& snapshot) {
+        bids_.clear();
+        asks_.clear();
+        for (const auto& bid : snapshot.bids()) {
+            bids_[bid.price()] = bid.quantity();
+        }
+        for (const auto& ask : snapshot.asks()) {
+            asks_[ask.price()] = ask.quantity();
+        }
+    }
+
+    void ApplyIncremental(const OrderBookIncrementalUpdate& update) {
+        for (const auto& bid_update : update.bid_updates()) {
+            Apply(bids_, bid_update);
+        }
+        for (const auto& ask_update : update.ask_updates()) {
+            Apply(asks_, ask_update);
+        }
+    }
+
+    double best_bid() const { return bids_.empty() ? 0 : bids_.rbegin()->first; }
+
+private:
+    static void Apply(std::map<double, double>& side, const marketdata::PriceLevel& level) {
+        if (level.quantity() > 0) {
+            side[level.price()] = level.quantity();
+        } else {
+            side.erase(level.price());
+        }
+    }
+
+    std::map<double, double> bids_;
+    std::map<double, double> asks_;
+};
+
+// Applies the feed's updates to a book, going back to the snapshot each time the feed
+// wraps so the book follows the stream it was generated from.
+template <typename Book>
+void ApplyFeed(benchmark::State& state, const SyntheticFeed& feed, Book& book) {
+    book.ApplySnapshot(feed.snapshot);
+    // Warm the book up to its steady-state capacity before counting allocations
+    for (const auto& update : feed.updates) {
+        book.ApplyIncremental(update.incremental_update());
+    }
+    book.ApplySnapshot(feed.snapshot);
+
+    size_t next = 0;
+    uint64_t allocations_before = ThreadAllocationCount();
+    for (auto _ : state) {
+        book.ApplyIncremental(feed.updates[next].incremental_update());
+        if (++next == feed.updates.size()) {
+            next = 0;
+            book.ApplySnapshot(feed.snapshot);
+        }
+    }
+    benchmark::DoNotOptimize(book);
+    ReportAllocations(state, allocations_before);
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ApplyFlatBook(benchmark::State& state) {
+    SyntheticFeed feed = MakeFeed(FeedFromArgs(state));
+    OrderBook book;
+    ApplyFeed(state, feed, book);
+}
+
+void BM_ApplyFixedPointFlatBook(benchmark::State& state) {
+    FeedOptions options = FeedFromArgs(state);
+    options.encoding = PriceEncoding::kFixedPoint;
+    SyntheticFeed feed = MakeFeed(options);
+    OrderBook book;
+    ApplyFeed(state, feed, book);
+}
+
+void BM_ApplyCompactFlatBook(benchmark::State& state) {
+    FeedOptions options = FeedFromArgs(state);
+    options.encoding = PriceEncoding::kCompact;
+    SyntheticFeed feed = MakeFeed(options);
+    OrderBook book;
+    ApplyFeed(state, feed, book);
+}
+
+// A book bounded at the feed's depth, as for a depth-limited subscription
+void BM_ApplyBoundedFlatBook(benchmark::State& state) {
+    FeedOptions options = FeedFromArgs(state);
+    options.encoding = PriceEncoding::kCompact;
+    SyntheticFeed feed = MakeFeed(options);
+    BasicOrderBook<kBoundedDepth> book;
+    ApplyFeed(state, feed, book);
+}
+
+void BM_ApplyMapBook(benchmark::State& state) {
+    SyntheticFeed feed = MakeFeed(FeedFromArgs(state));
+    MapOrderBook book;
+    ApplyFeed(state, feed, book);
+}
+
+// The publisher's per-event work: rebuild a recycled update from the simulator and
+// serialize it (see PublisherEngine::WorkerLoop).
+void BM_BuildAndSerialize(benchmark::State& state) {
+    SimulatorOptions options;
+    options.depth = static_cast<size_t>(state.range(0));
+    PriceEncoding encoding = state.range(1) != 0 ? PriceEncoding::kFixedPoint : PriceEncoding::kDouble;
+    std::unique_ptr<MarketSimulator> simulator = CreateSimulator(options, "SYM0");
+    EncodedUpdate update;
+    uint64_t sequence = 0;
+
+    auto build = [&]() {
+        OrderBookIncrementalUpdate* incremental_update = update.mutable_message()->mutable_incremental_update();
+        incremental_update->Clear();
+        incremental_update->set_instrument_handle(1);
+        incremental_update->set_sequence(++sequence);
+        simulator->Step(encoding, incremental_update);
+        update.Encode();
+    };
+    for (size_t i = 0; i < kFeedLength; ++i) {
+        build();
+    }
+
+    uint64_t allocations_before = ThreadAllocationCount();
+    for (auto _ : state) {
+        build();
+    }
+    benchmark::DoNotOptimize(update.bytes());
+    ReportAllocations(state, allocations_before);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// The client's decode: each message parsed onto an arena reset before the next one.
+void ParseUpdate(benchmark::State& state, PriceEncoding encoding) {
+    FeedOptions options = FeedFromArgs(state);
+    options.encoding = encoding;
+    SyntheticFeed feed = MakeFeed(options);
+    std::unique_ptr<char[]> block(new char[kParseArenaSize]);
+    ArenaOptions arena_options;
+    arena_options.initial_block = block.get();
+    arena_options.initial_block_size = kParseArenaSize;
+    Arena arena(arena_options);
+
+    size_t next = 0;
+    int64_t bytes = 0;
+    uint64_t allocations_before = ThreadAllocationCount();
+    for (auto _ : state) {
+        arena.Reset();
+        MarketDataUpdate* update = Arena::CreateMessage<MarketDataUpdate>(&arena);
+        const std::string& encoded = feed.encoded[next];
+        if (!update->ParseFromString(encoded)) {
+            state.SkipWithError("parse failed");
+            break;
+        }
+        benchmark::DoNotOptimize(update);
+        bytes += static_cast<int64_t>(encoded.size());
+        next = (next + 1) % feed.encoded.size();
+    }
+    ReportAllocations(state, allocations_before);
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(bytes);
+    state.counters["bytes/op"] = benchmark::Counter(static_cast<double>(bytes), benchmark::Counter::kAvgIterations);
+}
+
+void BM_ParseUpdate(benchmark::State& state) {
+    ParseUpdate(state, PriceEncoding::kDouble);
+}
+
+void BM_ParseCompactUpdate(benchmark::State& state) {
+    ParseUpdate(state, PriceEncoding::kCompact);
+}
+
+// An outbound stream without a transport: the benchmark plays the writer and drains
+// the queue itself.
+class QueueStream final : public OutboundStream {
+public:
+    bool Enqueue(OutboundItem item) override {
+        queue_.Push(std::move(item));
+        return true;
+    }
+
+    const OutboundQueue& queue() const override { return queue_; }
+
+    size_t Drain() {
+        size_t drained = 0;
+        OutboundQueue::Clock::time_point wake_at;
+        while (queue_.Next(OutboundQueue::Clock::now(), &wake_at)) {
+            ++drained;
+        }
+        return drained;
+    }
+
+private:
+    OutboundQueue queue_;
+};
+
+// One update published to every subscriber of an instrument and taken off each
+// stream's queue by its writer. Reported per update; the per-subscriber cost is the
+// subscriber_time counter.
+void FanOut(benchmark::State& state, bool conflate) {
+    size_t num_subscribers = static_cast<size_t>(state.range(0));
+    SyntheticFeed feed = MakeFeed(FeedOptions());
+    std::vector<std::shared_ptr<const EncodedUpdate>> updates;
+    for (const auto& update : feed.updates) {
+        updates.push_back(std::make_shared<const EncodedUpdate>(update));
+    }
+
+    std::vector<std::shared_ptr<QueueStream>> streams;
+    std::vector<std::shared_ptr<Subscriber>> subscribers;
+    for (size_t i = 0; i < num_subscribers; ++i) {
+        streams.push_back(std::make_shared<QueueStream>());
+        if (conflate) {
+            subscribers.push_back(std::make_shared<ConflatedSubscription>(streams.back(), 0));
+        } else {
+            subscribers.push_back(streams.back());
+        }
+    }
+
+    // One round first, so the stream queues have their nodes
+    for (const auto& subscriber : subscribers) {
+        subscriber->Publish(updates[0]);
+    }
+    for (const auto& stream : streams) {
+        stream->Drain();
+    }
+
+    size_t next = 0;
+    size_t delivered = 0;
+    uint64_t allocations_before = ThreadAllocationCount();
+    for (auto _ : state) {
+        for (const auto& subscriber : subscribers) {
+            subscriber->Publish(updates[next]);
+        }
+        for (const auto& stream : streams) {
+            delivered += stream->Drain();
+        }
+        next = (next + 1) % updates.size();
+    }
+    if (delivered != static_cast<size_t>(state.iterations()) * num_subscribers) {
+        state.SkipWithError("updates were lost in fan-out");
+    }
+    ReportAllocations(state, allocations_before);
+    state.counters["subscriber_time"] = benchmark::Counter(
+        static_cast<double>(num_subscribers), benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_FanOut(benchmark::State& state) {
+    FanOut(state, false);
+}
+
+void BM_FanOutConflated(benchmark::State& state) {
+    FanOut(state, true);
+}
+
+// The server's whole per-update path short of the transport: an update recycled from
+// the worker's pool is rebuilt from the simulator and encoded, queued on every
+// subscriber's stream and taken off by its writer, which hands it back to the pool.
+// Fails if the steady state allocates anything but the gRPC slice an update is
+// encoded into, which is counted separately as encode_allocs/op.
+void BM_PublishFanOut(benchmark::State& state) {
+    size_t num_subscribers = static_cast<size_t>(state.range(0));
+    std::unique_ptr<MarketSimulator> simulator = CreateSimulator(SimulatorOptions(), "SYM0");
+    UpdatePool pool;
+    std::vector<std::shared_ptr<QueueStream>> streams;
+    for (size_t i = 0; i < num_subscribers; ++i) {
+        streams.push_back(std::make_shared<QueueStream>());
+    }
+
+    uint64_t sequence = 0;
+    size_t delivered = 0;
+    uint64_t encode_allocations = 0;
+    auto publish = [&]() {
+        std::shared_ptr<EncodedUpdate> update = pool.Acquire();
+        OrderBookIncrementalUpdate* incremental_update = update->mutable_message()->mutable_incremental_update();
+        incremental_update->Clear();
+        incremental_update->set_instrument_handle(1);
+        incremental_update->set_sequence(++sequence);
+        simulator->Step(PriceEncoding::kDouble, incremental_update);
+        uint64_t before_encode = ThreadAllocationCount();
+        update->Encode();
+        encode_allocations += ThreadAllocationCount() - before_encode;
+        for (const auto& stream : streams) {
+            stream->Publish(update);
+        }
+        for (const auto& stream : streams) {
+            delivered += stream->Drain();
+        }
+    };
+    for (size_t i = 0; i < kFeedLength; ++i) {
+        publish();
+    }
+
+    delivered = 0;
+    encode_allocations = 0;
+    uint64_t allocations_before = ThreadAllocationCount();
+    for (auto _ : state) {
+        publish();
+    }
+    uint64_t allocations = ThreadAllocationCount() - allocations_before;
+    if (delivered != static_cast<size_t>(state.iterations()) * num_subscribers) {
+        state.SkipWithError("updates were lost in fan-out");
+    } else if (allocations != encode_allocations) {
+        state.SkipWithError("publishing allocated in steady state");
+    }
+    ReportAllocations(state, allocations_before);
+    state.counters["encode_allocs/op"] =
+        benchmark::Counter(static_cast<double>(encode_allocations), benchmark::Counter::kAvgIterations);
+    state.counters["subscriber_time"] = benchmark::Counter(
+        static_cast<double>(num_subscribers), benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Depth per side by churn percentage
+void FeedArgs(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgNames({"depth", "churn"})->ArgsProduct({{10, 50, 200}, {0, 10, 50}});
+}
+
+} // namespace
+
+BENCHMARK(BM_ApplyFlatBook)->Apply(FeedArgs);
+BENCHMARK(BM_ApplyFixedPointFlatBook)->Apply(FeedArgs);
+BENCHMARK(BM_ApplyCompactFlatBook)->Apply(FeedArgs);
+BENCHMARK(BM_ApplyBoundedFlatBook)->ArgNames({"depth", "churn"})->ArgsProduct({{kBoundedDepth}, {0, 10, 50}});
+BENCHMARK(BM_ApplyMapBook)->Apply(FeedArgs);
+BENCHMARK(BM_BuildAndSerialize)->ArgNames({"depth", "fixed"})->ArgsProduct({{10, 50, 200}, {0, 1}});
+BENCHMARK(BM_ParseUpdate)->Apply(FeedArgs);
+BENCHMARK(BM_ParseCompactUpdate)->Apply(FeedArgs);
+BENCHMARK(BM_FanOut)->ArgName("subscribers")->RangeMultiplier(4)->Range(1, 1024);
+BENCHMARK(BM_FanOutConflated)->ArgName("subscribers")->RangeMultiplier(4)->Range(1, 1024);
+BENCHMARK(BM_PublishFanOut)->ArgName("subscribers")->RangeMultiplier(4)->Range(1, 1024);
+
+BENCHMARK_MAIN();
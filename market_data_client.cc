@@ -1,189 +1,948 @@
+#include <algorithm>
+#include <deque>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <thread>
 #include <chrono>
 #include <future>
-#include <map>
+#include <unordered_map>
 #include <iomanip>
+#include <sstream>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/grpcpp.h>
 
 // Include the generated files
 #include "market_data.grpc.pb.h"
 #include "market_data.pb.h"
 
+#include "alloc_counter.h"
+#include "capture.h"
+#include "capture_recorder.h"
+#include "feed_handler.h"
+#include "feed_transport.h"
+#include "flags.h"
+#include "hdr_histogram.h"
+#include "log.h"
+#include "order_book.h"
+#include "transport_profile.h"
+
 using grpc::Channel;
 using grpc::ClientContext;
 using grpc::ClientReaderWriter;
 using grpc::Status;
 
+using google::protobuf::Arena;
+using google::protobuf::ArenaOptions;
+
+using marketdata::InstrumentStats;
 using marketdata::MarketDataService;
 using marketdata::SubscriptionRequest;
 using marketdata::MarketDataUpdate;
 using marketdata::OrderBookSnapshot;
 using marketdata::OrderBookIncrementalUpdate;
 using marketdata::PriceLevel;
+using marketdata::ServerStats;
+using marketdata::StatsRequest;
+using marketdata::StreamStats;
+using marketdata::SymbolDirectory;
+
+namespace {
+
+// Memory each received message is decoded into. Messages that fit are decoded without
+// touching the heap; larger ones spill into heap blocks freed again on the next read.
+constexpr size_t kReadArenaSize = 64 * 1024;
+
+// Messages read before allocations are counted, covering the symbol directory,
+// snapshots and first-time growth of the books.
+constexpr uint64_t kAllocationWarmupMessages = 16;
+
+// Latencies are tracked up to this many nanoseconds, to two significant digits
+constexpr int64_t kMaxTrackedLatencyNs = 60'000'000'000;
+constexpr int kLatencyDigits = 2;
+
+// How long --stats waits for the server
+constexpr std::chrono::seconds kStatsTimeout(5);
+
+// How long the client stays subscribed, and events taken per poll in sharded mode
+constexpr std::chrono::seconds kRunTime(20);
+constexpr size_t kPollBatch = 256;
+
+// How long a feed read waits before the client checks for control messages, and how
+// many feed updates are kept while their instruments wait for a snapshot
+constexpr std::chrono::microseconds kFeedPollTimeout(1000);
+constexpr size_t kMaxFeedBacklog = 65536;
+
+int64_t SteadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+// Command line configuration of the client
+struct ClientOptions {
+    std::string record_path;
+    uint64_t record_file_mb = 0;
+    LogOptions logging;
+    // Levels per side shown by the periodic book view; 0 turns the view off
+    size_t book_view_depth = 5;
+    std::chrono::milliseconds book_view_interval{1000};
+    // How often latency percentiles are reported; 0 turns latency tracking off
+    std::chrono::milliseconds latency_report_interval{0};
+    // Print the server's counters and exit instead of subscribing
+    bool print_server_stats = false;
+    std::vector<std::string> instruments = {"AAPL", "MSFT"};
+    // Levels per side to subscribe to, 0 for full depth
+    uint32_t subscription_depth = 0;
+    // With more than 0, read through a FeedHandler with this many streams and threads
+    size_t shards = 0;
+    // First CPU the FeedHandler threads are pinned to; negative leaves them unpinned
+    int first_cpu = -1;
+    // gRPC settings of the connection, to match the server's
+    TransportProfile profile = TransportProfile::kDefault;
+    // Read incremental updates from the server's feed instead of a subscription
+    std::string feed_udp;
+    std::string feed_shm;
+};
+
+// Latency histograms of one instrument, or of all of them, over a report interval.
+struct LatencyStats {
+    // From the server generating an update (its publish timestamp) to the client reading it
+    HdrHistogram publish_to_receive{kMaxTrackedLatencyNs, kLatencyDigits};
+    // From reading an update to having applied it to the book
+    HdrHistogram receive_to_applied{kMaxTrackedLatencyNs, kLatencyDigits};
+    uint64_t updates = 0;
+
+    void Add(const LatencyStats& other) {
+        publish_to_receive.Add(other.publish_to_receive);
+        receive_to_applied.Add(other.receive_to_applied);
+        updates += other.updates;
+    }
+
+    void Reset() {
+        publish_to_receive.Reset();
+        receive_to_applied.Reset();
+        updates = 0;
+    }
+};
+
+// Appends "p50/p99/p99.9/max" of a histogram in microseconds, or n/a if it is empty.
+void PrintPercentiles(std::ostream& out, const HdrHistogram& histogram) {
+    if (histogram.count() == 0) {
+        out << "n/a";
+        return;
+    }
+    out << histogram.ValueAtPercentile(50) / 1e3 << " / " << histogram.ValueAtPercentile(99) / 1e3 << " / "
+        << histogram.ValueAtPercentile(99.9) / 1e3 << " / " << histogram.max() / 1e3;
+}
+
+void PrintLatencyLine(std::ostream& out, const std::string& name, const LatencyStats& stats, double seconds) {
+    out << "  " << std::left << std::setw(10) << name << std::right << std::setw(10)
+        << static_cast<uint64_t>(stats.updates / seconds) << " msgs/s  publish->receive ";
+    PrintPercentiles(out, stats.publish_to_receive);
+    out << "  receive->applied ";
+    PrintPercentiles(out, stats.receive_to_applied);
+    out << "\n";
+}
 
-// Helper function to print an order book
-void PrintOrderBook(const std::string& instrument_id,
-                    const std::map<double, double>& bids,
-                    const std::map<double, double>& asks) {
-    std::cout << "--- Order Book for " << instrument_id << " ---" << std::endl;
-    std::cout << std::fixed << std::setprecision(2); // For consistent price formatting
+// Logs the top depth levels of each side of an order book as one block.
+void PrintOrderBook(const std::string& instrument_id, const OrderBook& book, size_t depth, uint64_t updates) {
+    Log log;
+    log << std::fixed << std::setprecision(2); // For consistent price formatting
+    log << "--- Order Book for " << instrument_id << " (" << updates << " updates since last view) ---\n";
 
-    std::cout << "  ASKS:" << std::endl;
+    log << "  ASKS:\n";
     // Iterate asks in descending price order
-    for (auto it = asks.rbegin(); it != asks.rend(); ++it) {
-        std::cout << "    Price: " << it->first << ", Quantity: " << it->second << std::endl;
+    for (size_t i = std::min(depth, book.asks().depth()); i-- > 0;) {
+        const BookLevel& level = book.asks().level(i);
+        log << "    Price: " << book.ToPrice(level.price_ticks) << ", Quantity: " << level.quantity << "\n";
     }
 
-    std::cout << "  BIDS:" << std::endl;
+    log << "  BIDS:\n";
     // Iterate bids in descending price order
-    for (auto it = bids.rbegin(); it != bids.rend(); ++it) {
-        std::cout << "    Price: " << it->first << ", Quantity: " << it->second << std::endl;
+    for (size_t i = 0; i < std::min(depth, book.bids().depth()); ++i) {
+        const BookLevel& level = book.bids().level(i);
+        log << "    Price: " << book.ToPrice(level.price_ticks) << ", Quantity: " << level.quantity << "\n";
+    }
+    log << "-----------------------------";
+}
+
+// Builds a snapshot of a local book, in double prices.
+void FillSnapshot(const std::string& instrument_id, const OrderBook& book, OrderBookSnapshot* snapshot) {
+    snapshot->set_instrument_id(instrument_id);
+    for (size_t i = 0; i < book.bids().depth(); ++i) {
+        PriceLevel* level = snapshot->add_bids();
+        level->set_price(book.ToPrice(book.bids().level(i).price_ticks));
+        level->set_quantity(book.bids().level(i).quantity);
+    }
+    for (size_t i = 0; i < book.asks().depth(); ++i) {
+        PriceLevel* level = snapshot->add_asks();
+        level->set_price(book.ToPrice(book.asks().level(i).price_ticks));
+        level->set_quantity(book.asks().level(i).quantity);
     }
-    std::cout << "-----------------------------" << std::endl;
 }
 
 class MarketDataClient {
 public:
-    MarketDataClient(std::shared_ptr<Channel> channel)
-        : stub_(MarketDataService::NewStub(channel)) {}
+    // With a recorder, every snapshot and every incremental update applied to the books
+    // is also recorded, stamped with the time its message was received.
+    MarketDataClient(std::shared_ptr<Channel> channel, const ClientOptions& options,
+                     std::unique_ptr<CaptureRecorder> recorder = nullptr)
+        : stub_(MarketDataService::NewStub(channel)), read_block_(new char[kReadArenaSize]),
+          recorder_(std::move(recorder)),
+          book_view_depth_(options.logging.quiet ? 0 : options.book_view_depth),
+          book_view_interval_(options.book_view_interval),
+          latency_report_interval_(options.latency_report_interval), subscription_depth_(options.subscription_depth) {}
 
     void SubscribeToMarketData(const std::vector<std::string>& instrument_ids) {
         ClientContext context;
         stream_ = stub_->Subscribe(&context);
 
-        auto writer_future = std::async(std::launch::async, [&]() {
-            for (const auto& id : instrument_ids) {
-                SubscriptionRequest request;
-                request.set_action(SubscriptionRequest::SUBSCRIBE);
-                request.set_instrument_id(id);
-                std::cout << "Client sending SUBSCRIBE request for: " << id << std::endl;
-                if (!stream_->Write(request)) {
-                    std::cerr << "Client failed to write SUBSCRIBE request for " << id << ". Stream likely broken." << std::endl;
-                    break;
-                }
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        // Every instrument, or pattern, goes in a single request; the server answers with
+        // one symbol directory and then the snapshots
+        Log() << "Client sending SUBSCRIBE request for " << instrument_ids.size() << " instruments";
+        if (!WriteRequest(SubscriptionRequest::SUBSCRIBE, instrument_ids)) {
+            Log(LogLevel::kError) << "Client failed to write SUBSCRIBE request. Stream likely broken.";
+        }
+
+        // Each message is decoded on an arena that is reset before the next read, so its
+        // nested messages come from the arena's fixed block instead of the heap.
+        ArenaOptions arena_options;
+        arena_options.initial_block = read_block_.get();
+        arena_options.initial_block_size = kReadArenaSize;
+        Arena arena(arena_options);
+
+        // Allocations made inside Read (the gRPC transport and decoding) and while applying
+        // the message are counted separately, after a warm-up
+        uint64_t messages = 0;
+        uint64_t read_allocations = 0;
+        uint64_t apply_allocations = 0;
+        auto next_book_view = std::chrono::steady_clock::now() + book_view_interval_;
+        auto last_latency_report = std::chrono::steady_clock::now();
+        while (true) {
+            arena.Reset();
+            MarketDataUpdate* update = Arena::CreateMessage<MarketDataUpdate>(&arena);
+            uint64_t before_read = ThreadAllocationCount();
+            if (!stream_->Read(update)) {
+                break;
+            }
+            uint64_t before_apply = ThreadAllocationCount();
+            StampReceived();
+            ProcessUpdate(*update);
+            if (++messages > kAllocationWarmupMessages) {
+                read_allocations += before_apply - before_read;
+                apply_allocations += ThreadAllocationCount() - before_apply;
             }
-            std::cout << "Writer thread finished." << std::endl;
-        });
 
+            // The book view is rendered outside the counted window; it is not on the
+            // per-message path
+            ReportPeriodically(&next_book_view, &last_latency_report);
+        }
 
-        MarketDataUpdate update;
-        while (stream_->Read(&update)) {
-            // Process the received update
-            if (update.has_snapshot()) {
-                const OrderBookSnapshot& snapshot = update.snapshot();
-                std::string instrument_id = snapshot.instrument_id();
-                std::cout << "Client received SNAPSHOT for instrument: " << instrument_id << std::endl;
-
-                // Clear existing data for this instrument and populate from snapshot
-                order_books_bids_[instrument_id].clear();
-                order_books_asks_[instrument_id].clear();
-
-                for (const auto& bid : snapshot.bids()) {
-                    order_books_bids_[instrument_id][bid.price()] = bid.quantity();
-                }
-                for (const auto& ask : snapshot.asks()) {
-                    order_books_asks_[instrument_id][ask.price()] = ask.quantity();
-                }
+        Log() << "Client read stream finished.";
+        // Reported even in quiet mode: this is what a benchmark run is for
+        FlushLog();
+        std::cout << "Client read " << messages << " messages. Heap allocations after the first "
+                  << kAllocationWarmupMessages << ": " << read_allocations << " reading, "
+                  << apply_allocations << " applying." << std::endl;
+        context.TryCancel();
+        if (recorder_) {
+            recorder_->Close();
+        }
 
-                PrintOrderBook(instrument_id, order_books_bids_[instrument_id], order_books_asks_[instrument_id]);
-
-            } else if (update.has_incremental_update()) {
-                const OrderBookIncrementalUpdate& incremental_update = update.incremental_update();
-                std::string instrument_id = incremental_update.instrument_id();
-                std::cout << "Client received INCREMENTAL UPDATE for instrument: " << instrument_id << std::endl;
-
-                // Apply incremental updates to the existing order book
-                // Here, we'll assume quantity > 0 is an add/modify, and quantity == 0 is a deletion.
-                for (const auto& bid_update : incremental_update.bid_updates()) {
-                    if (bid_update.quantity() > 0) {
-                        order_books_bids_[instrument_id][bid_update.price()] = bid_update.quantity();
-                    } else {
-                        // Assume quantity 0 means delete the price level
-                        order_books_bids_[instrument_id].erase(bid_update.price());
-                    }
-                }
+        Status status = stream_->Finish();
+        if (status.ok()) {
+            Log() << "Subscribe RPC completed successfully.";
+        } else {
+            Log(LogLevel::kError) << "Subscribe RPC failed: " << status.error_message();
+        }
+    }
 
-                for (const auto& ask_update : incremental_update.ask_updates()) {
-                     if (ask_update.quantity() > 0) {
-                        order_books_asks_[instrument_id][ask_update.price()] = ask_update.quantity();
-                    } else {
-                         // Assume quantity 0 means delete the price level
-                        order_books_asks_[instrument_id].erase(ask_update.price());
-                    }
-                }
+    // Reads incremental updates from the server's feed rather than a subscription, for
+    // kRunTime. The stream only carries control messages: one SNAPSHOT_ONLY request
+    // fetches the handles and snapshots of all the instruments, and each gap on the feed
+    // is recovered with another. A thread reads the stream into a queue that is drained
+    // between feed reads, so all books are applied on this thread.
+    void ReceiveFromFeed(const std::vector<std::string>& instrument_ids, FeedReceiver* feed) {
+        ClientContext context;
+        stream_ = stub_->Subscribe(&context);
+        recovery_action_ = SubscriptionRequest::SNAPSHOT_ONLY;
+        awaiting_directory_ = true;
+
+        Log() << "Client sending SNAPSHOT_ONLY request for " << instrument_ids.size() << " instruments";
+        if (!WriteRequest(SubscriptionRequest::SNAPSHOT_ONLY, instrument_ids)) {
+            Log(LogLevel::kError) << "Client failed to write SNAPSHOT_ONLY request. Stream likely broken.";
+        }
+
+        std::mutex control_mutex;
+        std::deque<MarketDataUpdate> control_updates;
+        std::thread control_reader([&] {
+            MarketDataUpdate update;
+            while (stream_->Read(&update)) {
+                std::lock_guard<std::mutex> lock(control_mutex);
+                control_updates.push_back(std::move(update));
+            }
+        });
+
+        ArenaOptions arena_options;
+        arena_options.initial_block = read_block_.get();
+        arena_options.initial_block_size = kReadArenaSize;
+        Arena arena(arena_options);
+
+        uint64_t feed_messages = 0;
+        uint64_t control_messages = 0;
+        std::deque<MarketDataUpdate> pending;
+        std::string datagram;
+        auto start = std::chrono::steady_clock::now();
+        auto next_book_view = start + book_view_interval_;
+        auto last_latency_report = start;
+        while (std::chrono::steady_clock::now() - start < kRunTime) {
+            {
+                std::lock_guard<std::mutex> lock(control_mutex);
+                pending.swap(control_updates);
+            }
+            for (const MarketDataUpdate& update : pending) {
+                StampReceived();
+                ProcessUpdate(update);
+                ++control_messages;
+            }
+            if (!pending.empty()) {
+                // Snapshots and directory entries may release updates held back for them
+                pending.clear();
+                ReplayFeedBacklog();
+            }
 
-                PrintOrderBook(instrument_id, order_books_bids_[instrument_id], order_books_asks_[instrument_id]);
+            if (feed->Receive(&datagram, kFeedPollTimeout)) {
+                StampReceived();
+                arena.Reset();
+                MarketDataUpdate* update = Arena::CreateMessage<MarketDataUpdate>(&arena);
+                if (update->ParseFromString(datagram)) {
+                    ProcessFeedUpdate(*update, datagram);
+                } else {
+                    Log(LogLevel::kError) << "Client received a malformed feed update of " << datagram.size() << " bytes";
+                }
+                ++feed_messages;
             }
+            ReportPeriodically(&next_book_view, &last_latency_report);
         }
 
-        std::cout << "Client read stream finished." << std::endl;
         context.TryCancel();
-        writer_future.get();
-
-        Status status = stream_->Finish();
-        if (status.ok()) {
-            std::cout << "Subscribe RPC completed successfully." << std::endl;
-        } else {
-            std::cerr << "Subscribe RPC failed: " << status.error_message() << std::endl;
+        control_reader.join();
+        stream_->Finish();
+        if (recorder_) {
+            recorder_->Close();
         }
+        FlushLog();
+        std::cout << "Client read " << feed_messages << " feed messages and " << control_messages
+                  << " control messages; " << feed->lost() << " feed updates known lost." << std::endl;
     }
 
     void UnsubscribeFromMarketData(const std::string& instrument_id) {
         if (!stream_) {
-            std::cerr << "Cannot unsubscribe: stream is not active." << std::endl;
+            Log(LogLevel::kError) << "Cannot unsubscribe: stream is not active.";
             return;
         }
 
+        Log() << "Client sending UNSUBSCRIBE request for: " << instrument_id;
+
+        if (!WriteRequest(SubscriptionRequest::UNSUBSCRIBE, instrument_id)) {
+            Log(LogLevel::kError) << "Client failed to write UNSUBSCRIBE request for " << instrument_id << ". Stream likely broken.";
+        }
+    }
+
+private:
+    struct InstrumentState {
+        std::string instrument_id;
+        OrderBook book;
+        // Sequence number the book is up to date with
+        uint64_t sequence = 0;
+        // Waiting for a requested snapshot after a gap
+        bool recovering = false;
+        // Names the instrument in recorded capture records
+        uint64_t capture_key = 0;
+        // Updates applied, and whether a snapshot arrived, since the book was last shown
+        uint64_t updates_since_view = 0;
+        bool changed_since_view = false;
+        // Present while latency is tracked
+        std::unique_ptr<LatencyStats> latency;
+    };
+
+    bool tracking_latency() const { return latency_report_interval_.count() > 0; }
+
+    // Applies one received message to the local books.
+    void ProcessUpdate(const MarketDataUpdate& update) {
+        if (update.has_batch()) {
+            for (const auto& batched_update : update.batch().updates()) {
+                ProcessUpdate(batched_update);
+            }
+
+        } else if (update.has_symbol_directory()) {
+            awaiting_directory_ = false;
+            for (const auto& entry : update.symbol_directory().entries()) {
+                InstrumentState* instrument = &FindInstrument(entry.instrument_id());
+                if (entry.instrument_handle() >= instruments_by_handle_.size()) {
+                    instruments_by_handle_.resize(entry.instrument_handle() + 1, nullptr);
+                }
+                instruments_by_handle_[entry.instrument_handle()] = instrument;
+            }
+
+        } else if (update.has_snapshot()) {
+            const OrderBookSnapshot& snapshot = update.snapshot();
+            const std::string& instrument_id = snapshot.instrument_id();
+            Log() << "Client received SNAPSHOT for instrument: " << instrument_id;
+
+            // Replace existing data for this instrument with the snapshot
+            InstrumentState& instrument = FindInstrument(instrument_id);
+            instrument.book.ApplySnapshot(snapshot);
+            instrument.sequence = snapshot.sequence();
+            instrument.recovering = false;
+            instrument.changed_since_view = true;
+            if (recorder_) {
+                recorder_->Record(instrument.capture_key, received_ns_, update);
+            }
+
+        } else if (update.has_incremental_update()) {
+            const OrderBookIncrementalUpdate& incremental_update = update.incremental_update();
+            InstrumentState* instrument = LookupInstrument(incremental_update);
+            if (instrument == nullptr) {
+                Log(LogLevel::kError) << "Client received INCREMENTAL UPDATE for unknown instrument handle: "
+                                      << incremental_update.instrument_handle();
+                return;
+            }
+            if (!CheckSequence(*instrument, incremental_update)) {
+                return;
+            }
+
+            // Apply incremental updates to the existing order book
+            // Here, we'll assume quantity > 0 is an add/modify, and quantity == 0 is a deletion.
+            instrument->book.ApplyIncremental(incremental_update);
+            ++instrument->updates_since_view;
+            instrument->changed_since_view = true;
+            if (recorder_) {
+                recorder_->Record(instrument->capture_key, received_ns_, update);
+            }
+            if (instrument->latency) {
+                LatencyStats& latency = *instrument->latency;
+                if (incremental_update.publish_timestamp_ns() != 0) {
+                    latency.publish_to_receive.Record(received_steady_ns_ -
+                                                      static_cast<int64_t>(incremental_update.publish_timestamp_ns()));
+                }
+                latency.receive_to_applied.Record(SteadyNowNs() - received_steady_ns_);
+                ++latency.updates;
+            }
+        }
+    }
+
+    bool WriteRequest(SubscriptionRequest::Action action, const std::string& instrument_id) {
         SubscriptionRequest request;
-        request.set_action(SubscriptionRequest::UNSUBSCRIBE);
         request.set_instrument_id(instrument_id);
+        return WriteRequest(action, &request);
+    }
 
-        std::cout << "Client sending UNSUBSCRIBE request for: " << instrument_id << std::endl;
+    bool WriteRequest(SubscriptionRequest::Action action, const std::vector<std::string>& instrument_ids) {
+        SubscriptionRequest request;
+        for (const auto& id : instrument_ids) {
+            request.add_instrument_ids(id);
+        }
+        return WriteRequest(action, &request);
+    }
 
-        if (!stream_->Write(request)) {
-            std::cerr << "Client failed to write UNSUBSCRIBE request for " << instrument_id << ". Stream likely broken." << std::endl;
+    // Requests are written both from the reading thread and the caller's thread
+    bool WriteRequest(SubscriptionRequest::Action action, SubscriptionRequest* request) {
+        request->set_action(action);
+        if (action == SubscriptionRequest::SUBSCRIBE) {
+            request->set_depth(subscription_depth_);
         }
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        return stream_->Write(*request);
+    }
+
+    // Returns true if the update should be applied. Updates already reflected in the
+    // book are dropped; on a gap the book is stale, so a snapshot is requested for this
+    // instrument alone and its updates are dropped until the snapshot arrives.
+    bool CheckSequence(InstrumentState& instrument, const OrderBookIncrementalUpdate& update) {
+        if (update.sequence() == 0) {
+            // Unsequenced feed
+            return true;
+        }
+        if (instrument.recovering || update.sequence() <= instrument.sequence) {
+            return false;
+        }
+        uint64_t first_sequence = update.first_sequence() != 0 ? update.first_sequence() : update.sequence();
+        if (first_sequence > instrument.sequence + 1) {
+            Log(LogLevel::kError) << "Client detected sequence gap for " << instrument.instrument_id << ": expected "
+                                  << instrument.sequence + 1 << ", received " << first_sequence << ". Requesting snapshot.";
+            instrument.recovering = true;
+            if (!WriteRequest(recovery_action_, instrument.instrument_id)) {
+                Log(LogLevel::kError) << "Client failed to write " << SubscriptionRequest::Action_Name(recovery_action_)
+                                      << " request for " << instrument.instrument_id << ". Stream likely broken.";
+            }
+            return false;
+        }
+        instrument.sequence = update.sequence();
+        return true;
+    }
+
+    InstrumentState& FindInstrument(const std::string& instrument_id) {
+        InstrumentState& instrument = instruments_[instrument_id];
+        if (instrument.instrument_id.empty()) {
+            instrument.instrument_id = instrument_id;
+            instrument.capture_key = CaptureInstrumentKey(instrument_id);
+            if (tracking_latency()) {
+                instrument.latency = std::make_unique<LatencyStats>();
+            }
+            // Feed updates only apply on top of a snapshot, which is always on its way
+            instrument.recovering = recovery_action_ == SubscriptionRequest::SNAPSHOT_ONLY;
+        }
+        return instrument;
+    }
+
+    // Applies an update read from the feed, whose raw bytes are datagram. The feed
+    // carries every instrument the server publishes there, so updates for others are
+    // ignored. It also runs ahead of the gRPC stream: updates for an instrument still
+    // waiting for its snapshot, or read before the directory says which instrument
+    // they are for, are held back until the snapshot arrives, oldest dropped first.
+    void ProcessFeedUpdate(const MarketDataUpdate& update, const std::string& datagram) {
+        if (update.has_incremental_update()) {
+            InstrumentState* instrument = LookupInstrument(update.incremental_update());
+            if (instrument == nullptr && !awaiting_directory_) {
+                return;
+            }
+            if (instrument == nullptr || instrument->recovering) {
+                if (feed_backlog_.size() == kMaxFeedBacklog) {
+                    feed_backlog_.pop_front();
+                }
+                feed_backlog_.push_back(datagram);
+                return;
+            }
+        }
+        ProcessUpdate(update);
+    }
+
+    // Offers the held-back feed updates again, in the order they were read.
+    void ReplayFeedBacklog() {
+        std::deque<std::string> backlog;
+        backlog.swap(feed_backlog_);
+        MarketDataUpdate update;
+        for (const std::string& datagram : backlog) {
+            if (update.ParseFromString(datagram)) {
+                ProcessFeedUpdate(update, datagram);
+            }
+        }
+    }
+
+    // Takes the receive time of the message about to be processed.
+    void StampReceived() {
+        if (tracking_latency()) {
+            received_steady_ns_ = SteadyNowNs();
+        }
+        if (recorder_) {
+            received_ns_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::system_clock::now().time_since_epoch()).count();
+            if (recorder_->RotateIfFull()) {
+                RecordBooks();
+            }
+        }
+    }
+
+    // Shows the changed books and reports latency when their intervals are up.
+    void ReportPeriodically(std::chrono::steady_clock::time_point* next_book_view,
+                            std::chrono::steady_clock::time_point* last_latency_report) {
+        if (book_view_depth_ > 0 && std::chrono::steady_clock::now() >= *next_book_view) {
+            PrintChangedBooks();
+            *next_book_view = std::chrono::steady_clock::now() + book_view_interval_;
+        }
+        if (tracking_latency() && std::chrono::steady_clock::now() - *last_latency_report >= latency_report_interval_) {
+            auto now = std::chrono::steady_clock::now();
+            ReportLatency(std::chrono::duration<double>(now - *last_latency_report).count());
+            *last_latency_report = now;
+        }
+    }
+
+    // Shows the top of every book that changed since the last view.
+    void PrintChangedBooks() {
+        for (auto& entry : instruments_) {
+            InstrumentState& instrument = entry.second;
+            if (!instrument.changed_since_view) {
+                continue;
+            }
+            PrintOrderBook(instrument.instrument_id, instrument.book, book_view_depth_, instrument.updates_since_view);
+            instrument.updates_since_view = 0;
+            instrument.changed_since_view = false;
+        }
+    }
+
+    // Reports latency percentiles, in microseconds, per instrument and over all of them,
+    // then starts a new interval. Reported even in quiet mode.
+    void ReportLatency(double seconds) {
+        LatencyStats total;
+        std::ostringstream report;
+        report << std::fixed << std::setprecision(1);
+        report << "Latency over the last " << seconds << "s in us (p50 / p99 / p99.9 / max):\n";
+        for (auto& entry : instruments_) {
+            LatencyStats& stats = *entry.second.latency;
+            if (stats.updates == 0) {
+                continue;
+            }
+            PrintLatencyLine(report, entry.first, stats, seconds);
+            total.Add(stats);
+            stats.Reset();
+        }
+        PrintLatencyLine(report, "all", total, seconds);
+        std::cout << report.str() << std::flush;
+    }
+
+    // Opens a freshly rotated capture file with the current books, so it replays on its own.
+    void RecordBooks() {
+        MarketDataUpdate update;
+        for (const auto& entry : instruments_) {
+            const InstrumentState& instrument = entry.second;
+            OrderBookSnapshot* snapshot = update.mutable_snapshot();
+            snapshot->Clear();
+            FillSnapshot(instrument.instrument_id, instrument.book, snapshot);
+            snapshot->set_sequence(instrument.sequence);
+            recorder_->Record(instrument.capture_key, received_ns_, update);
+        }
+    }
+
+    // Resolves an update by handle (a vector index) when it has one, by id otherwise.
+    InstrumentState* LookupInstrument(const OrderBookIncrementalUpdate& update) {
+        uint32_t handle = update.instrument_handle();
+        if (handle == 0) {
+            return &FindInstrument(update.instrument_id());
+        }
+        return handle < instruments_by_handle_.size() ? instruments_by_handle_[handle] : nullptr;
     }
 
-private:
     std::unique_ptr<MarketDataService::Stub> stub_;
     std::shared_ptr<ClientReaderWriter<SubscriptionRequest, MarketDataUpdate>> stream_;
-
-    // Data structures to hold the order book for each instrument
-    // Using std::map<double, double> to store price-quantity levels, ordered by price.
-    // Bids are typically sorted descending by price, Asks ascending.
-    std::map<std::string, std::map<double, double>> order_books_bids_;
-    std::map<std::string, std::map<double, double>> order_books_asks_;
+    std::mutex write_mutex_;
+    // Backing memory of the read arena
+    std::unique_ptr<char[]> read_block_;
+
+    // Order book for each instrument, looked up once per message. Elements of an
+    // unordered_map keep their address, so the handle table can point into it.
+    std::unordered_map<std::string, InstrumentState> instruments_;
+    std::vector<InstrumentState*> instruments_by_handle_;
+
+    std::unique_ptr<CaptureRecorder> recorder_;
+    // Receive time of the message being processed, in nanoseconds since the epoch
+    int64_t received_ns_ = 0;
+    // The same on the steady clock, which publish timestamps are taken from
+    int64_t received_steady_ns_ = 0;
+
+    size_t book_view_depth_;
+    std::chrono::milliseconds book_view_interval_;
+    std::chrono::milliseconds latency_report_interval_;
+    uint32_t subscription_depth_;
+
+    // How a gap is recovered: SNAPSHOT on a subscription, SNAPSHOT_ONLY when reading the feed
+    SubscriptionRequest::Action recovery_action_ = SubscriptionRequest::SNAPSHOT;
+    // Feed mode: no symbol directory has arrived yet, so unknown handles may be ours
+    bool awaiting_directory_ = false;
+    // Feed updates held back until their instrument's snapshot arrives
+    std::deque<std::string> feed_backlog_;
 };
 
+// Quotes a Prometheus label value.
+std::string LabelValue(const std::string& value) {
+    std::string quoted = "\"";
+    for (char c : value) {
+        if (c == '\\' || c == '"') {
+            quoted += '\\';
+            quoted += c;
+        } else if (c == '\n') {
+            quoted += "\\n";
+        } else {
+            quoted += c;
+        }
+    }
+    return quoted + "\"";
+}
+
+// Writes one metric family in the Prometheus text format, one sample per labelled
+// entry; labels are given without braces.
+template <typename Entries, typename Labels, typename Value>
+void PrintMetric(std::ostream& out, const std::string& name, const char* type, const char* help,
+                 const Entries& entries, Labels labels, Value value) {
+    out << "# HELP " << name << " " << help << "\n# TYPE " << name << " " << type << "\n";
+    for (const auto& entry : entries) {
+        out << name << "{" << labels(entry) << "} " << value(entry) << "\n";
+    }
+}
+
+// Fetches the server's counters and prints them in the Prometheus text format, so
+// they can be scraped through a textfile collector or read as they are. Streams that
+// have ended are summed under stream="closed".
+int PrintServerStats(const std::shared_ptr<Channel>& channel) {
+    std::unique_ptr<MarketDataService::Stub> stub = MarketDataService::NewStub(channel);
+    ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + kStatsTimeout);
+    ServerStats stats;
+    Status status = stub->GetStats(&context, StatsRequest(), &stats);
+    if (!status.ok()) {
+        std::cerr << "Cannot get server stats: " << status.error_message() << std::endl;
+        return 1;
+    }
+
+    std::vector<StreamStats> all_streams(stats.streams().begin(), stats.streams().end());
+    all_streams.push_back(stats.closed_streams());
+    auto stream_labels = [](const StreamStats& stream) {
+        if (stream.stream_id() == 0) {
+            return std::string("stream=\"closed\"");
+        }
+        return "stream=\"" + std::to_string(stream.stream_id()) + "\",peer=" + LabelValue(stream.peer());
+    };
+    auto instrument_labels = [](const InstrumentStats& instrument) {
+        return "instrument=" + LabelValue(instrument.instrument_id());
+    };
+
+    std::ostringstream out;
+    out << "# HELP market_data_streams_opened_total Subscribe streams accepted.\n"
+        << "# TYPE market_data_streams_opened_total counter\n"
+        << "market_data_streams_opened_total " << stats.streams_opened() << "\n";
+    PrintMetric(out, "market_data_stream_subscriptions", "gauge", "Instruments subscribed on the stream.",
+                stats.streams(), stream_labels, [](const StreamStats& s) { return s.subscriptions(); });
+    PrintMetric(out, "market_data_stream_queue_depth", "gauge", "Updates waiting in the outbound queue.",
+                stats.streams(), stream_labels, [](const StreamStats& s) { return s.queue_depth(); });
+    PrintMetric(out, "market_data_stream_max_queue_depth", "gauge", "Most updates ever waiting in the outbound queue.",
+                stats.streams(), stream_labels, [](const StreamStats& s) { return s.max_queue_depth(); });
+    PrintMetric(out, "market_data_stream_messages_sent_total", "counter", "Messages written to the stream.",
+                all_streams, stream_labels, [](const StreamStats& s) { return s.messages_sent(); });
+    PrintMetric(out, "market_data_stream_bytes_sent_total", "counter", "Encoded bytes written to the stream.",
+                all_streams, stream_labels, [](const StreamStats& s) { return s.bytes_sent(); });
+    PrintMetric(out, "market_data_stream_write_blocked_seconds_total", "counter",
+                "Time spent waiting for the transport to accept writes.", all_streams, stream_labels,
+                [](const StreamStats& s) { return s.write_blocked_ns() / 1e9; });
+    PrintMetric(out, "market_data_stream_updates_conflated_total", "counter",
+                "Updates merged into a pending conflated update.", all_streams, stream_labels,
+                [](const StreamStats& s) { return s.updates_conflated(); });
+    PrintMetric(out, "market_data_stream_updates_dropped_total", "counter",
+                "Updates dropped because the stream was closed or broken.", all_streams, stream_labels,
+                [](const StreamStats& s) { return s.updates_dropped(); });
+    PrintMetric(out, "market_data_instrument_subscribers", "gauge", "Subscribers of the instrument.",
+                stats.instruments(), instrument_labels,
+                [](const InstrumentStats& i) { return i.subscribers(); });
+    PrintMetric(out, "market_data_instrument_updates_published_total", "counter", "Incremental updates generated.",
+                stats.instruments(), instrument_labels,
+                [](const InstrumentStats& i) { return i.updates_published(); });
+    PrintMetric(out, "market_data_instrument_bytes_published_total", "counter",
+                "Encoded bytes of the updates generated.", stats.instruments(), instrument_labels,
+                [](const InstrumentStats& i) { return i.bytes_published(); });
+    PrintMetric(out, "market_data_instrument_deliveries_total", "counter", "Updates handed to a subscriber.",
+                stats.instruments(), instrument_labels,
+                [](const InstrumentStats& i) { return i.deliveries(); });
+    PrintMetric(out, "market_data_instrument_snapshots_sent_total", "counter", "Snapshots sent to subscribers.",
+                stats.instruments(), instrument_labels,
+                [](const InstrumentStats& i) { return i.snapshots_sent(); });
+    PrintMetric(out, "market_data_instrument_snapshots_built_total", "counter",
+                "Snapshots built because the cached one was out of date.", stats.instruments(), instrument_labels,
+                [](const InstrumentStats& i) { return i.snapshots_built(); });
+    std::cout << out.str() << std::flush;
+    return 0;
+}
+
+// Reads the books through a FeedHandler, with the main thread as its only consumer:
+// it drains the event rings and shows the top of each changed book periodically.
+int RunShardedClient(const std::string& server_address, const ClientOptions& options) {
+    FeedHandlerOptions feed_options;
+    feed_options.server_address = server_address;
+    feed_options.instruments = options.instruments;
+    feed_options.shards = options.shards;
+    feed_options.depth = std::max<size_t>(1, std::min(options.book_view_depth, kMaxPublishedDepth));
+    feed_options.subscription_depth = options.subscription_depth;
+    feed_options.first_cpu = options.first_cpu;
+    feed_options.profile = options.profile;
+    FeedHandler handler(feed_options);
+
+    Log() << "Client connecting to server at " << server_address << " with " << options.shards << " shards";
+    handler.Start();
+
+    std::vector<BookEvent> events(kPollBatch);
+    std::vector<uint64_t> changes(options.instruments.size());
+    uint64_t total_events = 0;
+    size_t view_depth = options.logging.quiet ? 0 : options.book_view_depth;
+    auto start = std::chrono::steady_clock::now();
+    auto next_book_view = start + options.book_view_interval;
+    while (std::chrono::steady_clock::now() - start < kRunTime) {
+        size_t count = handler.Poll(0, events.data(), events.size());
+        for (size_t i = 0; i < count; ++i) {
+            ++changes[events[i].instrument];
+        }
+        total_events += count;
+        if (view_depth > 0 && std::chrono::steady_clock::now() >= next_book_view) {
+            for (size_t i = 0; i < changes.size(); ++i) {
+                if (changes[i] == 0) {
+                    continue;
+                }
+                BookTop top = handler.Top(i);
+                Log log;
+                log << std::fixed << std::setprecision(2);
+                log << "--- Top of " << options.instruments[i] << " (" << changes[i]
+                    << " changes since last view, sequence " << top.sequence << ") ---\n";
+                log << "  ASKS:\n";
+                for (size_t level = top.ask_depth; level-- > 0;) {
+                    log << "    Price: " << top.asks[level].price_ticks * top.tick_size
+                        << ", Quantity: " << top.asks[level].quantity << "\n";
+                }
+                log << "  BIDS:\n";
+                for (size_t level = 0; level < top.bid_depth; ++level) {
+                    log << "    Price: " << top.bids[level].price_ticks * top.tick_size
+                        << ", Quantity: " << top.bids[level].quantity << "\n";
+                }
+                log << "-----------------------------";
+                changes[i] = 0;
+            }
+            next_book_view = std::chrono::steady_clock::now() + options.book_view_interval;
+        }
+        if (count == 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    handler.Stop();
+    FlushLog();
+    std::cout << "Feed handler summary: " << handler.messages() << " messages, " << total_events << " events, "
+              << handler.dropped_events() << " events dropped" << std::endl;
+    return 0;
+}
+
+// Splits a comma-separated list, skipping empty items.
+std::vector<std::string> SplitList(const std::string& list) {
+    std::vector<std::string> items;
+    std::stringstream in(list);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+void PrintUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "  --record=FILE            Record received updates to a capture file\n"
+              << "  --record-file-mb=N       Start a new capture file every N MiB (default: never)\n"
+              << "  --quiet                  Log only errors and the final summary, for benchmark runs\n"
+              << "  --book-depth=N           Levels per side in the periodic book view, 0 for none (default 5)\n"
+              << "  --book-interval-ms=N     How often changed books are shown (default 1000)\n"
+              << "  --latency-report-ms=N    Report latency percentiles every N ms (server needs --timestamps)\n"
+              << "  --stats                  Print the server's metrics in Prometheus text format and exit\n"
+              << "  --instruments=A,B,...    Instruments to subscribe to, \"SYM*\" for all starting with SYM (default AAPL,MSFT)\n"
+              << "  --depth=N                Subscribe to the best N levels per side only, 1 for BBO (default full)\n"
+              << "  --shards=N               Read through a feed handler with N streams and threads\n"
+              << "  --pin-cpus=FIRST         Pin feed handler thread i to CPU FIRST + i\n"
+              << "  --profile=latency|throughput  gRPC transport settings, as given to the server\n"
+              << "  --feed-udp=HOST:PORT     Read updates from the server's UDP feed, taking snapshots over gRPC\n"
+              << "  --feed-shm=NAME          Read updates from the server's shared-memory ring /dev/shm/NAME" << std::endl;
+}
+
 int main(int argc, char** argv) {
     std::string server_address("localhost:50051");
 
-    std::shared_ptr<Channel> channel = grpc::CreateChannel(
-        server_address, grpc::InsecureChannelCredentials());
+    ClientOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        std::string value;
+        int64_t millis = 0;
+        if (FlagValue(arg, "--record", &value)) {
+            options.record_path = value;
+        } else if (FlagValue(arg, "--record-file-mb", &value) && ParseNumber(value, &options.record_file_mb)) {
+        } else if (arg == "--quiet") {
+            options.logging.quiet = true;
+        } else if (FlagValue(arg, "--book-depth", &value) && ParseNumber(value, &options.book_view_depth)) {
+        } else if (FlagValue(arg, "--book-interval-ms", &value) && ParseNumber(value, &millis) && millis >= 0) {
+            options.book_view_interval = std::chrono::milliseconds(millis);
+        } else if (FlagValue(arg, "--latency-report-ms", &value) && ParseNumber(value, &millis) && millis >= 0) {
+            options.latency_report_interval = std::chrono::milliseconds(millis);
+        } else if (arg == "--stats") {
+            options.print_server_stats = true;
+        } else if (FlagValue(arg, "--instruments", &value) && !SplitList(value).empty()) {
+            options.instruments = SplitList(value);
+        } else if (FlagValue(arg, "--depth", &value) && ParseNumber(value, &options.subscription_depth)) {
+        } else if (FlagValue(arg, "--shards", &value) && ParseNumber(value, &options.shards)) {
+        } else if (FlagValue(arg, "--pin-cpus", &value) && ParseNumber(value, &options.first_cpu)) {
+        } else if (FlagValue(arg, "--profile", &value) && ParseTransportProfile(value, &options.profile)) {
+        } else if (FlagValue(arg, "--feed-udp", &value)) {
+            options.feed_udp = value;
+        } else if (FlagValue(arg, "--feed-shm", &value)) {
+            options.feed_shm = value;
+        } else {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    ConfigureLogging(options.logging);
 
-    MarketDataClient client(channel);
+    grpc::ChannelArguments channel_args;
+    ApplyTransportProfile(options.profile, &channel_args);
+    std::shared_ptr<Channel> channel =
+        grpc::CreateCustomChannel(server_address, grpc::InsecureChannelCredentials(), channel_args);
 
-    std::vector<std::string> instruments_to_subscribe = {"AAPL", "MSFT"};
+    if (options.print_server_stats) {
+        return PrintServerStats(channel);
+    }
+    bool from_feed = !options.feed_udp.empty() || !options.feed_shm.empty();
+    if (from_feed && (options.shards > 0 || (!options.feed_udp.empty() && !options.feed_shm.empty()))) {
+        std::cerr << "--feed-udp and --feed-shm each replace the subscription; use one, without --shards" << std::endl;
+        return 1;
+    }
+    if (options.shards > 0) {
+        // Instruments are spread over the shards by id, so each has to be named
+        if (std::any_of(options.instruments.begin(), options.instruments.end(),
+                        [](const std::string& id) { return id.back() == '*'; })) {
+            std::cerr << "--shards needs explicit instruments, not patterns" << std::endl;
+            return 1;
+        }
+        return RunShardedClient(server_address, options);
+    }
 
-    std::cout << "Client connecting to server at " << server_address << std::endl;
+    std::unique_ptr<CaptureRecorder> recorder;
+    if (!options.record_path.empty()) {
+        std::string error;
+        recorder = CaptureRecorder::Open(options.record_path, options.record_file_mb * 1024 * 1024, &error);
+        if (!recorder) {
+            std::cerr << "Cannot record: " << error << std::endl;
+            return 1;
+        }
+        Log() << "Recording to " << options.record_path;
+    }
+
+    MarketDataClient client(channel, options, std::move(recorder));
+
+    Log() << "Client connecting to server at " << server_address;
+
+    if (from_feed) {
+        std::string error;
+        std::unique_ptr<FeedReceiver> feed = options.feed_udp.empty() ? OpenShmReceiver(options.feed_shm, &error)
+                                                                     : OpenUdpReceiver(options.feed_udp, &error);
+        if (!feed) {
+            std::cerr << "Cannot read feed: " << error << std::endl;
+            return 1;
+        }
+        client.ReceiveFromFeed(options.instruments, feed.get());
+        Log() << "Client finished.";
+        FlushLog();
+        return 0;
+    }
 
-    auto subscribe_future = std::async(std::launch::async, &MarketDataClient::SubscribeToMarketData, &client, instruments_to_subscribe);
+    auto subscribe_future = std::async(std::launch::async, &MarketDataClient::SubscribeToMarketData, &client, options.instruments);
 
     std::this_thread::sleep_for(std::chrono::seconds(10));
 
-    client.UnsubscribeFromMarketData("AAPL");
+    client.UnsubscribeFromMarketData(options.instruments.front());
 
     std::this_thread::sleep_for(std::chrono::seconds(10));
 
     subscribe_future.get();
 
-    std::cout << "Client finished." << std::endl;
+    Log() << "Client finished.";
+    FlushLog();
 
     return 0;
 }
\ No newline at end of file
@@ -1,18 +1,33 @@
+#include <algorithm>
+#include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <map>
 #include <set>
-#include <thread>
-#include <chrono>
-#include <atomic>
+#include <memory>
 
 #include <grpcpp/grpcpp.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/method_handler.h>
 
 // Include the generated files
 #include "market_data.grpc.pb.h"
 #include "market_data.pb.h"
 
+#include "async_server.h"
+#include "capture.h"
+#include "feed_publisher.h"
+#include "feed_transport.h"
+#include "flags.h"
+#include "log.h"
+#include "publisher_engine.h"
+#include "server_metrics.h"
+#include "stream_session.h"
+#include "stream_writer.h"
+#include "transport_profile.h"
+
 using grpc::Server;
 using grpc::ServerBuilder;
 using grpc::ServerContext;
@@ -24,162 +39,129 @@ using marketdata::MarketDataUpdate;
 using marketdata::OrderBookSnapshot;
 using marketdata::OrderBookIncrementalUpdate;
 using marketdata::PriceLevel;
+using marketdata::ServerStats;
+using marketdata::StatsRequest;
 
-// A helper function to simulate streaming incremental updates
-void StreamIncrementalUpdates(
-    const std::string& instrument_id, ServerContext* context,
-    grpc::ServerReaderWriter<MarketDataUpdate, SubscriptionRequest>* stream,
-    std::atomic<bool>& stop_streaming) {
-
-    std::cout << "Starting incremental update stream for instrument: " << instrument_id << std::endl;
-
-    // Simulate sending updates every second
-    int update_count = 0;
-    while (!stop_streaming.load() && !context->IsCancelled()) {
-        MarketDataUpdate update;
-        OrderBookIncrementalUpdate* incremental_update = update.mutable_incremental_update();
-        incremental_update->set_instrument_id(instrument_id);
-
-        // Simulate a small price change
-        double price_change = (update_count % 2 == 0) ? 0.1 : -0.1;
+namespace {
 
-        PriceLevel* bid_update = incremental_update->add_bid_updates();
-        bid_update->set_price(99.0 + price_change);
-        bid_update->set_quantity(200 + update_count * 10);
+// Full names of the MarketDataService methods, as registered by the generated service
+constexpr char kSubscribeMethod[] = "/marketdata.MarketDataService/Subscribe";
+constexpr char kGetStatsMethod[] = "/marketdata.MarketDataService/GetStats";
 
-        PriceLevel* ask_update = incremental_update->add_ask_updates();
-        ask_update->set_price(100.0 - price_change);
-        ask_update->set_quantity(150 + update_count * 5);
+} // namespace
 
-        // Attempt to write the update to the stream
-        if (!stream->Write(update)) {
-            std::cerr << "Failed to write incremental update for " << instrument_id << ". Client likely disconnected." << std::endl;
-            break; // Exit the loop if writing fails
-        }
-
-        update_count++;
-        std::this_thread::sleep_for(std::chrono::seconds(1)); // Simulate update frequency
-    }
-
-    std::cout << "Stopped incremental update stream for instrument: " << instrument_id << std::endl;
-}
-
-
-class MarketDataServiceImpl final : public MarketDataService::Service {
+// Synchronous MarketDataService. Subscribe is registered by hand, in place of the
+// generated typed handler, with grpc::ByteBuffer as its response type: requests are
+// still decoded by gRPC, but updates are written as the bytes they were encoded to
+// once, when they were published, instead of being serialized again for each stream.
+class MarketDataServiceImpl final : public grpc::Service {
 public:
+    MarketDataServiceImpl(PublisherEngine* engine, ServerMetrics* metrics, BatchOptions batching)
+        : engine_(engine), metrics_(metrics), batching_(batching) {
+        AddMethod(new grpc::internal::RpcServiceMethod(
+            kSubscribeMethod, grpc::internal::RpcMethod::BIDI_STREAMING,
+            new grpc::internal::BidiStreamingHandler<MarketDataServiceImpl, SubscriptionRequest, grpc::ByteBuffer>(
+                [](MarketDataServiceImpl* service, ServerContext* context, StreamWriter::Stream* stream) {
+                    return service->Subscribe(context, stream);
+                },
+                this)));
+        AddMethod(new grpc::internal::RpcServiceMethod(
+            kGetStatsMethod, grpc::internal::RpcMethod::NORMAL_RPC,
+            new grpc::internal::RpcMethodHandler<MarketDataServiceImpl, StatsRequest, ServerStats>(
+                [](MarketDataServiceImpl* service, ServerContext* context, const StatsRequest* request,
+                   ServerStats* response) { return service->GetStats(context, request, response); },
+                this)));
+    }
 
-    Status Subscribe(ServerContext* context,
-                     grpc::ServerReaderWriter<MarketDataUpdate, SubscriptionRequest>* stream) override {
+    Status GetStats(ServerContext* /*context*/, const StatsRequest* /*request*/, ServerStats* response) {
+        metrics_->Collect(response);
+        return Status::OK;
+    }
 
-        std::cout << "Client connected." << std::endl;
+    Status Subscribe(ServerContext* context, StreamWriter::Stream* stream) {
 
-        // Use a map within the scope of this stream to manage update threads for instruments on THIS stream
-        std::map<std::string, std::thread> update_threads;
-        std::map<std::string, std::atomic<bool>> stop_signals;
+        Log() << "Client connected.";
 
+        auto subscriber = std::make_shared<StreamWriter>(stream, batching_, context);
+        metrics_->AddStream(subscriber, context->peer());
+        StreamSession session(engine_, subscriber);
 
         SubscriptionRequest request;
         // This loop will receive messages from the client
         while (stream->Read(&request)) {
-            std::string instrument_id = request.instrument_id();
-            std::cout << "Received subscription request: Action="
-                      << (request.action() == SubscriptionRequest::SUBSCRIBE ? "SUBSCRIBE" : "UNSUBSCRIBE")
-                      << ", Instrument=" << instrument_id << std::endl;
-
-            if (request.action() == SubscriptionRequest::SUBSCRIBE) {
-                // Check if we are already streaming for this instrument on this stream
-                if (update_threads.find(instrument_id) == update_threads.end() || !update_threads.at(instrument_id).joinable()) {
-                     // Send initial snapshot (as implemented before)
-                    MarketDataUpdate snapshot_update;
-                    OrderBookSnapshot* snapshot = snapshot_update.mutable_snapshot();
-                    snapshot->set_instrument_id(instrument_id);
-
-                    // Add some dummy bid and ask levels for the snapshot
-                    PriceLevel* bid1 = snapshot->add_bids();
-                    bid1->set_price(99.5);
-                    bid1->set_quantity(100);
-
-                    PriceLevel* bid2 = snapshot->add_bids();
-                    bid2->set_price(99.0);
-                    bid2->set_quantity(200);
-
-                    PriceLevel* ask1 = snapshot->add_asks();
-                    ask1->set_price(100.0);
-                    ask1->set_quantity(150);
-
-                    PriceLevel* ask2 = snapshot->add_asks();
-                    ask2->set_price(100.5);
-                    ask2->set_quantity(250);
-
-                    if (stream->Write(snapshot_update)) {
-                      std::cout << "Sent snapshot for instrument: " << instrument_id << std::endl;
-                    } else {
-                      std::cerr << "Failed to send snapshot for instrument: " << instrument_id << ". Client likely disconnected." << std::endl;
-                      // If sending snapshot fails, the client might be gone, break the read loop
-                      break;
-                    }
-
-                    // Start a new thread to stream incremental updates for this instrument
-                    stop_signals[instrument_id].store(false); // Initialize stop signal
-                    update_threads[instrument_id] = std::thread(
-                        StreamIncrementalUpdates, instrument_id, context, stream, std::ref(stop_signals[instrument_id]));
-
-                } else {
-                    std::cout << "Already streaming updates for " << instrument_id << " on this stream." << std::endl;
-                }
-
-            } else if (request.action() == SubscriptionRequest::UNSUBSCRIBE) {
-                // Find the thread for this instrument and signal it to stop
-                if (update_threads.find(instrument_id) != update_threads.end() && update_threads.at(instrument_id).joinable()) {
-                     std::cout << "Signaling stop for update stream for instrument: " << instrument_id << std::endl;
-                     stop_signals[instrument_id].store(true); // Signal the thread to stop
-                     // We don't join here to avoid blocking the read loop.
-                     // The thread will be joined when this Subscribe RPC finishes.
-                }
-
-                // Send an empty snapshot upon unsubscription
-                MarketDataUpdate unsubscribe_update;
-                OrderBookSnapshot* snapshot = unsubscribe_update.mutable_snapshot();
-                snapshot->set_instrument_id(instrument_id); // Send for the specific instrument
-
-                 if (stream->Write(unsubscribe_update)) {
-                     std::cout << "Sent empty snapshot for unsubscription: " << instrument_id << std::endl;
-                 } else {
-                     std::cerr << "Failed to send empty snapshot for unsubscription: " << instrument_id << std::endl;
-                     // If sending fails, client might be gone, break the read loop
-                     break;
-                 }
+            if (!session.HandleRequest(request)) {
+                break;
             }
         }
 
         // This point is reached when the client stream is closed (stream->Read returns false)
-        std::cout << "Client stream closed. Stopping all update threads for this stream." << std::endl;
-
-        // Signal all active update threads for this stream to stop
-        for(auto const& [id, stop_signal] : stop_signals) {
-            stop_signals[id].store(true);
-        }
-
-        // Join all update threads associated with this stream to ensure they finish cleanly
-        for(auto& pair : update_threads) {
-            if (pair.second.joinable()) {
-                pair.second.join();
-            }
-        }
+        Log() << "Client stream closed. Removing all subscriptions for this stream.";
 
-        std::cout << "All update threads joined for this stream." << std::endl;
+        // Detach from the engine and make sure no worker writes to the stream after we return
+        session.UnsubscribeAll();
+        subscriber->Close();
 
         return Status::OK;
     }
+
+private:
+    PublisherEngine* engine_;
+    ServerMetrics* metrics_;
+    BatchOptions batching_;
+};
+
+// Command line configuration of the server
+struct ServerOptions {
+    bool async_mode = false;
+    PriceEncoding encoding = PriceEncoding::kDouble;
+    BatchOptions batching;
+    TransportProfile profile = TransportProfile::kDefault;
+    SimulatorOptions simulator;
+    PacingOptions pacing;
+    LogOptions logging;
+    bool timestamps = false;
+    // Publisher worker threads, 0 for one per hardware thread
+    size_t workers = 0;
+    // Pins publisher worker i to CPU first_cpu + i; negative leaves them unpinned
+    int first_cpu = -1;
+    // Instruments known from the start, so that pattern subscriptions match them
+    std::vector<std::string> symbols;
+    // Feed transports the symbols' updates are also sent over, if any
+    std::string feed_udp;
+    std::string feed_shm;
+    std::shared_ptr<FeedPublisher> feed;
 };
 
-void RunServer() {
+void RunServer(const ServerOptions& options) {
+    ConfigureLogging(options.logging);
     std::string server_address("0.0.0.0:50051"); // Listen on all interfaces, port 50051
-    MarketDataServiceImpl service;
+    PublisherEngine engine(options.workers, options.encoding, options.simulator, options.pacing, options.timestamps,
+                           options.first_cpu);
+    for (const std::string& symbol : options.symbols) {
+        engine.InstrumentHandle(symbol);
+    }
+    engine.Start();
+    if (options.feed) {
+        // The feed carries every listed instrument for as long as the server runs
+        for (const std::string& symbol : options.symbols) {
+            engine.Subscribe(symbol, options.feed);
+        }
+        Log() << "Publishing " << options.symbols.size() << " instruments on the feed.";
+    }
+    ServerMetrics metrics(&engine);
+
+    if (options.async_mode) {
+        AsyncMarketDataServer async_server(&engine, &metrics, options.batching);
+        async_server.Run(server_address, options.profile);
+        return;
+    }
+
+    MarketDataServiceImpl service(&engine, &metrics, options.batching);
 
     ServerBuilder builder;
     // Listen on the given address without any authentication mechanism.
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    ApplyTransportProfile(options.profile, &builder);
     // Register "service" as the instance awaiting incoming RPCs.
     builder.RegisterService(&service);
 
@@ -192,7 +174,160 @@ void RunServer() {
     server->Wait();
 }
 
+// Reads a symbol list: whitespace-separated instrument ids, with '#' starting a comment
+// line.
+bool LoadSymbols(const std::string& path, std::vector<std::string>* symbols, std::string* error) {
+    std::ifstream in(path);
+    if (!in) {
+        *error = "cannot open " + path;
+        return false;
+    }
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        std::string symbol;
+        while (fields >> symbol) {
+            symbols->push_back(symbol);
+        }
+    }
+    return true;
+}
+
+void PrintUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "  --async                  Serve streams from completion queues\n"
+              << "  --quiet                  Log only errors, for benchmark runs\n"
+              << "  --fixed-point            Publish integer ticks and lots instead of doubles\n"
+              << "  --compact                Fixed point, with incremental levels delta-encoded into packed fields\n"
+              << "  --timestamps             Stamp updates with their generation time, for latency measurement\n"
+              << "  --workers=N              Publisher worker threads (default one per hardware thread)\n"
+              << "  --pin-cpus=FIRST         Pin publisher worker i to CPU FIRST + i\n"
+              << "  --batch-window-us=N      Group updates into batches of up to N microseconds\n"
+              << "  --batch-size=N           Maximum updates per batch (default 64)\n"
+              << "  --profile=latency|throughput  gRPC transport and batching settings; clients should match (default none)\n"
+              << "  --sim=random-walk|toggle Market model (default random-walk)\n"
+              << "  --depth=N                Book levels per side (default 10)\n"
+              << "  --rate=N                 Mean events per second per instrument (default 1)\n"
+              << "  --fixed-interval         Evenly spaced events instead of Poisson arrivals\n"
+              << "  --seed=N                 Simulator seed (default 1)\n"
+              << "  --symbols=FILE           Instruments that pattern subscriptions such as \"SYM*\" can match\n"
+              << "  --feed-udp=HOST:PORT     Also send the listed instruments' updates as UDP datagrams, e.g. to a multicast group\n"
+              << "  --feed-shm=NAME          Also write the listed instruments' updates to the shared-memory ring /dev/shm/NAME\n"
+              << "  --replay=FILE            Replay a capture file instead of simulating\n"
+              << "  --replay-speed=N         Replay at N times the recorded pace, 0 for flat out (default 1)\n"
+              << "  --pacing=sleep|spin|hybrid  How workers wait for the next event (default sleep)\n"
+              << "  --spin-us=N              Hybrid pacing spins for the last N microseconds (default 100)\n"
+              << "  --burst=N                Run at N times the rate for the first 100ms of every second\n"
+              << "  --rate-profile=FILE      Scale the rate by a recorded \"<duration_ms> <multiplier>\" profile" << std::endl;
+}
+
 int main(int argc, char** argv) {
-    RunServer();
+    ServerOptions options;
+    bool explicit_batch_window = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        std::string value;
+        size_t count = 0;
+        int64_t micros = 0;
+        double factor = 0;
+        if (arg == "--async") {
+            options.async_mode = true;
+        } else if (arg == "--quiet") {
+            options.logging.quiet = true;
+        } else if (arg == "--fixed-point") {
+            options.encoding = PriceEncoding::kFixedPoint;
+        } else if (arg == "--compact") {
+            options.encoding = PriceEncoding::kCompact;
+        } else if (arg == "--timestamps") {
+            options.timestamps = true;
+        } else if (FlagValue(arg, "--workers", &value) && ParseNumber(value, &options.workers)) {
+        } else if (FlagValue(arg, "--pin-cpus", &value) && ParseNumber(value, &options.first_cpu)) {
+        } else if (FlagValue(arg, "--batch-window-us", &value) && ParseNumber(value, &micros) && micros >= 0) {
+            options.batching.window = std::chrono::microseconds(micros);
+            explicit_batch_window = true;
+        } else if (FlagValue(arg, "--batch-size", &value) && ParseNumber(value, &count)) {
+            options.batching.max_updates = std::max<size_t>(1, count);
+        } else if (FlagValue(arg, "--profile", &value) && ParseTransportProfile(value, &options.profile)) {
+        } else if (FlagValue(arg, "--sim", &value) && (value == "random-walk" || value == "toggle")) {
+            options.simulator.model =
+                value == "toggle" ? SimulatorOptions::Model::kToggle : SimulatorOptions::Model::kRandomWalk;
+        } else if (FlagValue(arg, "--depth", &value) && ParseNumber(value, &count)) {
+            options.simulator.depth = std::max<size_t>(1, count);
+        } else if (FlagValue(arg, "--rate", &value) && ParseNumber(value, &factor) && factor > 0) {
+            options.simulator.events_per_second = factor;
+        } else if (arg == "--fixed-interval") {
+            options.simulator.poisson_arrivals = false;
+        } else if (FlagValue(arg, "--seed", &value) && ParseNumber(value, &options.simulator.seed)) {
+        } else if (FlagValue(arg, "--symbols", &value)) {
+            std::string error;
+            if (!LoadSymbols(value, &options.symbols, &error)) {
+                std::cerr << "Invalid symbol list: " << error << std::endl;
+                PrintUsage(argv[0]);
+                return 1;
+            }
+        } else if (FlagValue(arg, "--feed-udp", &value)) {
+            options.feed_udp = value;
+        } else if (FlagValue(arg, "--feed-shm", &value)) {
+            options.feed_shm = value;
+        } else if (FlagValue(arg, "--replay", &value)) {
+            std::string error;
+            options.simulator.capture = CaptureFile::Open(value, &error);
+            if (!options.simulator.capture) {
+                std::cerr << "Invalid capture: " << error << std::endl;
+                PrintUsage(argv[0]);
+                return 1;
+            }
+            options.simulator.model = SimulatorOptions::Model::kReplay;
+        } else if (FlagValue(arg, "--replay-speed", &value) && ParseNumber(value, &factor) && factor >= 0) {
+            options.simulator.replay_speed = factor;
+        } else if (FlagValue(arg, "--pacing", &value) && (value == "sleep" || value == "spin" || value == "hybrid")) {
+            options.pacing.mode = value == "spin"     ? PacingMode::kSpin
+                                  : value == "hybrid" ? PacingMode::kHybrid
+                                                      : PacingMode::kSleep;
+        } else if (FlagValue(arg, "--spin-us", &value) && ParseNumber(value, &micros) && micros >= 0) {
+            options.pacing.spin_threshold = std::chrono::microseconds(micros);
+        } else if (FlagValue(arg, "--burst", &value) && ParseNumber(value, &factor) && factor > 0) {
+            options.pacing.profile = RateProfile::Bursty(std::chrono::seconds(1), 0.1, factor);
+        } else if (FlagValue(arg, "--rate-profile", &value)) {
+            std::string error;
+            if (!RateProfile::Load(value, &options.pacing.profile, &error)) {
+                std::cerr << "Invalid rate profile: " << error << std::endl;
+                PrintUsage(argv[0]);
+                return 1;
+            }
+        } else {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    ApplyTransportProfile(options.profile, explicit_batch_window, &options.batching);
+
+    if (!options.feed_udp.empty() || !options.feed_shm.empty()) {
+        if (options.symbols.empty()) {
+            std::cerr << "The feed carries the instruments listed by --symbols" << std::endl;
+            PrintUsage(argv[0]);
+            return 1;
+        }
+        std::vector<std::unique_ptr<FeedSender>> senders;
+        std::string error;
+        if (!options.feed_udp.empty()) {
+            senders.push_back(OpenUdpSender(options.feed_udp, &error));
+        }
+        if (!options.feed_shm.empty() && error.empty()) {
+            senders.push_back(OpenShmSender(options.feed_shm, &error));
+        }
+        if (!error.empty()) {
+            std::cerr << "Invalid feed: " << error << std::endl;
+            PrintUsage(argv[0]);
+            return 1;
+        }
+        options.feed = std::make_shared<FeedPublisher>(std::move(senders));
+    }
+
+    RunServer(options);
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,455 @@
+#include "market_simulator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "capture.h"
+#include "compact_levels.h"
+#include "log.h"
+#include "order_book.h"
+
+using marketdata::MarketDataUpdate;
+using marketdata::OrderBookIncrementalUpdate;
+using marketdata::OrderBookSnapshot;
+using marketdata::PriceLevel;
+
+namespace {
+
+// Range the initial mid price of an instrument is drawn from, in ticks
+constexpr int64_t kMinInitialMidTicks = 5000;
+constexpr int64_t kMaxInitialMidTicks = 50000;
+
+// Quantities are drawn uniformly from 1 to this many lots
+constexpr int64_t kMaxLots = 1000;
+
+// Probabilities of each kind of event; the remainder modifies an existing level
+constexpr double kMidMoveProbability = 0.05;
+constexpr double kAddProbability = 0.15;
+constexpr double kDeleteProbability = 0.15;
+
+// Chance that an event hits the best level, then the next one, and so on, so activity
+// concentrates at the top of the book
+constexpr double kTopOfBookBias = 0.35;
+
+// New levels are added up to this many times the configured depth away from the mid
+constexpr int64_t kAddRangeFactor = 2;
+
+// FNV-1a, so an instrument's seed does not depend on the standard library's hash
+uint64_t HashId(const std::string& instrument_id) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : instrument_id) {
+        hash = (hash ^ c) * 1099511628211ull;
+    }
+    return hash;
+}
+
+std::chrono::nanoseconds FixedInterval(double events_per_second) {
+    return std::chrono::nanoseconds(static_cast<int64_t>(1e9 / events_per_second));
+}
+
+// Keeps a full book per side around a mid price that moves one tick at a time. Bids
+// stay below the mid and asks above it; when the mid moves, levels it crosses are
+// deleted, a new best level appears behind it, and both sides are brought back
+// within the configured depth.
+class RandomWalkSimulator final : public MarketSimulator {
+public:
+    RandomWalkSimulator(const SimulatorOptions& options, uint64_t seed)
+        : options_(options), rng_(seed) {
+        mid_ticks_ = std::uniform_int_distribution<int64_t>(kMinInitialMidTicks, kMaxInitialMidTicks)(rng_);
+        for (size_t i = 1; i <= options_.depth; ++i) {
+            bids_.Apply(mid_ticks_ - static_cast<int64_t>(i), RandomQuantity());
+            asks_.Apply(mid_ticks_ + static_cast<int64_t>(i), RandomQuantity());
+        }
+    }
+
+    void Step(PriceEncoding encoding, OrderBookIncrementalUpdate* update) override {
+        encoding_ = encoding;
+        update_ = update;
+
+        double event = uniform_(rng_);
+        bool on_bids = uniform_(rng_) < 0.5;
+        if (event < kMidMoveProbability) {
+            if (uniform_(rng_) < 0.5) {
+                MoveMid(1, asks_, bids_);
+            } else {
+                MoveMid(-1, bids_, asks_);
+            }
+        } else if (on_bids) {
+            ChangeLevel(event, bids_);
+        } else {
+            ChangeLevel(event, asks_);
+        }
+        update_ = nullptr;
+    }
+
+    std::chrono::nanoseconds NextEventDelay() override {
+        if (!options_.poisson_arrivals) {
+            return FixedInterval(options_.events_per_second);
+        }
+        std::exponential_distribution<double> gap(options_.events_per_second);
+        return std::chrono::nanoseconds(static_cast<int64_t>(gap(rng_) * 1e9));
+    }
+
+    void FillSnapshot(PriceEncoding encoding, OrderBookSnapshot* snapshot) const override {
+        for (size_t i = 0; i < bids_.depth(); ++i) {
+            const BookLevel& level = bids_.level(i);
+            SetPriceLevel(snapshot->add_bids(), level.price_ticks * kSimulatedTickSize, level.quantity, encoding);
+        }
+        for (size_t i = 0; i < asks_.depth(); ++i) {
+            const BookLevel& level = asks_.level(i);
+            SetPriceLevel(snapshot->add_asks(), level.price_ticks * kSimulatedTickSize, level.quantity, encoding);
+        }
+    }
+
+private:
+    // Direction away from the mid: -1 for bids, +1 for asks
+    template <typename BookSideT>
+    static int64_t Outward(const BookSideT& side) { return side.is_bid() ? -1 : 1; }
+
+    double RandomQuantity() {
+        return std::uniform_int_distribution<int64_t>(1, kMaxLots)(rng_) * kSimulatedLotSize;
+    }
+
+    // Adds, deletes or modifies a level of one side, as drawn by event.
+    template <typename BookSideT>
+    void ChangeLevel(double event, BookSideT& side) {
+        if (event < kMidMoveProbability + kAddProbability) {
+            AddLevel(side);
+        } else if (event < kMidMoveProbability + kAddProbability + kDeleteProbability) {
+            Emit(side, side.level(PickLevel(side)).price_ticks, 0);
+            Refill(side);
+        } else {
+            Emit(side, side.level(PickLevel(side)).price_ticks, RandomQuantity());
+        }
+    }
+
+    template <typename BookSideT>
+    size_t PickLevel(const BookSideT& side) {
+        std::geometric_distribution<size_t> distance_from_top(kTopOfBookBias);
+        return std::min(distance_from_top(rng_), side.depth() - 1);
+    }
+
+    // Applies one level change to the book and records it in the update.
+    template <typename BookSideT>
+    void Emit(BookSideT& side, int64_t price_ticks, double quantity) {
+        side.Apply(price_ticks, quantity);
+        PriceLevel* level = side.is_bid() ? update_->add_bid_updates() : update_->add_ask_updates();
+        SetPriceLevel(level, price_ticks * kSimulatedTickSize, quantity, encoding_);
+    }
+
+    // toward is the side the mid moves into: asks for a move up, bids for a move down.
+    template <typename Toward, typename Away>
+    void MoveMid(int64_t direction, Toward& toward, Away& away) {
+        mid_ticks_ += direction;
+
+        // Levels the mid has moved onto are taken out
+        while (!toward.empty() && (toward.best().price_ticks - mid_ticks_) * Outward(toward) <= 0) {
+            Emit(toward, toward.best().price_ticks, 0);
+        }
+        // and the side it moved away from gets a new best level right behind it
+        Emit(away, mid_ticks_ + Outward(away), RandomQuantity());
+
+        Trim(away);
+        Refill(toward);
+    }
+
+    template <typename BookSideT>
+    void AddLevel(BookSideT& side) {
+        int64_t max_distance = kAddRangeFactor * static_cast<int64_t>(options_.depth);
+        int64_t distance = std::uniform_int_distribution<int64_t>(1, max_distance)(rng_);
+        Emit(side, mid_ticks_ + distance * Outward(side), RandomQuantity());
+        Trim(side);
+    }
+
+    // Deletes the worst levels beyond the configured depth.
+    template <typename BookSideT>
+    void Trim(BookSideT& side) {
+        while (side.depth() > options_.depth) {
+            Emit(side, side.level(side.depth() - 1).price_ticks, 0);
+        }
+    }
+
+    // Adds levels behind the worst one while the side is thinner than half the depth.
+    template <typename BookSideT>
+    void Refill(BookSideT& side) {
+        size_t min_depth = std::max<size_t>(1, options_.depth / 2);
+        while (side.depth() < min_depth) {
+            int64_t price_ticks = side.empty() ? mid_ticks_ + Outward(side)
+                                               : side.level(side.depth() - 1).price_ticks + Outward(side);
+            Emit(side, price_ticks, RandomQuantity());
+        }
+    }
+
+    SimulatorOptions options_;
+    std::mt19937_64 rng_;
+    std::uniform_real_distribution<double> uniform_{0.0, 1.0};
+    int64_t mid_ticks_;
+    BidSide bids_;
+    AskSide asks_;
+
+    // Target of the event being generated
+    PriceEncoding encoding_ = PriceEncoding::kDouble;
+    OrderBookIncrementalUpdate* update_ = nullptr;
+};
+
+// The original simulation: the same four snapshot levels for every instrument, and
+// updates alternating one bid and one ask around them.
+class ToggleSimulator final : public MarketSimulator {
+public:
+    explicit ToggleSimulator(const SimulatorOptions& options) : interval_(FixedInterval(options.events_per_second)) {}
+
+    void Step(PriceEncoding encoding, OrderBookIncrementalUpdate* update) override {
+        // Simulate a small price change
+        double price_change = (update_count_ % 2 == 0) ? 0.1 : -0.1;
+
+        SetPriceLevel(update->add_bid_updates(), 99.0 + price_change, 200 + update_count_ * 10, encoding);
+        SetPriceLevel(update->add_ask_updates(), 100.0 - price_change, 150 + update_count_ * 5, encoding);
+        update_count_++;
+    }
+
+    std::chrono::nanoseconds NextEventDelay() override { return interval_; }
+
+    void FillSnapshot(PriceEncoding encoding, OrderBookSnapshot* snapshot) const override {
+        // Add some dummy bid and ask levels for the snapshot
+        SetPriceLevel(snapshot->add_bids(), 99.5, 100, encoding);
+        SetPriceLevel(snapshot->add_bids(), 99.0, 200, encoding);
+        SetPriceLevel(snapshot->add_asks(), 100.0, 150, encoding);
+        SetPriceLevel(snapshot->add_asks(), 100.5, 250, encoding);
+    }
+
+private:
+    std::chrono::nanoseconds interval_;
+    int update_count_ = 0;
+};
+
+// Replays one instrument's recorded history from a capture file at its recorded pace,
+// scaled by the replay speed. The recorded levels are applied to a live book, so
+// updates are re-encoded for the engine's price encoding and snapshots, including
+// recovery snapshots, come from the replayed state. Snapshots found in the history
+// are published as the level changes that take the book to them. At the end of the
+// history the book returns to its opening state the same way and the replay starts over.
+class ReplaySimulator final : public MarketSimulator {
+public:
+    ReplaySimulator(const SimulatorOptions& options, uint64_t instrument_key, size_t first)
+        : capture_(options.capture), speed_(options.replay_speed), instrument_key_(instrument_key) {
+        // The snapshots leading the history make up the opening book
+        next_ = first;
+        while (next_ != capture_->end()) {
+            CaptureFile::Record record;
+            size_t after = capture_->Read(next_, &record);
+            if (!Decode(record) || !record_.has_snapshot()) {
+                break;
+            }
+            LoadSnapshot(record_.snapshot(), &bids_, &asks_);
+            next_ = capture_->Find(after, instrument_key_);
+        }
+        opening_bids_ = bids_;
+        opening_asks_ = asks_;
+        restart_ = next_;
+    }
+
+    // False if the history is nothing but snapshots, leaving no updates to replay
+    bool has_updates() const { return restart_ != capture_->end(); }
+
+    void Step(PriceEncoding encoding, OrderBookIncrementalUpdate* update) override {
+        encoding_ = encoding;
+        update_ = update;
+
+        if (next_ == capture_->end()) {
+            // End of the history: back to the opening book and over again
+            EmitDifference(bids_, opening_bids_);
+            EmitDifference(asks_, opening_asks_);
+            next_ = restart_;
+            timestamp_ns_.reset();
+        } else {
+            CaptureFile::Record record;
+            size_t after = capture_->Read(next_, &record);
+            if (Decode(record)) {
+                if (record_.has_snapshot()) {
+                    BidSide bids;
+                    AskSide asks;
+                    LoadSnapshot(record_.snapshot(), &bids, &asks);
+                    EmitDifference(bids_, bids);
+                    EmitDifference(asks_, asks);
+                } else if (record_.has_incremental_update()) {
+                    for (const PriceLevel& level : record_.incremental_update().bid_updates()) {
+                        Emit(bids_, ToTicks(level), ToQuantity(level));
+                    }
+                    for (const PriceLevel& level : record_.incremental_update().ask_updates()) {
+                        Emit(asks_, ToTicks(level), ToQuantity(level));
+                    }
+                    // Compact levels are always fixed point
+                    ForEachCompactLevel(record_.incremental_update(),
+                                        [this](bool is_bid, int64_t price_ticks, int64_t quantity_lots) {
+                                            int64_t ticks = std::llround(price_ticks * recorded_tick_size_ /
+                                                                         kSimulatedTickSize);
+                                            if (is_bid) {
+                                                Emit(bids_, ticks, quantity_lots * recorded_lot_size_);
+                                            } else {
+                                                Emit(asks_, ticks, quantity_lots * recorded_lot_size_);
+                                            }
+                                        });
+                }
+            }
+            timestamp_ns_ = record.timestamp_ns;
+            next_ = capture_->Find(after, instrument_key_);
+        }
+        update_ = nullptr;
+    }
+
+    std::chrono::nanoseconds NextEventDelay() override {
+        if (speed_ <= 0 || next_ == capture_->end() || !timestamp_ns_) {
+            return std::chrono::nanoseconds(0);
+        }
+        CaptureFile::Record record;
+        capture_->Read(next_, &record);
+        int64_t gap = std::max<int64_t>(0, record.timestamp_ns - *timestamp_ns_);
+        return std::chrono::nanoseconds(static_cast<int64_t>(gap / speed_));
+    }
+
+    void FillSnapshot(PriceEncoding encoding, OrderBookSnapshot* snapshot) const override {
+        for (size_t i = 0; i < bids_.depth(); ++i) {
+            const BookLevel& level = bids_.level(i);
+            SetPriceLevel(snapshot->add_bids(), level.price_ticks * kSimulatedTickSize, level.quantity, encoding);
+        }
+        for (size_t i = 0; i < asks_.depth(); ++i) {
+            const BookLevel& level = asks_.level(i);
+            SetPriceLevel(snapshot->add_asks(), level.price_ticks * kSimulatedTickSize, level.quantity, encoding);
+        }
+    }
+
+private:
+    bool Decode(const CaptureFile::Record& record) {
+        if (!record_.ParseFromArray(record.data, static_cast<int>(record.size))) {
+            Log(LogLevel::kError) << "Skipping corrupt capture record.";
+            return false;
+        }
+        return true;
+    }
+
+    // Replaces a book with a recorded snapshot, which also sets how the levels after
+    // it are encoded.
+    void LoadSnapshot(const OrderBookSnapshot& snapshot, BidSide* bids, AskSide* asks) {
+        recorded_fixed_point_ = snapshot.tick_size() > 0;
+        recorded_tick_size_ = snapshot.tick_size();
+        recorded_lot_size_ = snapshot.lot_size() > 0 ? snapshot.lot_size() : 1.0;
+        bids->Clear();
+        asks->Clear();
+        for (const PriceLevel& level : snapshot.bids()) {
+            bids->Apply(ToTicks(level), ToQuantity(level));
+        }
+        for (const PriceLevel& level : snapshot.asks()) {
+            asks->Apply(ToTicks(level), ToQuantity(level));
+        }
+    }
+
+    // Recorded levels are rescaled onto the simulated tick, which is what the engine
+    // announces in fixed-point snapshots.
+    int64_t ToTicks(const PriceLevel& level) const {
+        double price = recorded_fixed_point_ ? level.price_ticks() * recorded_tick_size_ : level.price();
+        return std::llround(price / kSimulatedTickSize);
+    }
+
+    double ToQuantity(const PriceLevel& level) const {
+        return recorded_fixed_point_ ? level.quantity_lots() * recorded_lot_size_ : level.quantity();
+    }
+
+    template <typename BookSideT>
+    static double QuantityAt(const BookSideT& side, int64_t price_ticks) {
+        for (size_t i = 0; i < side.depth(); ++i) {
+            if (side.level(i).price_ticks == price_ticks) {
+                return side.level(i).quantity;
+            }
+        }
+        return 0;
+    }
+
+    // Emits the level changes that turn side into target.
+    template <typename BookSideT>
+    void EmitDifference(BookSideT& side, const BookSideT& target) {
+        std::vector<int64_t> removed;
+        for (size_t i = 0; i < side.depth(); ++i) {
+            if (QuantityAt(target, side.level(i).price_ticks) <= 0) {
+                removed.push_back(side.level(i).price_ticks);
+            }
+        }
+        for (int64_t price_ticks : removed) {
+            Emit(side, price_ticks, 0);
+        }
+        for (size_t i = 0; i < target.depth(); ++i) {
+            const BookLevel& level = target.level(i);
+            if (QuantityAt(side, level.price_ticks) != level.quantity) {
+                Emit(side, level.price_ticks, level.quantity);
+            }
+        }
+    }
+
+    // Applies one level change to the book and records it in the update.
+    template <typename BookSideT>
+    void Emit(BookSideT& side, int64_t price_ticks, double quantity) {
+        side.Apply(price_ticks, quantity);
+        PriceLevel* level = side.is_bid() ? update_->add_bid_updates() : update_->add_ask_updates();
+        SetPriceLevel(level, price_ticks * kSimulatedTickSize, quantity, encoding_);
+    }
+
+    std::shared_ptr<const CaptureFile> capture_;
+    double speed_;
+    uint64_t instrument_key_;
+
+    // Offset of the next record to replay, and where the replay starts over
+    size_t next_;
+    size_t restart_;
+    // Recording time of the record just replayed; unset right after starting over
+    std::optional<int64_t> timestamp_ns_;
+    MarketDataUpdate record_;
+
+    bool recorded_fixed_point_ = false;
+    double recorded_tick_size_ = 0;
+    double recorded_lot_size_ = 1.0;
+
+    BidSide bids_;
+    AskSide asks_;
+    BidSide opening_bids_;
+    AskSide opening_asks_;
+
+    // Target of the event being generated
+    PriceEncoding encoding_ = PriceEncoding::kDouble;
+    OrderBookIncrementalUpdate* update_ = nullptr;
+};
+
+} // namespace
+
+void SetPriceLevel(PriceLevel* level, double price, double quantity, PriceEncoding encoding) {
+    if (encoding != PriceEncoding::kDouble) {
+        level->set_price_ticks(std::llround(price / kSimulatedTickSize));
+        level->set_quantity_lots(std::llround(quantity / kSimulatedLotSize));
+    } else {
+        level->set_price(price);
+        level->set_quantity(quantity);
+    }
+}
+
+std::unique_ptr<MarketSimulator> CreateSimulator(const SimulatorOptions& options, const std::string& instrument_id) {
+    if (options.model == SimulatorOptions::Model::kToggle) {
+        return std::make_unique<ToggleSimulator>(options);
+    }
+    if (options.model == SimulatorOptions::Model::kReplay) {
+        uint64_t key = CaptureInstrumentKey(instrument_id);
+        size_t first = options.capture->Find(options.capture->begin(), key);
+        if (first == options.capture->end()) {
+            Log(LogLevel::kError) << "Instrument " << instrument_id << " is not in the capture; simulating it instead.";
+        } else {
+            auto replay = std::make_unique<ReplaySimulator>(options, key, first);
+            if (replay->has_updates()) {
+                return replay;
+            }
+            // Replaying it would publish nothing but empty updates, back to back
+            Log(LogLevel::kError) << "Instrument " << instrument_id
+                                  << " has only snapshots in the capture; simulating it instead.";
+        }
+    }
+    return std::make_unique<RandomWalkSimulator>(options, options.seed ^ HashId(instrument_id));
+}
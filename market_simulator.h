@@ -0,0 +1,70 @@
+#ifndef MARKET_SIMULATOR_H
+#define MARKET_SIMULATOR_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "market_data.pb.h"
+
+class CaptureFile;
+
+// How prices and quantities are encoded in published price levels.
+enum class PriceEncoding {
+    kDouble,      // PriceLevel.price / quantity
+    kFixedPoint,  // PriceLevel.price_ticks / quantity_lots, scale sent in the snapshot
+    kCompact,     // Fixed point, with incremental updates in the packed form of compact_levels.h
+};
+
+// Scale of the simulated instruments in fixed-point mode
+constexpr double kSimulatedTickSize = 0.01;
+constexpr double kSimulatedLotSize = 1.0;
+
+// Fills a price level in the given encoding.
+void SetPriceLevel(marketdata::PriceLevel* level, double price, double quantity, PriceEncoding encoding);
+
+struct SimulatorOptions {
+    enum class Model {
+        kRandomWalk,  // Live book with add/modify/delete events around a random-walk mid
+        kToggle,      // The original fixed +/-0.1 toggle against a static snapshot
+        kReplay,      // Recorded updates from a capture file
+    };
+    Model model = Model::kRandomWalk;
+    // Price levels kept on each side of the book
+    size_t depth = 10;
+    // Mean events per second for each instrument
+    double events_per_second = 1.0;
+    // Exponentially distributed gaps between events (Poisson arrivals) rather than a
+    // fixed interval
+    bool poisson_arrivals = true;
+    // Each instrument's generator is seeded from this and its id, so a run with the
+    // same seed and subscriptions produces the same market
+    uint64_t seed = 1;
+    // Recording replayed by kReplay. Instruments missing from it, or with nothing but
+    // snapshots in it, fall back to kRandomWalk.
+    std::shared_ptr<const CaptureFile> capture;
+    // Replay speed as a multiple of the recorded pace; 0 replays as fast as possible
+    double replay_speed = 1.0;
+};
+
+// The simulated market of one instrument. Each instrument has its own instance, only
+// used from the owning worker thread, so implementations need no locking of their own.
+class MarketSimulator {
+public:
+    virtual ~MarketSimulator() = default;
+
+    // Applies the next event to the book and adds the levels it changed to update; a
+    // quantity of 0 deletes a level.
+    virtual void Step(PriceEncoding encoding, marketdata::OrderBookIncrementalUpdate* update) = 0;
+
+    // Time from the event just generated to the next one.
+    virtual std::chrono::nanoseconds NextEventDelay() = 0;
+
+    // Adds the current book to snapshot, best levels first.
+    virtual void FillSnapshot(PriceEncoding encoding, marketdata::OrderBookSnapshot* snapshot) const = 0;
+};
+
+std::unique_ptr<MarketSimulator> CreateSimulator(const SimulatorOptions& options, const std::string& instrument_id);
+
+#endif // MARKET_SIMULATOR_H
@@ -0,0 +1,151 @@
+#ifndef MPSC_QUEUE_H
+#define MPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+
+// Unbounded lock-free multi-producer single-consumer queue (Vyukov's intrusive
+// design). Push may be called from any thread; Pop must only be called from a
+// single consumer thread. Pop can briefly report empty while a concurrent Push is
+// halfway through linking its node, so consumers should track the element count
+// separately if they need an exact answer.
+//
+// Nodes are recycled: the consumer hands every node it has moved past back to a free
+// list that producers take from, so Push only allocates when the queue holds more
+// than it ever has before, and then a whole chunk of nodes at once.
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue() : head_(&stub_), tail_(&stub_) {
+        for (auto& chunk : chunks_) {
+            chunk.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~MpscQueue() {
+        T value;
+        while (Pop(&value)) {
+        }
+        for (auto& chunk : chunks_) {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    void Push(T value) {
+        Node* node = TakeFree();
+        if (node == nullptr) {
+            node = Grow();
+        }
+        node->value = std::move(value);
+        node->next.store(nullptr, std::memory_order_relaxed);
+        Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    bool Pop(T* out) {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return false;
+        }
+        // The popped node becomes the new stub; its value is moved out and the old stub
+        // goes back on the free list.
+        *out = std::move(next->value);
+        next->value = T();
+        tail_ = next;
+        if (tail != &stub_) {
+            Free(tail, tail);
+        }
+        return true;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        T value{};
+        // Position of the node in the chunks
+        uint32_t index = 0;
+        // While on the free list, the position + 1 of the node below it, 0 for none
+        std::atomic<uint32_t> free_next{0};
+    };
+
+    // Chunk k holds kFirstChunk << k nodes, so a few chunks cover any queue length
+    static constexpr size_t kFirstChunk = 16;
+    static constexpr size_t kMaxChunks = 27;
+
+    static uint32_t FirstIndex(size_t chunk) { return static_cast<uint32_t>(kFirstChunk * ((size_t{1} << chunk) - 1)); }
+
+    Node* NodeAt(uint32_t index) const {
+        size_t chunk = 63 - __builtin_clzll(index / kFirstChunk + 1);
+        return chunks_[chunk].load(std::memory_order_acquire) + (index - FirstIndex(chunk));
+    }
+
+    // The free list head packs the top node's position + 1 with a count of changes to
+    // the list, so a producer that read the head before someone else took and returned
+    // its top node fails its exchange instead of linking in a node that is in use.
+    static uint64_t FreeHead(uint64_t old_head, uint32_t top) { return (((old_head >> 32) + 1) << 32) | top; }
+
+    Node* TakeFree() {
+        uint64_t head = free_.load(std::memory_order_acquire);
+        while (static_cast<uint32_t>(head) != 0) {
+            Node* node = NodeAt(static_cast<uint32_t>(head) - 1);
+            uint64_t next = FreeHead(head, node->free_next.load(std::memory_order_relaxed));
+            if (free_.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire)) {
+                return node;
+            }
+        }
+        return nullptr;
+    }
+
+    // Puts the nodes from first to last, already linked through free_next, on the free list
+    void Free(Node* first, Node* last) {
+        uint64_t head = free_.load(std::memory_order_relaxed);
+        uint64_t next;
+        do {
+            last->free_next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+            next = FreeHead(head, first->index + 1);
+        } while (!free_.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // Adds a chunk, keeping its first node for the caller and freeing the rest
+    Node* Grow() {
+        std::lock_guard<std::mutex> lock(grow_mutex_);
+        // Another producer may have grown the queue while this one waited
+        if (Node* node = TakeFree()) {
+            return node;
+        }
+        if (num_chunks_ == kMaxChunks) {
+            throw std::bad_alloc();
+        }
+        size_t size = kFirstChunk << num_chunks_;
+        uint32_t first = FirstIndex(num_chunks_);
+        Node* chunk = new Node[size];
+        for (size_t i = 0; i < size; ++i) {
+            chunk[i].index = first + static_cast<uint32_t>(i);
+            chunk[i].free_next.store(first + static_cast<uint32_t>(i) + 2, std::memory_order_relaxed);
+        }
+        chunks_[num_chunks_].store(chunk, std::memory_order_release);
+        ++num_chunks_;
+        Free(&chunk[1], &chunk[size - 1]);
+        return &chunk[0];
+    }
+
+    Node stub_;
+    std::atomic<Node*> head_;
+    Node* tail_;
+
+    std::atomic<uint64_t> free_{0};
+    std::atomic<Node*> chunks_[kMaxChunks];
+    // Guards growing; num_chunks_ is only touched with it held
+    std::mutex grow_mutex_;
+    size_t num_chunks_ = 0;
+};
+
+#endif // MPSC_QUEUE_H
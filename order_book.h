@@ -0,0 +1,246 @@
+#ifndef ORDER_BOOK_H
+#define ORDER_BOOK_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include "compact_levels.h"
+#include "market_data.pb.h"
+
+// A price level with the price expressed as an integer number of ticks.
+struct BookLevel {
+    int64_t price_ticks;
+    double quantity;
+};
+
+enum class Side {
+    kBid,
+    kAsk,
+};
+
+// True if price a is strictly worse than price b on side S, i.e. a is stored before b.
+template <Side S>
+constexpr bool Worse(int64_t a, int64_t b) {
+    return S == Side::kBid ? a < b : a > b;
+}
+
+// One side of an order book. Its direction is fixed at compile time, so comparisons
+// compile to a single instruction with no branch on the side.
+//
+// With MaxDepth == 0 (the specialization below), the side is unbounded: a sorted
+// contiguous vector with the best price at the back. Almost all activity happens at
+// or near the top of the book, so keeping it at the end of the vector makes inserts
+// and deletes there cheap and the best level an O(1) read.
+//
+// With MaxDepth > 0, the side keeps only its best MaxDepth levels in inline arrays,
+// for books fed by a depth-limited subscription: a level pushed past MaxDepth is
+// dropped. Prices and quantities are held apart, and unused slots hold a price better
+// than any real one, so the position of a price is a fixed-length count of the worse
+// prices before it. That count has no data-dependent branches and is vectorized by
+// the compiler.
+template <Side S, size_t MaxDepth = 0>
+class BookSide {
+public:
+    static_assert(MaxDepth <= 64, "bounded sides are searched linearly; use an unbounded side for deep books");
+
+    BookSide() { std::fill(std::begin(prices_), std::end(prices_), kUnused); }
+
+    // Sets the quantity at a price; a quantity of 0 or less deletes the level.
+    void Apply(int64_t price_ticks, double quantity) {
+        size_t index = 0;
+        for (size_t i = 0; i < MaxDepth; ++i) {
+            index += Worse<S>(prices_[i], price_ticks) ? 1 : 0;
+        }
+        bool found = index < depth_ && prices_[index] == price_ticks;
+        if (quantity > 0) {
+            if (found) {
+                quantities_[index] = quantity;
+                return;
+            }
+            if (depth_ < MaxDepth) {
+                std::copy_backward(prices_ + index, prices_ + depth_, prices_ + depth_ + 1);
+                std::copy_backward(quantities_ + index, quantities_ + depth_, quantities_ + depth_ + 1);
+                ++depth_;
+            } else if (index == 0) {
+                // Worse than every level kept
+                return;
+            } else {
+                // Full: the worst level makes room
+                --index;
+                std::copy(prices_ + 1, prices_ + index + 1, prices_);
+                std::copy(quantities_ + 1, quantities_ + index + 1, quantities_);
+            }
+            prices_[index] = price_ticks;
+            quantities_[index] = quantity;
+        } else if (found) {
+            std::copy(prices_ + index + 1, prices_ + depth_, prices_ + index);
+            std::copy(quantities_ + index + 1, quantities_ + depth_, quantities_ + index);
+            --depth_;
+            prices_[depth_] = kUnused;
+        }
+    }
+
+    void Clear() {
+        std::fill(prices_, prices_ + depth_, kUnused);
+        depth_ = 0;
+    }
+
+    bool empty() const { return depth_ == 0; }
+    size_t depth() const { return depth_; }
+
+    // The i-th best level, 0 being the best. i must be less than depth().
+    BookLevel level(size_t i) const { return BookLevel{prices_[depth_ - 1 - i], quantities_[depth_ - 1 - i]}; }
+    BookLevel best() const { return level(0); }
+
+    static constexpr bool is_bid() { return S == Side::kBid; }
+
+private:
+    // Better than any price, so unused slots never count as worse
+    static constexpr int64_t kUnused =
+        S == Side::kBid ? std::numeric_limits<int64_t>::max() : std::numeric_limits<int64_t>::min();
+
+    int64_t prices_[MaxDepth];
+    double quantities_[MaxDepth] = {};
+    size_t depth_ = 0;
+};
+
+template <Side S>
+class BookSide<S, 0> {
+public:
+    // Sets the quantity at a price; a quantity of 0 or less deletes the level.
+    void Apply(int64_t price_ticks, double quantity) {
+        auto it = Find(price_ticks);
+        bool found = it != levels_.end() && it->price_ticks == price_ticks;
+        if (quantity > 0) {
+            if (found) {
+                it->quantity = quantity;
+            } else {
+                levels_.insert(it, BookLevel{price_ticks, quantity});
+            }
+        } else if (found) {
+            levels_.erase(it);
+        }
+    }
+
+    void Clear() { levels_.clear(); }
+
+    bool empty() const { return levels_.empty(); }
+    size_t depth() const { return levels_.size(); }
+
+    // The i-th best level, 0 being the best. i must be less than depth().
+    const BookLevel& level(size_t i) const { return levels_[levels_.size() - 1 - i]; }
+    const BookLevel& best() const { return levels_.back(); }
+
+    static constexpr bool is_bid() { return S == Side::kBid; }
+
+private:
+    // First stored level that is not worse than price_ticks.
+    typename std::vector<BookLevel>::iterator Find(int64_t price_ticks) {
+        // Fast path for updates at or beyond the current best price
+        if (levels_.empty() || Worse<S>(levels_.back().price_ticks, price_ticks)) {
+            return levels_.end();
+        }
+        if (levels_.back().price_ticks == price_ticks) {
+            return levels_.end() - 1;
+        }
+        return std::lower_bound(levels_.begin(), levels_.end(), price_ticks,
+                                [](const BookLevel& level, int64_t price) { return Worse<S>(level.price_ticks, price); });
+    }
+
+    std::vector<BookLevel> levels_;
+};
+
+using BidSide = BookSide<Side::kBid>;
+using AskSide = BookSide<Side::kAsk>;
+
+// Client-side order book for one instrument. Levels are keyed by integer ticks so
+// they compare exactly. Fixed-point feeds (a snapshot carrying tick_size) are applied
+// as-is; double prices are converted to ticks on the way in, so 99.0 + 0.1 and a
+// level published as 99.1 land on the same tick. MaxDepth bounds each side as
+// described for BookSide; OrderBook is the unbounded book.
+template <size_t MaxDepth = 0>
+class BasicOrderBook {
+public:
+    using Bids = BookSide<Side::kBid, MaxDepth>;
+    using Asks = BookSide<Side::kAsk, MaxDepth>;
+
+    explicit BasicOrderBook(double tick_size = 0.01) : tick_size_(tick_size), default_tick_size_(tick_size) {}
+
+    void Clear() {
+        bids_.Clear();
+        asks_.Clear();
+    }
+
+    // Replaces the book with the contents of a snapshot, which also sets the encoding
+    // of the levels that follow.
+    void ApplySnapshot(const marketdata::OrderBookSnapshot& snapshot) {
+        Clear();
+        fixed_point_ = snapshot.tick_size() > 0;
+        tick_size_ = fixed_point_ ? snapshot.tick_size() : default_tick_size_;
+        lot_size_ = snapshot.lot_size() > 0 ? snapshot.lot_size() : 1.0;
+        for (const auto& bid : snapshot.bids()) {
+            Apply(bids_, bid);
+        }
+        for (const auto& ask : snapshot.asks()) {
+            Apply(asks_, ask);
+        }
+    }
+
+    // Applies level updates: quantity > 0 is an add/modify, quantity == 0 a deletion.
+    void ApplyIncremental(const marketdata::OrderBookIncrementalUpdate& update) {
+        if (HasCompactLevels(update)) {
+            // Always fixed point; the levels go into the book as they are decoded
+            ForEachCompactLevel(update, [this](bool is_bid, int64_t price_ticks, int64_t quantity_lots) {
+                if (is_bid) {
+                    bids_.Apply(price_ticks, quantity_lots * lot_size_);
+                } else {
+                    asks_.Apply(price_ticks, quantity_lots * lot_size_);
+                }
+            });
+            return;
+        }
+        for (const auto& bid_update : update.bid_updates()) {
+            Apply(bids_, bid_update);
+        }
+        for (const auto& ask_update : update.ask_updates()) {
+            Apply(asks_, ask_update);
+        }
+    }
+
+    int64_t ToTicks(double price) const { return std::llround(price / tick_size_); }
+    double ToPrice(int64_t price_ticks) const { return price_ticks * tick_size_; }
+
+    const Bids& bids() const { return bids_; }
+    const Asks& asks() const { return asks_; }
+    Bids& bids() { return bids_; }
+    Asks& asks() { return asks_; }
+
+    double tick_size() const { return tick_size_; }
+    bool fixed_point() const { return fixed_point_; }
+
+private:
+    template <typename BookSideT>
+    void Apply(BookSideT& side, const marketdata::PriceLevel& level) {
+        if (fixed_point_) {
+            side.Apply(level.price_ticks(), level.quantity_lots() * lot_size_);
+        } else {
+            side.Apply(ToTicks(level.price()), level.quantity());
+        }
+    }
+
+    double tick_size_;
+    // Tick used to key double-priced feeds
+    double default_tick_size_;
+    double lot_size_ = 1.0;
+    bool fixed_point_ = false;
+    Bids bids_;
+    Asks asks_;
+};
+
+using OrderBook = BasicOrderBook<>;
+
+#endif // ORDER_BOOK_H
@@ -0,0 +1,220 @@
+#include "outbound_queue.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "compact_levels.h"
+
+using marketdata::MarketDataUpdate;
+using marketdata::OrderBookIncrementalUpdate;
+using marketdata::PriceLevel;
+
+bool OutboundQueue::Push(OutboundItem item) {
+    queue_.Push(std::move(item));
+    size_t pending = pending_.fetch_add(1);
+    size_t max_pending = max_pending_.load(std::memory_order_relaxed);
+    while (pending + 1 > max_pending &&
+           !max_pending_.compare_exchange_weak(max_pending, pending + 1, std::memory_order_relaxed)) {
+    }
+    return pending == 0;
+}
+
+void OutboundQueue::PopOne(OutboundItem* item) {
+    while (!queue_.Pop(item)) {
+        // A producer has claimed its slot but not linked the node yet
+        std::this_thread::yield();
+    }
+    pending_.fetch_sub(1);
+}
+
+std::shared_ptr<const EncodedUpdate> OutboundQueue::Next(Clock::time_point now, Clock::time_point* wake_at) {
+    if (batching_.window.count() == 0) {
+        return NextUpdate(now, wake_at);
+    }
+
+    *wake_at = Clock::time_point::max();
+    while (batch_.size() < batching_.max_updates) {
+        std::shared_ptr<const EncodedUpdate> update = NextUpdate(now, wake_at);
+        if (!update) {
+            break;
+        }
+        if (batch_.empty()) {
+            batch_deadline_ = now + batching_.window;
+        }
+        batch_.push_back(std::move(update));
+    }
+    if (batch_.empty()) {
+        return nullptr;
+    }
+    if (batch_.size() >= batching_.max_updates || now >= batch_deadline_) {
+        return TakeBatch();
+    }
+    *wake_at = std::min(*wake_at, batch_deadline_);
+    return nullptr;
+}
+
+std::shared_ptr<const EncodedUpdate> OutboundQueue::TakeBatch() {
+    std::shared_ptr<const EncodedUpdate> result;
+    if (batch_.size() == 1) {
+        // Nothing joined it; send the shared update as it is rather than wrapping it
+        result = std::move(batch_.front());
+    } else {
+        result = EncodeBatch(batch_);
+    }
+    batch_.clear();
+    return result;
+}
+
+std::shared_ptr<const EncodedUpdate> OutboundQueue::NextUpdate(Clock::time_point now, Clock::time_point* wake_at) {
+    *wake_at = Clock::time_point::max();
+
+    // Held-back subscriptions that have become due go first
+    for (size_t i = 0; i < deferred_.size();) {
+        Clock::time_point not_before;
+        std::shared_ptr<const EncodedUpdate> update = deferred_[i]->Take(now, &not_before);
+        if (update || not_before == Clock::time_point::max()) {
+            // Sent, or deactivated with nothing left to send
+            deferred_.erase(deferred_.begin() + i);
+            if (update) {
+                return update;
+            }
+            continue;
+        }
+        *wake_at = std::min(*wake_at, not_before);
+        ++i;
+    }
+
+    OutboundItem item;
+    while (pending_.load() > 0) {
+        PopOne(&item);
+        if (item.update) {
+            return std::move(item.update);
+        }
+        Clock::time_point not_before;
+        std::shared_ptr<const EncodedUpdate> update = item.conflated->Take(now, &not_before);
+        if (update) {
+            return update;
+        }
+        if (not_before != Clock::time_point::max()) {
+            *wake_at = std::min(*wake_at, not_before);
+            deferred_.push_back(std::move(item.conflated));
+        }
+    }
+    return nullptr;
+}
+
+size_t OutboundQueue::Clear() {
+    size_t dropped = deferred_.size() + batch_.size();
+    OutboundItem item;
+    while (pending_.load() > 0) {
+        PopOne(&item);
+        ++dropped;
+    }
+    deferred_.clear();
+    batch_.clear();
+    return dropped;
+}
+
+ConflatedSubscription::ConflatedSubscription(const std::shared_ptr<OutboundStream>& stream,
+                                             uint32_t max_updates_per_second)
+    : stream_(stream), metrics_(stream->shared_metrics()) {
+    if (max_updates_per_second > 0) {
+        min_interval_ = std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(1)) / max_updates_per_second;
+    }
+}
+
+bool ConflatedSubscription::Publish(std::shared_ptr<const EncodedUpdate> update) {
+    if (!update->message().has_incremental_update()) {
+        return false;
+    }
+    const OrderBookIncrementalUpdate& incremental_update = update->message().incremental_update();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!active_) {
+            return false;
+        }
+        instrument_id_ = incremental_update.instrument_id();
+        instrument_handle_ = incremental_update.instrument_handle();
+        if (bid_updates_.empty() && ask_updates_.empty()) {
+            first_sequence_ = incremental_update.first_sequence() != 0 ? incremental_update.first_sequence()
+                                                                       : incremental_update.sequence();
+            first_publish_timestamp_ns_ = incremental_update.publish_timestamp_ns();
+        }
+        last_sequence_ = incremental_update.sequence();
+        for (const auto& level : incremental_update.bid_updates()) {
+            bid_updates_[LevelKey(level.price_ticks(), level.price())] = level;
+        }
+        for (const auto& level : incremental_update.ask_updates()) {
+            ask_updates_[LevelKey(level.price_ticks(), level.price())] = level;
+        }
+        compact_ = HasCompactLevels(incremental_update);
+        ForEachCompactLevel(incremental_update, [this](bool is_bid, int64_t price_ticks, int64_t quantity_lots) {
+            PriceLevel& level = (is_bid ? bid_updates_ : ask_updates_)[LevelKey(price_ticks, 0.0)];
+            level.set_price_ticks(price_ticks);
+            level.set_quantity_lots(quantity_lots);
+        });
+        if (queued_) {
+            // The writer already has an entry for us and will pick up the merged levels
+            AddToSharedCounter(metrics_->updates_conflated, 1);
+            return true;
+        }
+        queued_ = true;
+    }
+
+    std::shared_ptr<OutboundStream> stream = stream_.lock();
+    if (!stream) {
+        return false;
+    }
+    // The queue entry only refers to this subscription; the levels stay here until taken.
+    if (!stream->Enqueue(OutboundItem{nullptr, shared_from_this()})) {
+        AddToSharedCounter(metrics_->updates_dropped, 1);
+        return false;
+    }
+    return true;
+}
+
+void ConflatedSubscription::Deactivate() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    active_ = false;
+    bid_updates_.clear();
+    ask_updates_.clear();
+}
+
+std::shared_ptr<const EncodedUpdate> ConflatedSubscription::Take(Clock::time_point now, Clock::time_point* not_before) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    *not_before = Clock::time_point::max();
+    if (!active_ || (bid_updates_.empty() && ask_updates_.empty())) {
+        queued_ = false;
+        return nullptr;
+    }
+    if (now < next_send_) {
+        // Stay queued so producers keep merging into the held-back delta
+        *not_before = next_send_;
+        return nullptr;
+    }
+
+    MarketDataUpdate update;
+    OrderBookIncrementalUpdate* incremental_update = update.mutable_incremental_update();
+    incremental_update->set_instrument_id(instrument_id_);
+    incremental_update->set_instrument_handle(instrument_handle_);
+    incremental_update->set_sequence(last_sequence_);
+    if (first_sequence_ != last_sequence_) {
+        incremental_update->set_first_sequence(first_sequence_);
+    }
+    incremental_update->set_publish_timestamp_ns(first_publish_timestamp_ns_);
+    for (const auto& level : bid_updates_) {
+        *incremental_update->add_bid_updates() = level.second;
+    }
+    for (const auto& level : ask_updates_) {
+        *incremental_update->add_ask_updates() = level.second;
+    }
+    bid_updates_.clear();
+    ask_updates_.clear();
+    if (compact_) {
+        CompactLevels(incremental_update);
+    }
+    queued_ = false;
+    next_send_ = now + min_interval_;
+    // Merged per stream, so this is the one update that is encoded for a single stream
+    return std::make_shared<EncodedUpdate>(std::move(update));
+}
@@ -0,0 +1,159 @@
+#ifndef OUTBOUND_QUEUE_H
+#define OUTBOUND_QUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "encoded_update.h"
+#include "market_data.pb.h"
+#include "mpsc_queue.h"
+#include "publisher_engine.h"
+#include "server_metrics.h"
+
+class ConflatedSubscription;
+
+// Grouping of consecutive updates on a stream into MarketDataBatch messages, trading
+// a bounded delay for fewer writes, frames and client reads.
+struct BatchOptions {
+    // How long the first update of a batch may wait for others to join it; 0 disables batching
+    std::chrono::microseconds window{0};
+    // A batch is sent as soon as it holds this many updates
+    size_t max_updates = 64;
+    // Let gRPC hold a write while more are queued behind it, and flush them together
+    bool buffer_hints = true;
+};
+
+// An entry on a stream's outbound queue: either an update ready to be written, or a
+// conflated subscription whose merged update is built when the writer reaches it.
+struct OutboundItem {
+    std::shared_ptr<const EncodedUpdate> update;
+    std::shared_ptr<ConflatedSubscription> conflated;
+};
+
+// Updates waiting to be written to one stream. Push is lock-free and may be called
+// from any thread; everything else belongs to the stream's single writer.
+class OutboundQueue {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit OutboundQueue(BatchOptions batching = BatchOptions()) : batching_(batching) {}
+
+    // Returns true if the queue was empty, i.e. the writer may need waking.
+    bool Push(OutboundItem item);
+
+    bool HasPending() const { return pending_.load() > 0; }
+
+    // Entries queued now, and the most there have been at once. Safe from any thread.
+    size_t size() const { return pending_.load(std::memory_order_relaxed); }
+    size_t max_size() const { return max_pending_.load(std::memory_order_relaxed); }
+
+    const BatchOptions& batching() const { return batching_; }
+
+    // Returns the next update ready to be written, or nullptr if there is none. Rate
+    // limited subscriptions that are not due yet are held back, and *wake_at is set to
+    // the earliest time one of them becomes due (Clock::time_point::max() if none).
+    // With batching, ready updates are collected until the batch is full or its window
+    // has elapsed, and *wake_at also covers the end of the window.
+    std::shared_ptr<const EncodedUpdate> Next(Clock::time_point now, Clock::time_point* wake_at);
+
+    // Drops everything queued or held back, returning the number of entries dropped.
+    size_t Clear();
+
+private:
+    void PopOne(OutboundItem* item);
+    std::shared_ptr<const EncodedUpdate> NextUpdate(Clock::time_point now, Clock::time_point* wake_at);
+    std::shared_ptr<const EncodedUpdate> TakeBatch();
+
+    MpscQueue<OutboundItem> queue_;
+    std::atomic<size_t> pending_{0};
+    std::atomic<size_t> max_pending_{0};
+
+    // Conflated subscriptions popped before their rate limit allowed another send
+    std::vector<std::shared_ptr<ConflatedSubscription>> deferred_;
+
+    BatchOptions batching_;
+    // Updates collected for the next batch, and when it has to go out
+    std::vector<std::shared_ptr<const EncodedUpdate>> batch_;
+    Clock::time_point batch_deadline_;
+};
+
+// A subscriber that owns an outbound queue. The transport-specific writers implement
+// Enqueue and wake themselves up as needed, and keep the stream's metrics.
+class OutboundStream : public Subscriber {
+public:
+    bool Publish(std::shared_ptr<const EncodedUpdate> update) override {
+        if (Enqueue(OutboundItem{std::move(update), nullptr})) {
+            return true;
+        }
+        AddToSharedCounter(metrics_->updates_dropped, 1);
+        return false;
+    }
+
+    virtual bool Enqueue(OutboundItem item) = 0;
+
+    virtual const OutboundQueue& queue() const = 0;
+
+    StreamMetrics& metrics() { return *metrics_; }
+    const std::shared_ptr<StreamMetrics>& shared_metrics() const { return metrics_; }
+
+private:
+    // Shared so the counters outlive the stream until they have been reported
+    std::shared_ptr<StreamMetrics> metrics_ = std::make_shared<StreamMetrics>();
+};
+
+// Engine-facing subscriber for one instrument of one stream in conflation mode.
+// Incremental updates are merged per (side, price), keeping only the latest
+// quantity, until the stream's writer gets to them, so a slow consumer costs at most
+// one merged book delta per instrument instead of an ever-growing backlog. With a
+// rate limit the merged delta is also held back until the minimum interval between
+// sends has elapsed.
+class ConflatedSubscription final : public Subscriber,
+                                    public std::enable_shared_from_this<ConflatedSubscription> {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // max_updates_per_second == 0 only conflates, without limiting the send rate.
+    ConflatedSubscription(const std::shared_ptr<OutboundStream>& stream, uint32_t max_updates_per_second);
+
+    bool Publish(std::shared_ptr<const EncodedUpdate> update) override;
+
+    // Stops accepting updates and discards anything pending, e.g. on unsubscribe.
+    void Deactivate();
+
+    // Writer side. Returns the merged update, or nullptr if nothing is pending. If the
+    // rate limit does not allow a send yet, returns nullptr and sets *not_before.
+    std::shared_ptr<const EncodedUpdate> Take(Clock::time_point now, Clock::time_point* not_before);
+
+private:
+    std::weak_ptr<OutboundStream> stream_;
+    std::shared_ptr<StreamMetrics> metrics_;
+    Clock::duration min_interval_{0};
+
+    std::mutex mutex_;
+    bool active_ = true;
+    // True while a queue entry for this subscription is outstanding
+    bool queued_ = false;
+    Clock::time_point next_send_;
+    std::string instrument_id_;
+    uint32_t instrument_handle_ = 0;
+    // Sequence range of the updates merged so far, and when the first one was generated
+    uint64_t first_sequence_ = 0;
+    uint64_t last_sequence_ = 0;
+    uint64_t first_publish_timestamp_ns_ = 0;
+    // Latest level per price, keyed by (price_ticks, price) so both the double and the
+    // fixed-point encodings merge correctly
+    using LevelKey = std::pair<int64_t, double>;
+    std::map<LevelKey, marketdata::PriceLevel> bid_updates_;
+    std::map<LevelKey, marketdata::PriceLevel> ask_updates_;
+    // Whether the merged update goes out in the compact form the updates came in
+    bool compact_ = false;
+};
+
+#endif // OUTBOUND_QUEUE_H
@@ -0,0 +1,119 @@
+#include "pacing.h"
+
+#include <fstream>
+#include <sstream>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Tells the CPU this is a spin-wait loop, easing pressure on a sibling hyperthread
+inline void CpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#endif
+}
+
+} // namespace
+
+RateProfile::RateProfile(std::vector<Segment> segments) : segments_(std::move(segments)) {
+    for (const auto& segment : segments_) {
+        period_ += segment.duration;
+    }
+}
+
+RateProfile RateProfile::Bursty(std::chrono::milliseconds period, double burst_fraction, double burst_multiplier) {
+    auto burst = std::chrono::duration_cast<std::chrono::nanoseconds>(period * burst_fraction);
+    return RateProfile({{burst, burst_multiplier}, {period - burst, 1.0}});
+}
+
+bool RateProfile::Load(const std::string& path, RateProfile* profile, std::string* error) {
+    std::ifstream in(path);
+    if (!in) {
+        *error = "cannot open " + path;
+        return false;
+    }
+    std::vector<Segment> segments;
+    bool any_positive = false;
+    std::string line;
+    for (int line_number = 1; std::getline(in, line); ++line_number) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        double duration_ms;
+        double multiplier;
+        if (!(fields >> duration_ms >> multiplier) || duration_ms <= 0 || multiplier < 0) {
+            *error = path + ":" + std::to_string(line_number) + ": expected <duration_ms> <multiplier>";
+            return false;
+        }
+        segments.push_back({std::chrono::nanoseconds(static_cast<int64_t>(duration_ms * 1e6)), multiplier});
+        any_positive = any_positive || multiplier > 0;
+    }
+    if (!any_positive) {
+        *error = path + ": profile never produces events";
+        return false;
+    }
+    *profile = RateProfile(std::move(segments));
+    return true;
+}
+
+std::chrono::nanoseconds RateProfile::Scale(std::chrono::nanoseconds offset, std::chrono::nanoseconds base_gap) const {
+    if (segments_.empty()) {
+        return base_gap;
+    }
+
+    // Walk the segments from offset, spending the gap at each one's rate
+    std::chrono::nanoseconds position = offset % period_;
+    if (position.count() < 0) {
+        position += period_;
+    }
+    size_t index = 0;
+    while (position >= segments_[index].duration) {
+        position -= segments_[index].duration;
+        index = (index + 1) % segments_.size();
+    }
+
+    double remaining = static_cast<double>(base_gap.count());
+    double elapsed = 0;
+    while (true) {
+        const Segment& segment = segments_[index];
+        double left = static_cast<double>((segment.duration - position).count());
+        if (segment.multiplier > 0 && remaining <= left * segment.multiplier) {
+            elapsed += remaining / segment.multiplier;
+            break;
+        }
+        remaining -= left * segment.multiplier;
+        elapsed += left;
+        position = std::chrono::nanoseconds(0);
+        index = (index + 1) % segments_.size();
+    }
+    return std::chrono::nanoseconds(static_cast<int64_t>(elapsed));
+}
+
+void WaitUntil(const PacingOptions& options, std::chrono::steady_clock::time_point deadline,
+               std::unique_lock<std::mutex>& lock, std::condition_variable& cv,
+               const std::atomic<uint64_t>& wakeups) {
+    uint64_t start_wakeups = wakeups.load();
+    auto spin_from = deadline;
+    if (options.mode == PacingMode::kHybrid) {
+        spin_from = deadline - options.spin_threshold;
+    }
+    if (options.mode != PacingMode::kSpin && std::chrono::steady_clock::now() < spin_from) {
+        cv.wait_until(lock, spin_from);
+        if (options.mode == PacingMode::kSleep || wakeups.load() != start_wakeups) {
+            return;
+        }
+    }
+    if (options.mode == PacingMode::kSleep) {
+        return;
+    }
+
+    lock.unlock();
+    while (std::chrono::steady_clock::now() < deadline && wakeups.load(std::memory_order_relaxed) == start_wakeups) {
+        CpuRelax();
+    }
+    lock.lock();
+}
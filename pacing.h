@@ -0,0 +1,72 @@
+#ifndef PACING_H
+#define PACING_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Scales event rates over time: the timeline is a sequence of segments, each running
+// at a multiple of the base rate, repeated for as long as the engine runs. Gaps
+// between events are drawn at the base rate and then stretched or compressed
+// through the profile, so Poisson arrivals stay Poisson at the scaled rate and a run
+// with the same seed reproduces the same schedule.
+class RateProfile {
+public:
+    struct Segment {
+        std::chrono::nanoseconds duration;
+        double multiplier;
+    };
+
+    // A constant 1x profile.
+    RateProfile() = default;
+
+    // segments must have a positive total duration and at least one positive multiplier.
+    explicit RateProfile(std::vector<Segment> segments);
+
+    // Bursts at burst_multiplier for the first burst_fraction of every period and runs
+    // at the base rate for the rest.
+    static RateProfile Bursty(std::chrono::milliseconds period, double burst_fraction, double burst_multiplier);
+
+    // Reads a recorded profile, one "<duration_ms> <multiplier>" segment per line; blank
+    // lines and lines starting with '#' are skipped. Returns false and sets *error if the
+    // file cannot be used.
+    static bool Load(const std::string& path, RateProfile* profile, std::string* error);
+
+    // Wall time taken by a gap of base_gap at the base rate, starting at offset from
+    // the beginning of the profile.
+    std::chrono::nanoseconds Scale(std::chrono::nanoseconds offset, std::chrono::nanoseconds base_gap) const;
+
+    bool constant() const { return segments_.empty(); }
+
+private:
+    std::vector<Segment> segments_;
+    std::chrono::nanoseconds period_{0};
+};
+
+// How publisher workers wait for their next deadline.
+enum class PacingMode {
+    kSleep,   // Block on a condition variable; cheapest, accuracy bound by the OS scheduler
+    kSpin,    // Busy-wait on the clock; burns a core per worker for sub-microsecond accuracy
+    kHybrid,  // Block until shortly before the deadline, then busy-wait the rest
+};
+
+struct PacingOptions {
+    PacingMode mode = PacingMode::kSleep;
+    // How long before a deadline kHybrid stops blocking and starts spinning
+    std::chrono::microseconds spin_threshold{100};
+    RateProfile profile;
+};
+
+// Waits until deadline in the given mode, or until *wakeups changes from the value
+// read on entry (bumped by whoever also notifies cv). lock must be held on entry and
+// is held again on return; spinning happens with it released. The clock is
+// steady_clock, which on Linux reads the TSC through the vDSO without a system call.
+void WaitUntil(const PacingOptions& options, std::chrono::steady_clock::time_point deadline,
+               std::unique_lock<std::mutex>& lock, std::condition_variable& cv,
+               const std::atomic<uint64_t>& wakeups);
+
+#endif // PACING_H
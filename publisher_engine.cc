@@ -0,0 +1,777 @@
+#include "publisher_engine.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <new>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "compact_levels.h"
+#include "log.h"
+
+using marketdata::InstrumentStats;
+using marketdata::MarketDataUpdate;
+using marketdata::OrderBookSnapshot;
+using marketdata::OrderBookIncrementalUpdate;
+using marketdata::PriceLevel;
+using marketdata::ServerStats;
+using marketdata::SymbolDirectory;
+
+namespace {
+
+// Upper bound on how long an idle worker sleeps before re-checking its instruments
+constexpr std::chrono::milliseconds kIdleWait(100);
+
+// A worker that falls further behind an instrument's schedule than this skips the
+// backlog instead of bursting through it
+constexpr std::chrono::milliseconds kMaxScheduleLag(10);
+
+// Points each worker has on the consistent-hash ring; more even out the share of
+// instruments each one gets
+constexpr size_t kRingPointsPerWorker = 128;
+
+// Most subscription commands a worker runs before it gets back to publishing, so a
+// mass reconnect is spread over its events instead of holding them all up
+constexpr size_t kCommandBudget = 64;
+
+uint64_t Mix(uint64_t x) {
+    // splitmix64 finalizer
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+// FNV-1a, so instruments land on the same worker in every build and run
+uint64_t HashInstrument(const std::string& instrument_id) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (char c : instrument_id) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+    }
+    return Mix(hash);
+}
+
+// Copies the best depth levels of a side, best first.
+template <typename BookSideT>
+void TopLevels(const BookSideT& side, size_t depth, std::vector<BookLevel>* levels) {
+    levels->clear();
+    for (size_t i = 0; i < std::min(depth, side.depth()); ++i) {
+        levels->push_back(side.level(i));
+    }
+}
+
+// Adds the level updates that turn the levels of a side published before, best first,
+// into the current ones: changed and new levels with their quantity, and levels no
+// longer there with quantity 0.
+template <typename BookSideT>
+void AddLevelChanges(const OrderBook& book, const BookSideT& side, const std::vector<BookLevel>& before,
+                     const std::vector<BookLevel>& after, PriceEncoding encoding,
+                     google::protobuf::RepeatedPtrField<PriceLevel>* changes) {
+    // True if price a is better than price b on this side
+    auto better = [&side](int64_t a, int64_t b) { return side.is_bid() ? a > b : a < b; };
+    size_t i = 0;
+    size_t j = 0;
+    while (i < before.size() || j < after.size()) {
+        if (j == after.size() || (i < before.size() && better(before[i].price_ticks, after[j].price_ticks))) {
+            SetPriceLevel(changes->Add(), book.ToPrice(before[i].price_ticks), 0, encoding);
+            ++i;
+        } else if (i == before.size() || better(after[j].price_ticks, before[i].price_ticks)) {
+            SetPriceLevel(changes->Add(), book.ToPrice(after[j].price_ticks), after[j].quantity, encoding);
+            ++j;
+        } else {
+            if (after[j].quantity != before[i].quantity) {
+                SetPriceLevel(changes->Add(), book.ToPrice(after[j].price_ticks), after[j].quantity, encoding);
+            }
+            ++i;
+            ++j;
+        }
+    }
+}
+
+void PinToCpu(int cpu) {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    int error = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    if (error != 0) {
+        Log(LogLevel::kError) << "Cannot pin publisher worker to CPU " << cpu << ": " << std::strerror(error);
+    }
+}
+
+// Links memory the pool has taken back, stored at the start of that memory
+struct FreeNode {
+    FreeNode* next;
+};
+
+// A lock-free list any thread pushes onto and only the owner takes from. The owner
+// always takes the whole list, so a node is never reused while a pusher still reads it.
+class ReturnList {
+public:
+    void Push(FreeNode* node) {
+        node->next = head_.load(std::memory_order_relaxed);
+        while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+        }
+    }
+
+    // Pairs with the release in Push, so the pusher is done with what it returned
+    FreeNode* TakeAll() { return head_.exchange(nullptr, std::memory_order_acquire); }
+
+private:
+    std::atomic<FreeNode*> head_{nullptr};
+};
+
+} // namespace
+
+struct UpdatePool::Shared {
+    struct Slot : FreeNode {
+        EncodedUpdate update;
+    };
+
+    // Runs on the thread that releases the last reference to an update
+    struct Recycle {
+        std::shared_ptr<Shared> shared;
+        Slot* slot;
+
+        void operator()(EncodedUpdate*) const { shared->returned_slots.Push(slot); }
+    };
+
+    // Room for the control block of a shared_ptr with a Recycle deleter and a
+    // BlockAllocator
+    static constexpr size_t kBlockSize = 128;
+
+    ~Shared() {
+        for (void* block : blocks) {
+            ::operator delete(block);
+        }
+    }
+
+    // Only the owning thread touches these, or whoever destroys the pool state once
+    // nothing else holds it
+    std::vector<std::unique_ptr<Slot>> slots;
+    std::vector<void*> blocks;
+    FreeNode* free_slots = nullptr;
+    FreeNode* free_blocks = nullptr;
+
+    ReturnList returned_slots;
+    ReturnList returned_blocks;
+};
+
+// Hands shared_ptr control blocks out of the pool state, so handing out an update does
+// not allocate once enough of them are in circulation
+template <typename T>
+class UpdatePool::BlockAllocator {
+public:
+    using value_type = T;
+
+    explicit BlockAllocator(std::shared_ptr<Shared> shared) : shared_(std::move(shared)) {}
+
+    template <typename U>
+    BlockAllocator(const BlockAllocator<U>& other) : shared_(other.shared_) {}
+
+    // Only called from Acquire, on the owning thread
+    T* allocate(size_t n) {
+        if (n != 1 || sizeof(T) > Shared::kBlockSize || alignof(T) > alignof(std::max_align_t)) {
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        if (shared_->free_blocks == nullptr) {
+            shared_->free_blocks = shared_->returned_blocks.TakeAll();
+        }
+        if (shared_->free_blocks == nullptr) {
+            shared_->blocks.push_back(::operator new(Shared::kBlockSize));
+            return static_cast<T*>(shared_->blocks.back());
+        }
+        FreeNode* block = shared_->free_blocks;
+        shared_->free_blocks = block->next;
+        return reinterpret_cast<T*>(block);
+    }
+
+    // Called from whichever thread released the update. The shared_ptr keeps a copy of
+    // this allocator until the block is returned, so the pool state is still alive.
+    void deallocate(T* p, size_t n) {
+        if (n != 1 || sizeof(T) > Shared::kBlockSize || alignof(T) > alignof(std::max_align_t)) {
+            ::operator delete(p);
+            return;
+        }
+        shared_->returned_blocks.Push(new (p) FreeNode());
+    }
+
+    friend bool operator==(const BlockAllocator& a, const BlockAllocator& b) { return a.shared_ == b.shared_; }
+    friend bool operator!=(const BlockAllocator& a, const BlockAllocator& b) { return a.shared_ != b.shared_; }
+
+private:
+    template <typename U>
+    friend class BlockAllocator;
+
+    std::shared_ptr<Shared> shared_;
+};
+
+UpdatePool::UpdatePool() : shared_(std::make_shared<Shared>()) {}
+
+std::shared_ptr<EncodedUpdate> UpdatePool::Acquire() {
+    Shared& shared = *shared_;
+    if (shared.free_slots == nullptr) {
+        shared.free_slots = shared.returned_slots.TakeAll();
+    }
+    Shared::Slot* slot;
+    if (shared.free_slots != nullptr) {
+        slot = static_cast<Shared::Slot*>(shared.free_slots);
+        shared.free_slots = slot->next;
+    } else {
+        shared.slots.push_back(std::make_unique<Shared::Slot>());
+        slot = shared.slots.back().get();
+    }
+    return std::shared_ptr<EncodedUpdate>(&slot->update, Shared::Recycle{shared_, slot},
+                                          BlockAllocator<EncodedUpdate>(shared_));
+}
+
+PublisherEngine::PublisherEngine(size_t num_workers, PriceEncoding encoding, SimulatorOptions simulator,
+                                 PacingOptions pacing, bool timestamps, int first_cpu)
+    : encoding_(encoding), simulator_options_(simulator), pacing_(std::move(pacing)), timestamps_(timestamps),
+      first_cpu_(first_cpu), start_time_(std::chrono::steady_clock::now()) {
+    if (num_workers == 0) {
+        num_workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+        workers_.back()->index = i;
+        for (size_t point = 0; point < kRingPointsPerWorker; ++point) {
+            ring_.emplace_back(Mix(i * kRingPointsPerWorker + point), i);
+        }
+    }
+    std::sort(ring_.begin(), ring_.end());
+}
+
+PublisherEngine::~PublisherEngine() {
+    Stop();
+}
+
+void PublisherEngine::Start() {
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    stopping_.store(false);
+    for (auto& worker : workers_) {
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            worker->closed = false;
+        }
+        Worker* w = worker.get();
+        w->thread = std::thread([this, w]() { WorkerLoop(*w); });
+    }
+    std::cout << "Publisher engine started with " << workers_.size() << " worker threads";
+    if (first_cpu_ >= 0) {
+        std::cout << " pinned to CPUs " << first_cpu_ << "-" << first_cpu_ + workers_.size() - 1;
+    }
+    std::cout << "." << std::endl;
+}
+
+void PublisherEngine::Stop() {
+    if (!running_) {
+        return;
+    }
+    stopping_.store(true);
+    for (auto& worker : workers_) {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        Wake(*worker);
+    }
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+    running_ = false;
+}
+
+PublisherEngine::Worker& PublisherEngine::WorkerFor(const std::string& instrument_id) {
+    // The first point at or after the instrument's hash, wrapping around. Changing the
+    // number of workers only moves the instruments next to the points that change.
+    auto it = std::lower_bound(ring_.begin(), ring_.end(), std::make_pair(HashInstrument(instrument_id), size_t{0}));
+    if (it == ring_.end()) {
+        it = ring_.begin();
+    }
+    return *workers_[it->second];
+}
+
+bool PublisherEngine::Post(Worker& worker, Command command) {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.closed) {
+        return false;
+    }
+    worker.commands.Push(std::move(command));
+    Wake(worker);
+    return true;
+}
+
+bool PublisherEngine::RunCommands(Worker& worker, size_t max_commands) {
+    for (size_t run = 0; run < max_commands; ++run) {
+        Command command;
+        if (!worker.commands.Pop(&command)) {
+            return true;
+        }
+        switch (command.kind) {
+        case Command::Kind::kSubscribe:
+            RunSubscribe(worker, command);
+            break;
+        case Command::Kind::kSnapshot:
+            RunSnapshot(worker, command);
+            break;
+        case Command::Kind::kUnsubscribe:
+            RunUnsubscribe(worker, command);
+            break;
+        case Command::Kind::kCollectStats:
+            RunCollectStats(worker, command);
+            break;
+        case Command::Kind::kNone:
+            break;
+        }
+    }
+    return false;
+}
+
+uint32_t PublisherEngine::InstrumentHandle(const std::string& instrument_id) {
+    std::lock_guard<std::mutex> lock(handles_mutex_);
+    auto it = handles_.find(instrument_id);
+    if (it != handles_.end()) {
+        return it->second;
+    }
+    if (handles_.size() >= kMaxInstrumentHandles) {
+        return 0;
+    }
+    uint32_t handle = static_cast<uint32_t>(handles_.size() + 1);
+    handles_.emplace(instrument_id, handle);
+    return handle;
+}
+
+std::vector<std::string> PublisherEngine::InstrumentIds(const std::string& prefix) {
+    std::vector<std::string> instrument_ids;
+    std::lock_guard<std::mutex> lock(handles_mutex_);
+    for (auto it = handles_.lower_bound(prefix);
+         it != handles_.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+        instrument_ids.push_back(it->first);
+    }
+    return instrument_ids;
+}
+
+bool PublisherEngine::Subscribe(const std::string& instrument_id, std::shared_ptr<Subscriber> subscriber,
+                                std::shared_ptr<Subscriber> snapshot_sink, size_t depth) {
+    uint32_t handle = InstrumentHandle(instrument_id);
+    if (handle == 0) {
+        Log(LogLevel::kError) << "Cannot publish " << instrument_id << ": all " << kMaxInstrumentHandles
+                              << " instrument handles are taken.";
+        return true;
+    }
+    Command command;
+    command.kind = Command::Kind::kSubscribe;
+    command.instrument_id = instrument_id;
+    command.handle = handle;
+    command.subscriber = std::move(subscriber);
+    command.snapshot_sink = std::move(snapshot_sink);
+    command.depth = depth;
+    return Post(WorkerFor(instrument_id), std::move(command));
+}
+
+void PublisherEngine::RunSubscribe(Worker& worker, Command& command) {
+    std::unique_ptr<Instrument>& instrument = worker.instruments[command.instrument_id];
+    if (!instrument) {
+        instrument = std::make_unique<Instrument>();
+        instrument->instrument_id = command.instrument_id;
+        instrument->handle = command.handle;
+        instrument->simulator = CreateSimulator(simulator_options_, command.instrument_id);
+    }
+
+    if (instrument->slots.count(command.subscriber.get()) != 0) {
+        return;
+    }
+    // A new tier starts from the current book, so it is set up before the snapshot
+    // is taken from it
+    size_t depth = command.depth;
+    DepthTier* tier = depth > 0 ? &TierFor(worker, *instrument, depth) : nullptr;
+    if (command.snapshot_sink != nullptr && !SendSnapshot(*instrument, command.snapshot_sink.get(), depth)) {
+        if (tier != nullptr && tier->subscribers.empty()) {
+            RetireTier(worker, *instrument, tier);
+        }
+        if (!instrument->scheduled) {
+            worker.instruments.erase(command.instrument_id);
+        }
+        return;
+    }
+
+    // An idle instrument starts publishing right away; otherwise the new subscriber
+    // simply joins the existing schedule.
+    if (!instrument->scheduled) {
+        instrument->next_publish = std::chrono::steady_clock::now();
+        instrument->scheduled = true;
+        worker.schedule.push(ScheduleEntry{instrument->next_publish, instrument.get()});
+    }
+    AddSubscriber(*instrument, tier, std::move(command.subscriber));
+}
+
+bool PublisherEngine::PublishSnapshot(const std::string& instrument_id, std::shared_ptr<Subscriber> sink,
+                                      size_t depth) {
+    Command command;
+    command.kind = Command::Kind::kSnapshot;
+    command.instrument_id = instrument_id;
+    command.subscriber = std::move(sink);
+    command.depth = depth;
+    return Post(WorkerFor(instrument_id), std::move(command));
+}
+
+bool PublisherEngine::PublishHandleAndSnapshot(const std::string& instrument_id, std::shared_ptr<Subscriber> sink) {
+    Command command;
+    command.kind = Command::Kind::kSnapshot;
+    command.instrument_id = instrument_id;
+    command.subscriber = std::move(sink);
+    command.with_handle = true;
+    return Post(WorkerFor(instrument_id), std::move(command));
+}
+
+void PublisherEngine::RunSnapshot(Worker& worker, const Command& command) {
+    auto it = worker.instruments.find(command.instrument_id);
+    if (it == worker.instruments.end() || it->second->subscriber_count() == 0) {
+        if (command.with_handle) {
+            Log() << "No snapshot for " << command.instrument_id << ": not a published instrument.";
+        }
+        return;
+    }
+    if (command.with_handle) {
+        // Queued from the worker like the snapshot, so it arrives first
+        MarketDataUpdate update;
+        SymbolDirectory::Entry* entry = update.mutable_symbol_directory()->add_entries();
+        entry->set_instrument_id(it->second->instrument_id);
+        entry->set_instrument_handle(it->second->handle);
+        if (!command.subscriber->Publish(std::make_shared<EncodedUpdate>(std::move(update)))) {
+            return;
+        }
+    }
+    size_t depth = command.depth;
+    const auto& tiers = it->second->tiers;
+    bool has_tier = std::any_of(tiers.begin(), tiers.end(),
+                                [depth](const std::unique_ptr<DepthTier>& tier) { return tier->depth == depth; });
+    if (depth == 0 || has_tier) {
+        SendSnapshot(*it->second, command.subscriber.get(), depth);
+    }
+}
+
+void PublisherEngine::FillSnapshot(const Instrument& instrument, OrderBookSnapshot* snapshot) const {
+    snapshot->set_instrument_id(instrument.instrument_id);
+    snapshot->set_sequence(instrument.sequence);
+    if (encoding_ != PriceEncoding::kDouble) {
+        snapshot->set_tick_size(kSimulatedTickSize);
+        snapshot->set_lot_size(kSimulatedLotSize);
+    }
+    instrument.simulator->FillSnapshot(encoding_, snapshot);
+}
+
+bool PublisherEngine::SendSnapshot(Instrument& instrument, Subscriber* sink, size_t depth) {
+    // Queued from the worker thread: every update with a higher sequence number is
+    // built after this and so queued behind it. An update with the same sequence may
+    // still be in flight and land after it; clients drop those as already applied.
+    ++instrument.snapshots_sent;
+    auto cached = std::find_if(instrument.snapshots.begin(), instrument.snapshots.end(),
+                               [depth](const CachedSnapshot& snapshot) { return snapshot.depth == depth; });
+    if (cached == instrument.snapshots.end()) {
+        cached = instrument.snapshots.insert(instrument.snapshots.end(), CachedSnapshot{depth, 0, nullptr});
+    }
+    if (!cached->update || cached->sequence != instrument.sequence) {
+        // Every change to the book comes with a new sequence number, so until then the
+        // last snapshot built is still exact
+        cached->update = BuildSnapshot(instrument, depth);
+        cached->sequence = instrument.sequence;
+        ++instrument.snapshots_built;
+    }
+    return sink->Publish(cached->update);
+}
+
+std::shared_ptr<const EncodedUpdate> PublisherEngine::BuildSnapshot(const Instrument& instrument, size_t depth) const {
+    MarketDataUpdate update;
+    OrderBookSnapshot* snapshot = update.mutable_snapshot();
+    if (depth == 0) {
+        FillSnapshot(instrument, snapshot);
+    } else {
+        // Depth-limited snapshots come from the tracked book, which the tier's levels
+        // and updates are taken from
+        snapshot->set_instrument_id(instrument.instrument_id);
+        snapshot->set_sequence(instrument.sequence);
+        if (encoding_ != PriceEncoding::kDouble) {
+            snapshot->set_tick_size(kSimulatedTickSize);
+            snapshot->set_lot_size(kSimulatedLotSize);
+        }
+        const OrderBook& book = instrument.book;
+        for (size_t i = 0; i < std::min(depth, book.bids().depth()); ++i) {
+            const BookLevel& level = book.bids().level(i);
+            SetPriceLevel(snapshot->add_bids(), book.ToPrice(level.price_ticks), level.quantity, encoding_);
+        }
+        for (size_t i = 0; i < std::min(depth, book.asks().depth()); ++i) {
+            const BookLevel& level = book.asks().level(i);
+            SetPriceLevel(snapshot->add_asks(), book.ToPrice(level.price_ticks), level.quantity, encoding_);
+        }
+    }
+    return std::make_shared<const EncodedUpdate>(std::move(update));
+}
+
+PublisherEngine::DepthTier& PublisherEngine::TierFor(Worker& worker, Instrument& instrument, size_t depth) {
+    for (auto& tier : instrument.tiers) {
+        if (tier->depth == depth) {
+            return *tier;
+        }
+    }
+    if (instrument.tiers.empty()) {
+        // The book is only tracked while there are tiers; start it from the full snapshot
+        OrderBookSnapshot snapshot;
+        FillSnapshot(instrument, &snapshot);
+        instrument.book.ApplySnapshot(snapshot);
+    }
+    std::unique_ptr<DepthTier> tier;
+    if (worker.spare_tiers.empty()) {
+        tier = std::make_unique<DepthTier>();
+    } else {
+        tier = std::move(worker.spare_tiers.back());
+        worker.spare_tiers.pop_back();
+    }
+    tier->depth = depth;
+    tier->sequence = instrument.sequence;
+    TopLevels(instrument.book.bids(), depth, &tier->bids);
+    TopLevels(instrument.book.asks(), depth, &tier->asks);
+    instrument.tiers.push_back(std::move(tier));
+    return *instrument.tiers.back();
+}
+
+void PublisherEngine::AddSubscriber(Instrument& instrument, DepthTier* tier, std::shared_ptr<Subscriber> subscriber) {
+    std::vector<std::shared_ptr<Subscriber>>& subscribers = tier != nullptr ? tier->subscribers : instrument.subscribers;
+    instrument.slots[subscriber.get()] = SubscriberSlot{tier, subscribers.size()};
+    subscribers.push_back(std::move(subscriber));
+}
+
+bool PublisherEngine::RemoveSubscriber(Worker& worker, Instrument& instrument, const Subscriber* subscriber) {
+    auto slot = instrument.slots.find(subscriber);
+    if (slot == instrument.slots.end()) {
+        return false;
+    }
+    DepthTier* tier = slot->second.tier;
+    std::vector<std::shared_ptr<Subscriber>>& subscribers = tier != nullptr ? tier->subscribers : instrument.subscribers;
+    // Fan-out order does not matter, so the last subscriber takes the leaving one's place
+    size_t index = slot->second.index;
+    instrument.slots.erase(slot);
+    if (index + 1 != subscribers.size()) {
+        subscribers[index] = std::move(subscribers.back());
+        instrument.slots[subscribers[index].get()].index = index;
+    }
+    subscribers.pop_back();
+    if (tier != nullptr && subscribers.empty()) {
+        RetireTier(worker, instrument, tier);
+    }
+    return true;
+}
+
+void PublisherEngine::RetireTier(Worker& worker, Instrument& instrument, DepthTier* tier) {
+    auto& tiers = instrument.tiers;
+    auto it = std::find_if(tiers.begin(), tiers.end(),
+                           [tier](const std::unique_ptr<DepthTier>& entry) { return entry.get() == tier; });
+    worker.spare_tiers.push_back(std::move(*it));
+    tiers.erase(it);
+}
+
+void PublisherEngine::PublishTierUpdate(Worker& worker, Instrument& instrument, DepthTier& tier,
+                                        const OrderBookIncrementalUpdate& event) {
+    std::shared_ptr<EncodedUpdate> update = worker.update_pool.Acquire();
+    OrderBookIncrementalUpdate* incremental_update = update->mutable_message()->mutable_incremental_update();
+    incremental_update->Clear();
+
+    TopLevels(instrument.book.bids(), tier.depth, &worker.levels);
+    AddLevelChanges(instrument.book, instrument.book.bids(), tier.bids, worker.levels, encoding_,
+                    incremental_update->mutable_bid_updates());
+    tier.bids.swap(worker.levels);
+    TopLevels(instrument.book.asks(), tier.depth, &worker.levels);
+    AddLevelChanges(instrument.book, instrument.book.asks(), tier.asks, worker.levels, encoding_,
+                    incremental_update->mutable_ask_updates());
+    tier.asks.swap(worker.levels);
+    if (incremental_update->bid_updates().empty() && incremental_update->ask_updates().empty()) {
+        // Nothing this tier shows changed; the next update covers this event's sequence
+        return;
+    }
+
+    incremental_update->set_instrument_handle(instrument.handle);
+    incremental_update->set_sequence(event.sequence());
+    if (tier.sequence + 1 != event.sequence()) {
+        incremental_update->set_first_sequence(tier.sequence + 1);
+    }
+    incremental_update->set_publish_timestamp_ns(event.publish_timestamp_ns());
+    tier.sequence = event.sequence();
+    if (encoding_ == PriceEncoding::kCompact) {
+        CompactLevels(incremental_update);
+    }
+    update->Encode();
+    instrument.bytes_published += update->bytes().Length();
+    instrument.deliveries += tier.subscribers.size();
+    for (const auto& subscriber : tier.subscribers) {
+        subscriber->Publish(update);
+    }
+}
+
+bool PublisherEngine::Unsubscribe(const std::string& instrument_id, const Subscriber* subscriber,
+                                  std::shared_ptr<Subscriber> snapshot_sink) {
+    Command command;
+    command.kind = Command::Kind::kUnsubscribe;
+    command.instrument_id = instrument_id;
+    command.leaving = subscriber;
+    command.snapshot_sink = std::move(snapshot_sink);
+    return Post(WorkerFor(instrument_id), std::move(command));
+}
+
+void PublisherEngine::RunUnsubscribe(Worker& worker, const Command& command) {
+    auto it = worker.instruments.find(command.instrument_id);
+    Instrument* instrument = it != worker.instruments.end() ? it->second.get() : nullptr;
+    if (instrument != nullptr) {
+        RemoveSubscriber(worker, *instrument, command.leaving);
+    }
+    if (command.snapshot_sink == nullptr) {
+        return;
+    }
+    if (instrument == nullptr) {
+        MarketDataUpdate update;
+        update.mutable_snapshot()->set_instrument_id(command.instrument_id);
+        command.snapshot_sink->Publish(std::make_shared<EncodedUpdate>(std::move(update)));
+        return;
+    }
+    // The same confirmation goes to everyone leaving, so it is encoded only once
+    if (!instrument->unsubscribed) {
+        MarketDataUpdate update;
+        update.mutable_snapshot()->set_instrument_id(command.instrument_id);
+        instrument->unsubscribed = std::make_shared<EncodedUpdate>(std::move(update));
+    }
+    command.snapshot_sink->Publish(instrument->unsubscribed);
+}
+
+void PublisherEngine::CollectStats(ServerStats* stats) {
+    for (auto& worker : workers_) {
+        std::promise<void> collected;
+        std::future<void> done = collected.get_future();
+        Command command;
+        command.kind = Command::Kind::kCollectStats;
+        command.stats = stats;
+        command.collected = &collected;
+        if (Post(*worker, std::move(command))) {
+            done.wait();
+        }
+    }
+}
+
+void PublisherEngine::RunCollectStats(Worker& worker, const Command& command) {
+    for (const auto& entry : worker.instruments) {
+        const Instrument& instrument = *entry.second;
+        InstrumentStats* instrument_stats = command.stats->add_instruments();
+        instrument_stats->set_instrument_id(instrument.instrument_id);
+        instrument_stats->set_subscribers(static_cast<uint32_t>(instrument.subscriber_count()));
+        instrument_stats->set_updates_published(instrument.updates_published);
+        instrument_stats->set_bytes_published(instrument.bytes_published);
+        instrument_stats->set_deliveries(instrument.deliveries);
+        instrument_stats->set_snapshots_sent(instrument.snapshots_sent);
+        instrument_stats->set_snapshots_built(instrument.snapshots_built);
+    }
+    command.collected->set_value();
+}
+
+void PublisherEngine::Wake(Worker& worker) {
+    worker.wakeups.fetch_add(1);
+    worker.cv.notify_all();
+}
+
+void PublisherEngine::WorkerLoop(Worker& worker) {
+    if (first_cpu_ >= 0) {
+        PinToCpu(first_cpu_ + static_cast<int>(worker.index));
+    }
+
+    while (!stopping_.load()) {
+        // Read before the commands are drained: one posted after that bumps it past this
+        uint64_t wakeups = worker.wakeups.load();
+        bool drained = RunCommands(worker, kCommandBudget);
+
+        auto now = std::chrono::steady_clock::now();
+        while (!worker.schedule.empty() && worker.schedule.top().deadline <= now && !stopping_.load()) {
+            Instrument& instrument = *worker.schedule.top().instrument;
+            worker.schedule.pop();
+            if (instrument.subscriber_count() == 0) {
+                // Idle instruments leave the schedule and are dropped, so ids subscribed to
+                // once keep only their handle
+                worker.instruments.erase(worker.instruments.find(instrument.instrument_id));
+                continue;
+            }
+
+            // Generate and serialize the update once, then fan it out to every subscriber.
+            std::shared_ptr<EncodedUpdate> update = worker.update_pool.Acquire();
+            // Clearing the nested message rather than the update keeps the elements of its
+            // repeated fields for reuse; clearing the oneof would free them.
+            OrderBookIncrementalUpdate* incremental_update = update->mutable_message()->mutable_incremental_update();
+            incremental_update->Clear();
+            incremental_update->set_instrument_handle(instrument.handle);
+            incremental_update->set_sequence(++instrument.sequence);
+            instrument.simulator->Step(encoding_, incremental_update);
+            if (timestamps_) {
+                incremental_update->set_publish_timestamp_ns(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count());
+            }
+            ++instrument.updates_published;
+            if (!instrument.tiers.empty()) {
+                // Depth-limited subscribers get the change to their levels instead,
+                // worked out from the tracked book below
+                instrument.book.ApplyIncremental(*incremental_update);
+            }
+            if (!instrument.subscribers.empty()) {
+                if (encoding_ == PriceEncoding::kCompact) {
+                    CompactLevels(incremental_update);
+                }
+                update->Encode();
+                instrument.bytes_published += update->bytes().Length();
+                instrument.deliveries += instrument.subscribers.size();
+            }
+
+            std::chrono::nanoseconds gap = pacing_.profile.Scale(instrument.next_publish - start_time_,
+                                                                  instrument.simulator->NextEventDelay());
+            instrument.next_publish += gap;
+            if (now - instrument.next_publish > kMaxScheduleLag) {
+                instrument.next_publish = now;
+            }
+            worker.schedule.push(ScheduleEntry{instrument.next_publish, &instrument});
+
+            for (const auto& subscriber : instrument.subscribers) {
+                subscriber->Publish(update);
+            }
+            for (auto& tier : instrument.tiers) {
+                PublishTierUpdate(worker, instrument, *tier, *incremental_update);
+            }
+            // Keep subscription changes from waiting behind a long run of due instruments
+            RunCommands(worker, kCommandBudget);
+            now = std::chrono::steady_clock::now();
+        }
+
+        auto deadline = now + kIdleWait;
+        if (!worker.schedule.empty()) {
+            deadline = std::min(deadline, worker.schedule.top().deadline);
+        }
+        if (!drained) {
+            // Commands left over for the next pass
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(worker.mutex);
+        if (worker.wakeups.load() == wakeups) {
+            WaitUntil(pacing_, deadline, lock, worker.cv, worker.wakeups);
+        }
+    }
+
+    // Answer whatever was posted before the worker closed
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.closed = true;
+    }
+    RunCommands(worker);
+}
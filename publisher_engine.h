@@ -0,0 +1,308 @@
+#ifndef PUBLISHER_ENGINE_H
+#define PUBLISHER_ENGINE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "encoded_update.h"
+#include "market_data.pb.h"
+#include "market_simulator.h"
+#include "mpsc_queue.h"
+#include "order_book.h"
+#include "pacing.h"
+
+// A sink for market data published by the engine, typically one per client stream.
+class Subscriber {
+public:
+    virtual ~Subscriber() = default;
+
+    // Called from publisher worker threads. The update is shared, already encoded, by
+    // every subscriber of the instrument and must not be modified. Returns false if it
+    // could not be delivered.
+    virtual bool Publish(std::shared_ptr<const EncodedUpdate> update) = 0;
+};
+
+// Recycles the updates built by one producer thread. An update is handed out again
+// once every subscriber has released it, keeping its nested messages and repeated
+// fields allocated, so a steady publishing cycle builds updates without touching the
+// C++ heap (encoding them still takes a gRPC slice per update). The pool grows to the
+// number of updates still queued on streams. Whichever thread drops the last
+// reference returns the update, and the shared_ptr control block it came with, to a
+// lock-free list the pool takes over whole, so acquiring takes constant time however
+// many updates streams are still holding.
+class UpdatePool {
+public:
+    UpdatePool();
+
+    // Returns an update no one else holds, still filled from its previous use. Must
+    // only be called from the owning thread.
+    std::shared_ptr<EncodedUpdate> Acquire();
+
+private:
+    struct Shared;
+    template <typename T>
+    class BlockAllocator;
+
+    // Outlives the pool while any update it handed out is still held
+    std::shared_ptr<Shared> shared_;
+};
+
+// Shared publishing engine: one producer per instrument, driven by a fixed pool of
+// worker threads. Each instrument's market comes from its own simulator; each event
+// becomes one update, generated once and fanned out to every subscriber of that
+// instrument, so the thread count does not depend on how many streams or
+// subscriptions exist. Snapshots are taken from the simulator's live book and cached
+// until its next event, so joiners in between share one snapshot, encoded once.
+//
+// Instruments are partitioned over the workers by consistent hashing. A worker owns
+// its instruments outright, books and subscriber lists included, and can be pinned to
+// a CPU, so publishing touches no state shared with other cores and takes no lock.
+// Subscription changes reach a worker as commands on a lock-free queue, which it runs,
+// a bounded number at a time, between updates: Subscribe, Unsubscribe and
+// PublishSnapshot only post their command and return, so a stream's thread never
+// waits for a busy worker.
+//
+// Each worker keeps its instruments' next event times in a deadline heap and waits
+// for the earliest one as configured by PacingOptions. Deadlines advance on an
+// absolute schedule, so rates do not drift with wakeup latency.
+class PublisherEngine {
+public:
+    // num_workers == 0 sizes the pool to the number of hardware threads. With
+    // timestamps, incremental updates carry the time they were generated. With
+    // first_cpu >= 0, worker i is pinned to CPU first_cpu + i.
+    explicit PublisherEngine(size_t num_workers = 0, PriceEncoding encoding = PriceEncoding::kDouble,
+                             SimulatorOptions simulator = SimulatorOptions(), PacingOptions pacing = PacingOptions(),
+                             bool timestamps = false, int first_cpu = -1);
+    ~PublisherEngine();
+
+    // Most instruments that can ever have a handle, which bounds the handle map and the
+    // handle-indexed tables clients keep
+    static constexpr size_t kMaxInstrumentHandles = size_t{1} << 20;
+
+    PublisherEngine(const PublisherEngine&) = delete;
+    PublisherEngine& operator=(const PublisherEngine&) = delete;
+
+    void Start();
+    void Stop();
+
+    // Returns the numeric handle of an instrument, assigning one on first use. Handles
+    // are never 0 and stay the same for the lifetime of the engine, since clients keep
+    // them, so one is kept for every id ever subscribed to. Returns 0 once
+    // kMaxInstrumentHandles ids have one.
+    uint32_t InstrumentHandle(const std::string& instrument_id);
+
+    // Returns, in order, the ids of the instruments that have a handle and start with
+    // prefix: those given one up front, e.g. from a symbol list, and every instrument
+    // subscribed to so far.
+    std::vector<std::string> InstrumentIds(const std::string& prefix);
+
+    // Adds a subscriber for an instrument. If snapshot_sink is set, the instrument's
+    // snapshot is published to it first, ordered against the instrument's updates so
+    // the subscriber sees exactly the updates that follow the snapshot's sequence
+    // number. A subscriber that is already subscribed, or whose snapshot cannot be
+    // delivered, is not added.
+    //
+    // With depth > 0, the subscriber only gets the best depth levels per side: its
+    // snapshot holds just those, and its updates are the changes to them. Subscribers
+    // with the same depth share their updates, built once per event.
+    //
+    // This and the three calls below return false only if the engine is not running.
+    bool Subscribe(const std::string& instrument_id, std::shared_ptr<Subscriber> subscriber,
+                   std::shared_ptr<Subscriber> snapshot_sink = nullptr, size_t depth = 0);
+
+    // Publishes a fresh snapshot of a subscribed instrument to sink, ordered against its
+    // updates in the same way and limited to depth levels per side if depth > 0.
+    // Nothing is published if the instrument has no subscribers.
+    bool PublishSnapshot(const std::string& instrument_id, std::shared_ptr<Subscriber> sink, size_t depth = 0);
+
+    // For feed receivers, which resolve the feed's updates by handle: publishes the
+    // instrument's handle to sink as a one-entry symbol directory, then its full-depth
+    // snapshot. The worker sends both or, if the instrument has no subscribers and so
+    // is not being published, neither.
+    bool PublishHandleAndSnapshot(const std::string& instrument_id, std::shared_ptr<Subscriber> sink);
+
+    // Removes a subscriber from an instrument, if it is subscribed. If snapshot_sink is
+    // set, an empty snapshot of the instrument is then published to it, after the last
+    // update the subscriber is given.
+    bool Unsubscribe(const std::string& instrument_id, const Subscriber* subscriber,
+                     std::shared_ptr<Subscriber> snapshot_sink = nullptr);
+
+    // Appends the counters of every instrument that has been subscribed to. Waits for
+    // each worker to collect its own.
+    void CollectStats(marketdata::ServerStats* stats);
+
+    size_t num_workers() const { return workers_.size(); }
+    PriceEncoding price_encoding() const { return encoding_; }
+
+private:
+    // Subscribers of an instrument that share one depth limit, and the levels last
+    // published to them.
+    struct DepthTier {
+        size_t depth = 0;
+        std::vector<std::shared_ptr<Subscriber>> subscribers;
+        // Best first
+        std::vector<BookLevel> bids;
+        std::vector<BookLevel> asks;
+        // Sequence number of the last event published to the tier
+        uint64_t sequence = 0;
+    };
+
+    // An instrument's last snapshot at one depth, encoded once and shared by every
+    // subscriber it is sent to.
+    struct CachedSnapshot {
+        size_t depth = 0;
+        // Sequence number of the book the snapshot was taken from
+        uint64_t sequence = 0;
+        std::shared_ptr<const EncodedUpdate> update;
+    };
+
+    // Where a subscriber sits among an instrument's subscriber lists: its tier, nullptr
+    // for full depth, and its index in that tier's list.
+    struct SubscriberSlot {
+        DepthTier* tier = nullptr;
+        size_t index = 0;
+    };
+
+    struct Instrument {
+        std::string instrument_id;
+        uint32_t handle = 0;
+        std::unique_ptr<MarketSimulator> simulator;
+        // Sequence number of the last update published
+        uint64_t sequence = 0;
+        std::chrono::steady_clock::time_point next_publish;
+        // True while the instrument has an entry in its worker's schedule
+        bool scheduled = false;
+        // Full-depth subscribers
+        std::vector<std::shared_ptr<Subscriber>> subscribers;
+        std::vector<std::unique_ptr<DepthTier>> tiers;
+        // Every subscriber's slot, so joining and leaving take constant time however
+        // many subscribers there are
+        std::unordered_map<const Subscriber*, SubscriberSlot> slots;
+        // The book as subscribers see it, kept up to date from the published updates
+        // while there are tiers to take their levels from
+        OrderBook book;
+        // One per depth snapshots have been sent at; rebuilt when the sequence has moved on
+        std::vector<CachedSnapshot> snapshots;
+        // The empty snapshot that confirms an unsubscribe, encoded once
+        std::shared_ptr<const EncodedUpdate> unsubscribed;
+        size_t subscriber_count() const { return slots.size(); }
+
+        // Counted by the worker as updates are built
+        uint64_t updates_published = 0;
+        uint64_t bytes_published = 0;
+        uint64_t deliveries = 0;
+        uint64_t snapshots_sent = 0;
+        uint64_t snapshots_built = 0;
+    };
+
+    // A request for a worker, run on its thread. A plain struct rather than a closure,
+    // so that with the queue's recycled nodes posting one does not allocate, as long
+    // as the id fits in std::string's inline buffer.
+    struct Command {
+        enum class Kind { kNone, kSubscribe, kSnapshot, kUnsubscribe, kCollectStats };
+        Kind kind = Kind::kNone;
+        std::string instrument_id;
+        uint32_t handle = 0;
+        // The joining subscriber, or the sink of a requested snapshot
+        std::shared_ptr<Subscriber> subscriber;
+        const Subscriber* leaving = nullptr;
+        // Receives the snapshot of a joiner, or the empty one that confirms a leave
+        std::shared_ptr<Subscriber> snapshot_sink;
+        size_t depth = 0;
+        // Send the instrument's handle ahead of a requested snapshot
+        bool with_handle = false;
+        marketdata::ServerStats* stats = nullptr;
+        std::promise<void>* collected = nullptr;
+    };
+
+    struct ScheduleEntry {
+        std::chrono::steady_clock::time_point deadline;
+        Instrument* instrument;
+        bool operator>(const ScheduleEntry& other) const { return deadline > other.deadline; }
+    };
+
+    // Kept on their own cache lines so workers never share one
+    struct alignas(64) Worker {
+        size_t index = 0;
+        // Only guards waiting for work and closed; the worker's state below is touched by
+        // its own thread alone
+        std::mutex mutex;
+        std::condition_variable cv;
+        // Bumped, under mutex, whenever the worker has to look at its commands or schedule again
+        std::atomic<uint64_t> wakeups{0};
+        MpscQueue<Command> commands;
+        // Set, under mutex, while the worker takes no commands
+        bool closed = true;
+        // Instruments with subscribers, or waiting to leave the schedule. An instrument is
+        // dropped, simulator and all, once it has left it, and starts afresh if it is
+        // subscribed to again.
+        std::map<std::string, std::unique_ptr<Instrument>> instruments;
+        // Instruments with subscribers, earliest next event first
+        std::priority_queue<ScheduleEntry, std::vector<ScheduleEntry>, std::greater<ScheduleEntry>> schedule;
+        UpdatePool update_pool;
+        // Reused when working out a tier's new top levels
+        std::vector<BookLevel> levels;
+        // Tiers whose last subscriber left, kept with their capacity for the next one
+        std::vector<std::unique_ptr<DepthTier>> spare_tiers;
+        std::thread thread;
+    };
+
+    Worker& WorkerFor(const std::string& instrument_id);
+    // Queues command to run on the worker's thread. Returns false if the worker is not
+    // running.
+    bool Post(Worker& worker, Command command);
+    // The functions below must be called from the instrument's worker thread.
+    void FillSnapshot(const Instrument& instrument, marketdata::OrderBookSnapshot* snapshot) const;
+    // depth == 0 sends the full book. Joiners between two events share one snapshot.
+    bool SendSnapshot(Instrument& instrument, Subscriber* sink, size_t depth);
+    std::shared_ptr<const EncodedUpdate> BuildSnapshot(const Instrument& instrument, size_t depth) const;
+    DepthTier& TierFor(Worker& worker, Instrument& instrument, size_t depth);
+    // Adds a subscriber to a list of the instrument, or removes it from whichever list it
+    // is in. An emptied tier goes back to the worker's spares. Removal returns false if
+    // the subscriber was not subscribed.
+    void AddSubscriber(Instrument& instrument, DepthTier* tier, std::shared_ptr<Subscriber> subscriber);
+    bool RemoveSubscriber(Worker& worker, Instrument& instrument, const Subscriber* subscriber);
+    void RetireTier(Worker& worker, Instrument& instrument, DepthTier* tier);
+    // Publishes the change in a tier's levels since its last update, if there is one.
+    void PublishTierUpdate(Worker& worker, Instrument& instrument, DepthTier& tier,
+                           const marketdata::OrderBookIncrementalUpdate& event);
+    void WorkerLoop(Worker& worker);
+    // Runs up to max_commands queued commands. Returns true if none are left.
+    bool RunCommands(Worker& worker, size_t max_commands = SIZE_MAX);
+    void RunSubscribe(Worker& worker, Command& command);
+    void RunSnapshot(Worker& worker, const Command& command);
+    void RunUnsubscribe(Worker& worker, const Command& command);
+    void RunCollectStats(Worker& worker, const Command& command);
+    // Wakes a worker after its schedule changed. Must be called with its lock held.
+    void Wake(Worker& worker);
+
+    PriceEncoding encoding_;
+    SimulatorOptions simulator_options_;
+    PacingOptions pacing_;
+    bool timestamps_;
+    int first_cpu_;
+    // Origin of the rate profile
+    std::chrono::steady_clock::time_point start_time_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    // Consistent-hash ring: points sorted by hash, each owned by a worker index
+    std::vector<std::pair<uint64_t, size_t>> ring_;
+
+    std::mutex handles_mutex_;
+    std::map<std::string, uint32_t> handles_;
+    bool running_ = false;
+    std::atomic<bool> stopping_{false};
+};
+
+#endif // PUBLISHER_ENGINE_H
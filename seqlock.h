@@ -0,0 +1,79 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// A value with one writer and any number of readers, none of which ever block or
+// take a lock. The writer bumps a sequence number to odd before changing the value
+// and back to even after; a reader copies the value and retries if the sequence
+// changed or was odd meanwhile. Writes never wait for readers, so a reader can only
+// be held up by a writer that is in the middle of a store.
+//
+// The value is kept as relaxed atomic words, so the copies that race with a store
+// are well defined; T must be trivially copyable.
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable<T>::value, "Seqlock values are copied word by word");
+
+public:
+    Seqlock() {
+        uint64_t words[kWords] = {};
+        T value{};
+        std::memcpy(words, &value, sizeof(T));
+        for (size_t i = 0; i < kWords; ++i) {
+            words_[i].store(words[i], std::memory_order_relaxed);
+        }
+    }
+
+    Seqlock(const Seqlock&) = delete;
+    Seqlock& operator=(const Seqlock&) = delete;
+
+    // Must only be called from the writer thread.
+    void Store(const T& value) {
+        uint64_t words[kWords] = {};
+        std::memcpy(words, &value, sizeof(T));
+        uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);
+        // Orders the odd sequence number before any of the new words
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < kWords; ++i) {
+            words_[i].store(words[i], std::memory_order_relaxed);
+        }
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    T Load() const {
+        uint64_t words[kWords];
+        while (true) {
+            uint64_t before = sequence_.load(std::memory_order_acquire);
+            if (before & 1) {
+                continue;
+            }
+            for (size_t i = 0; i < kWords; ++i) {
+                words[i] = words_[i].load(std::memory_order_relaxed);
+            }
+            // Orders the words read before the second look at the sequence number
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) == before) {
+                break;
+            }
+        }
+        T value;
+        std::memcpy(&value, words, sizeof(T));
+        return value;
+    }
+
+    // Number of stores so far.
+    uint64_t version() const { return sequence_.load(std::memory_order_acquire) / 2; }
+
+private:
+    static constexpr size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    std::atomic<uint64_t> sequence_{0};
+    std::atomic<uint64_t> words_[kWords];
+};
+
+#endif // SEQLOCK_H
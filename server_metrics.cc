@@ -0,0 +1,71 @@
+#include "server_metrics.h"
+
+#include "outbound_queue.h"
+#include "publisher_engine.h"
+
+using marketdata::ServerStats;
+using marketdata::StreamStats;
+
+namespace {
+
+// Adds a stream's cumulative counters to stats.
+void AddCounters(const StreamMetrics& metrics, StreamStats* stats) {
+    stats->set_messages_sent(stats->messages_sent() + metrics.messages_sent.load(std::memory_order_relaxed));
+    stats->set_bytes_sent(stats->bytes_sent() + metrics.bytes_sent.load(std::memory_order_relaxed));
+    stats->set_write_blocked_ns(stats->write_blocked_ns() + metrics.write_blocked_ns.load(std::memory_order_relaxed));
+    stats->set_updates_conflated(stats->updates_conflated() +
+                                 metrics.updates_conflated.load(std::memory_order_relaxed));
+    stats->set_updates_dropped(stats->updates_dropped() + metrics.updates_dropped.load(std::memory_order_relaxed));
+}
+
+} // namespace
+
+void ServerMetrics::AddStream(const std::shared_ptr<OutboundStream>& stream, const std::string& peer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    StreamMetrics& metrics = stream->metrics();
+    metrics.stream_id = ++streams_opened_;
+    metrics.peer = peer;
+    entries_.push_back(Entry{stream, stream->shared_metrics()});
+    if (entries_.size() >= 2 * pruned_size_ + 1) {
+        // Bounds the entries of closed streams even if stats are never collected
+        Prune();
+    }
+}
+
+void ServerMetrics::Prune() {
+    size_t kept = 0;
+    for (auto& entry : entries_) {
+        if (entry.stream.expired()) {
+            AddCounters(*entry.metrics, &closed_);
+        } else {
+            entries_[kept++] = std::move(entry);
+        }
+    }
+    entries_.resize(kept);
+    pruned_size_ = kept;
+}
+
+void ServerMetrics::Collect(ServerStats* stats) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Prune();
+        stats->set_streams_opened(streams_opened_);
+        *stats->mutable_closed_streams() = closed_;
+        for (const auto& entry : entries_) {
+            std::shared_ptr<OutboundStream> stream = entry.stream.lock();
+            if (!stream) {
+                // Gone since the prune; counted as closed on the next one
+                continue;
+            }
+            const StreamMetrics& metrics = *entry.metrics;
+            StreamStats* stream_stats = stats->add_streams();
+            stream_stats->set_stream_id(metrics.stream_id);
+            stream_stats->set_peer(metrics.peer);
+            stream_stats->set_subscriptions(static_cast<uint32_t>(metrics.subscriptions.load(std::memory_order_relaxed)));
+            stream_stats->set_queue_depth(stream->queue().size());
+            stream_stats->set_max_queue_depth(stream->queue().max_size());
+            AddCounters(metrics, stream_stats);
+        }
+    }
+    engine_->CollectStats(stats);
+}
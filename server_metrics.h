@@ -0,0 +1,77 @@
+#ifndef SERVER_METRICS_H
+#define SERVER_METRICS_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "market_data.pb.h"
+
+class OutboundStream;
+class PublisherEngine;
+
+// Counters of one stream. Each is a relaxed atomic updated where the event happens:
+// the send and write counters only by the stream's writer, the others by whichever
+// producer hits them. No counter is shared between streams, so the hot paths never
+// contend on them, and nothing is aggregated until stats are asked for.
+struct StreamMetrics {
+    std::atomic<uint64_t> subscriptions{0};
+    std::atomic<uint64_t> messages_sent{0};
+    std::atomic<uint64_t> bytes_sent{0};
+    std::atomic<uint64_t> write_blocked_ns{0};
+    std::atomic<uint64_t> updates_conflated{0};
+    std::atomic<uint64_t> updates_dropped{0};
+
+    // Set once, before the stream is registered
+    uint64_t stream_id = 0;
+    std::string peer;
+};
+
+// Adds to a counter that only the calling thread writes: a relaxed load and store
+// rather than a locked read-modify-write.
+inline void AddToOwnCounter(std::atomic<uint64_t>& counter, uint64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+// Adds to a counter that several threads may write.
+inline void AddToSharedCounter(std::atomic<uint64_t>& counter, uint64_t value) {
+    counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+// Registry of the server's streams, aggregating their counters and the engine's on
+// demand. Registration takes a lock once per stream; collecting reads every counter
+// without stopping the threads updating them, so the result is a consistent view of
+// each counter but not an atomic snapshot across them.
+class ServerMetrics {
+public:
+    explicit ServerMetrics(PublisherEngine* engine) : engine_(engine) {}
+
+    // Starts reporting a stream. Its counters are kept, and added to the closed stream
+    // totals, once the stream itself is gone.
+    void AddStream(const std::shared_ptr<OutboundStream>& stream, const std::string& peer);
+
+    void Collect(marketdata::ServerStats* stats);
+
+private:
+    struct Entry {
+        std::weak_ptr<OutboundStream> stream;
+        std::shared_ptr<StreamMetrics> metrics;
+    };
+
+    // Folds the entries of streams that are gone into closed_. Called with mutex_ held.
+    void Prune();
+
+    PublisherEngine* engine_;
+
+    std::mutex mutex_;
+    std::vector<Entry> entries_;
+    // Entries left after the last prune; the next one is due once this has doubled
+    size_t pruned_size_ = 0;
+    uint64_t streams_opened_ = 0;
+    marketdata::StreamStats closed_;
+};
+
+#endif // SERVER_METRICS_H
@@ -0,0 +1,72 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Bounded lock-free single-producer single-consumer ring buffer. TryPush must only be
+// called from one producer thread and TryPop from one consumer thread. Neither ever
+// blocks: a full ring refuses the element and an empty one returns nothing. Each side
+// keeps a cached copy of the other's index, so it only touches the other's cache line
+// when the ring looks full or empty.
+template <typename T>
+class SpscRing {
+public:
+    // capacity is rounded up to a power of two.
+    explicit SpscRing(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        slots_.resize(size);
+        mask_ = size - 1;
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    bool TryPush(const T& value) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head - cached_tail_ > mask_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head - cached_tail_ > mask_) {
+                return false;
+            }
+        }
+        slots_[head & mask_] = value;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(T* out) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == cached_head_) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail == cached_head_) {
+                return false;
+            }
+        }
+        *out = slots_[tail & mask_];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+
+private:
+    static constexpr size_t kCacheLine = 64;
+
+    std::vector<T> slots_;
+    size_t mask_ = 0;
+
+    // Producer side
+    alignas(kCacheLine) std::atomic<size_t> head_{0};
+    size_t cached_tail_ = 0;
+
+    // Consumer side
+    alignas(kCacheLine) std::atomic<size_t> tail_{0};
+    size_t cached_head_ = 0;
+};
+
+#endif // SPSC_RING_H
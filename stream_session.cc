@@ -0,0 +1,217 @@
+#include "stream_session.h"
+
+#include <algorithm>
+
+#include "log.h"
+
+using marketdata::SubscriptionRequest;
+using marketdata::MarketDataUpdate;
+using marketdata::OrderBookSnapshot;
+using marketdata::SymbolDirectory;
+
+StreamSession::StreamSession(PublisherEngine* engine, std::shared_ptr<OutboundStream> stream)
+    : engine_(engine), stream_(std::move(stream)) {}
+
+bool StreamSession::HandleRequest(const SubscriptionRequest& request) {
+    std::vector<std::string> instrument_ids = ResolveInstruments(request);
+    {
+        Log log;
+        log << "Received subscription request: Action=" << SubscriptionRequest::Action_Name(request.action())
+            << ", Instrument=" << request.instrument_id();
+        if (!request.instrument_ids().empty()) {
+            log << ", " << request.instrument_ids_size() << " more ids";
+        }
+        log << ", " << instrument_ids.size() << " instruments";
+    }
+
+    if (request.action() == SubscriptionRequest::SUBSCRIBE) {
+        // Announce the handles of all the new instruments, which their incremental updates
+        // carry instead of the id, in one message ahead of their snapshots
+        MarketDataUpdate directory_update;
+        std::vector<std::string> new_ids;
+        for (const std::string& instrument_id : instrument_ids) {
+            if (subscriptions_.find(instrument_id) != subscriptions_.end()) {
+                continue;
+            }
+            uint32_t handle = engine_->InstrumentHandle(instrument_id);
+            if (handle == 0) {
+                Log(LogLevel::kError) << "Cannot subscribe to " << instrument_id << ": no instrument handles left.";
+                continue;
+            }
+            SymbolDirectory::Entry* entry = directory_update.mutable_symbol_directory()->add_entries();
+            entry->set_instrument_id(instrument_id);
+            entry->set_instrument_handle(handle);
+            new_ids.push_back(instrument_id);
+        }
+        if (directory_update.has_symbol_directory()) {
+            stream_->Publish(std::make_shared<EncodedUpdate>(std::move(directory_update)));
+        }
+        for (const std::string& instrument_id : new_ids) {
+            if (!Subscribe(instrument_id, request)) {
+                return false;
+            }
+        }
+        UpdateSubscriptionCount();
+
+    } else if (request.action() == SubscriptionRequest::SNAPSHOT_ONLY) {
+        // One-off snapshots, for feed receivers: the handle to resolve each instrument's
+        // feed updates by, then its full-depth snapshot, ordered against its updates.
+        // Both come from the instrument's worker, which sends neither for an instrument
+        // it is not publishing, so a receiver is only told of handles a snapshot follows.
+        for (const std::string& instrument_id : instrument_ids) {
+            if (!engine_->PublishHandleAndSnapshot(instrument_id, stream_)) {
+                Log(LogLevel::kError) << "Cannot send snapshot for " << instrument_id << ": publisher engine stopped.";
+                return false;
+            }
+        }
+
+    } else if (request.action() == SubscriptionRequest::SNAPSHOT) {
+        for (const std::string& instrument_id : instrument_ids) {
+            if (!Resync(instrument_id)) {
+                return false;
+            }
+        }
+
+    } else if (request.action() == SubscriptionRequest::UNSUBSCRIBE) {
+        for (const std::string& instrument_id : instrument_ids) {
+            if (!Unsubscribe(instrument_id)) {
+                return false;
+            }
+        }
+        UpdateSubscriptionCount();
+    }
+    return true;
+}
+
+std::vector<std::string> StreamSession::ResolveInstruments(const SubscriptionRequest& request) const {
+    std::vector<std::string> instrument_ids;
+    auto add = [&](const std::string& instrument_id) {
+        if (instrument_id.empty() || instrument_id.back() != '*') {
+            if (!instrument_id.empty()) {
+                instrument_ids.push_back(instrument_id);
+            }
+            return;
+        }
+        std::string prefix = instrument_id.substr(0, instrument_id.size() - 1);
+        if (request.action() == SubscriptionRequest::SUBSCRIBE ||
+            request.action() == SubscriptionRequest::SNAPSHOT_ONLY) {
+            std::vector<std::string> matches = engine_->InstrumentIds(prefix);
+            instrument_ids.insert(instrument_ids.end(), matches.begin(), matches.end());
+        } else {
+            // Other actions only apply to this stream's own subscriptions
+            for (auto it = subscriptions_.lower_bound(prefix);
+                 it != subscriptions_.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+                instrument_ids.push_back(it->first);
+            }
+        }
+    };
+    add(request.instrument_id());
+    for (const std::string& instrument_id : request.instrument_ids()) {
+        add(instrument_id);
+    }
+    // Overlapping ids and patterns name each instrument once
+    std::sort(instrument_ids.begin(), instrument_ids.end());
+    instrument_ids.erase(std::unique(instrument_ids.begin(), instrument_ids.end()), instrument_ids.end());
+    return instrument_ids;
+}
+
+bool StreamSession::Subscribe(const std::string& instrument_id, const SubscriptionRequest& request) {
+    // Check if we are already streaming for this instrument on this stream
+    if (subscriptions_.find(instrument_id) != subscriptions_.end()) {
+        Log() << "Already streaming updates for " << instrument_id << " on this stream.";
+        return true;
+    }
+
+    // Join the shared producer for this instrument, through a conflating front if requested
+    Subscription subscription;
+    subscription.depth = request.depth();
+    if (request.conflate() || request.max_updates_per_second() > 0) {
+        subscription.conflated = std::make_shared<ConflatedSubscription>(stream_, request.max_updates_per_second());
+        subscription.subscriber = subscription.conflated;
+        Log log;
+        log << "Conflating updates for " << instrument_id;
+        if (request.max_updates_per_second() > 0) {
+            log << " at up to " << request.max_updates_per_second() << " updates/s";
+        }
+    } else {
+        subscription.subscriber = stream_;
+    }
+
+    // The engine queues the initial snapshot on the stream as it adds the subscriber,
+    // so the snapshot's sequence number lines up with the first update that follows
+    if (engine_->Subscribe(instrument_id, subscription.subscriber, stream_, subscription.depth)) {
+        Log log;
+        log << "Requested snapshot for instrument: " << instrument_id;
+        if (subscription.depth > 0) {
+            log << ", top " << subscription.depth << " levels only";
+        }
+    } else {
+        Log(LogLevel::kError) << "Cannot subscribe to " << instrument_id << ": publisher engine stopped.";
+        return false;
+    }
+    subscriptions_.emplace(instrument_id, std::move(subscription));
+    return true;
+}
+
+bool StreamSession::Resync(const std::string& instrument_id) {
+    // Resync one instrument in place; its subscription and the rest of the stream are untouched
+    auto it = subscriptions_.find(instrument_id);
+    if (it == subscriptions_.end()) {
+        Log() << "Ignoring snapshot request for unsubscribed instrument: " << instrument_id;
+        return true;
+    }
+    if (engine_->PublishSnapshot(instrument_id, stream_, it->second.depth)) {
+        Log() << "Requested recovery snapshot for instrument: " << instrument_id;
+    } else {
+        Log(LogLevel::kError) << "Cannot send recovery snapshot for " << instrument_id << ": publisher engine stopped.";
+        return false;
+    }
+    return true;
+}
+
+bool StreamSession::Unsubscribe(const std::string& instrument_id) {
+    // Leave the shared producer for this instrument. The engine sends the empty
+    // snapshot that confirms it, after the last update the stream is given.
+    auto it = subscriptions_.find(instrument_id);
+    if (it != subscriptions_.end()) {
+        Log() << "Stopping update stream for instrument: " << instrument_id;
+        Unsubscribe(instrument_id, it->second, stream_);
+        subscriptions_.erase(it);
+        return true;
+    }
+
+    // Send an empty snapshot upon unsubscription
+    MarketDataUpdate unsubscribe_update;
+    OrderBookSnapshot* snapshot = unsubscribe_update.mutable_snapshot();
+    snapshot->set_instrument_id(instrument_id); // Send for the specific instrument
+
+    if (stream_->Publish(std::make_shared<EncodedUpdate>(std::move(unsubscribe_update)))) {
+        Log() << "Queued empty snapshot for unsubscription: " << instrument_id;
+    } else {
+        Log(LogLevel::kError) << "Failed to send empty snapshot for unsubscription: " << instrument_id;
+        // If sending fails, client might be gone
+        return false;
+    }
+    return true;
+}
+
+void StreamSession::Unsubscribe(const std::string& instrument_id, Subscription& subscription,
+                                std::shared_ptr<Subscriber> snapshot_sink) {
+    engine_->Unsubscribe(instrument_id, subscription.subscriber.get(), std::move(snapshot_sink));
+    if (subscription.conflated) {
+        // Drop any merged delta still waiting so it cannot follow the unsubscribe snapshot
+        subscription.conflated->Deactivate();
+    }
+}
+
+void StreamSession::UnsubscribeAll() {
+    for (auto& entry : subscriptions_) {
+        Unsubscribe(entry.first, entry.second);
+    }
+    subscriptions_.clear();
+    UpdateSubscriptionCount();
+}
+
+void StreamSession::UpdateSubscriptionCount() {
+    stream_->metrics().subscriptions.store(subscriptions_.size(), std::memory_order_relaxed);
+}
@@ -0,0 +1,57 @@
+#ifndef STREAM_SESSION_H
+#define STREAM_SESSION_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "market_data.pb.h"
+#include "outbound_queue.h"
+#include "publisher_engine.h"
+
+// Subscription state of one Subscribe stream, shared by the sync and async servers.
+// It turns client requests into engine subscriptions and queues snapshots on the
+// stream's subscriber; the transport only has to feed it requests and drain the
+// subscriber.
+class StreamSession {
+public:
+    StreamSession(PublisherEngine* engine, std::shared_ptr<OutboundStream> stream);
+
+    // Applies one client request to each instrument it names, expanding prefix patterns
+    // (see SubscriptionRequest in market_data.proto). Returns false if the stream is
+    // broken and the read loop should stop.
+    bool HandleRequest(const marketdata::SubscriptionRequest& request);
+
+    // Removes every engine subscription held by this stream.
+    void UnsubscribeAll();
+
+private:
+    struct Subscription {
+        // What is registered with the engine: the stream itself, or a conflating front for it
+        std::shared_ptr<Subscriber> subscriber;
+        std::shared_ptr<ConflatedSubscription> conflated;
+        // Levels per side requested, 0 for full depth
+        uint32_t depth = 0;
+    };
+
+    // Instruments named by a request, patterns expanded, sorted and without repeats.
+    std::vector<std::string> ResolveInstruments(const marketdata::SubscriptionRequest& request) const;
+    // The per-instrument actions. Each returns false if the stream is broken.
+    bool Subscribe(const std::string& instrument_id, const marketdata::SubscriptionRequest& request);
+    bool Resync(const std::string& instrument_id);
+    bool Unsubscribe(const std::string& instrument_id);
+    // With snapshot_sink, the engine confirms the unsubscription with an empty snapshot.
+    void Unsubscribe(const std::string& instrument_id, Subscription& subscription,
+                     std::shared_ptr<Subscriber> snapshot_sink = nullptr);
+    // Publishes the number of subscriptions to the stream's metrics.
+    void UpdateSubscriptionCount();
+
+    PublisherEngine* engine_;
+    std::shared_ptr<OutboundStream> stream_;
+
+    // Instruments this stream is subscribed to; the updates themselves come from the shared engine
+    std::map<std::string, Subscription> subscriptions_;
+};
+
+#endif // STREAM_SESSION_H
@@ -0,0 +1,106 @@
+#include "stream_writer.h"
+
+#include "log.h"
+
+namespace {
+
+// Maximum number of queued updates written back to back before forcing a flush
+constexpr size_t kMaxWriteBatch = 64;
+
+// How long Close waits for a write in progress before cancelling the call
+constexpr std::chrono::seconds kCloseTimeout(1);
+
+} // namespace
+
+StreamWriter::StreamWriter(Stream* stream, BatchOptions batching, grpc::ServerContext* context)
+    : stream_(stream), context_(context), queue_(batching), thread_([this]() { WriterLoop(); }) {}
+
+StreamWriter::~StreamWriter() {
+    Close();
+}
+
+bool StreamWriter::Enqueue(OutboundItem item) {
+    if (closed_.load() || broken_.load()) {
+        return false;
+    }
+    // Only the transition from empty needs to wake the writer; otherwise it is
+    // already draining and will pick this update up in the current pass.
+    if (queue_.Push(std::move(item))) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cv_.notify_one();
+    }
+    return true;
+}
+
+void StreamWriter::Close() {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        closed_.store(true);
+        cv_.notify_all();
+        if (!cv_.wait_for(lock, kCloseTimeout, [this]() { return finished_; }) && context_ != nullptr) {
+            Log(LogLevel::kError) << "Stream writer still blocked after closing; cancelling the call.";
+            context_->TryCancel();
+        }
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void StreamWriter::WriterLoop() {
+    size_t batch = 0;
+    bool headers_sent = false;
+    while (!closed_.load()) {
+        OutboundQueue::Clock::time_point wake_at;
+        std::shared_ptr<const EncodedUpdate> update = queue_.Next(OutboundQueue::Clock::now(), &wake_at);
+        if (!update) {
+            // Nothing ready: sleep until something is queued or a rate-limited
+            // conflated update becomes due.
+            batch = 0;
+            std::unique_lock<std::mutex> lock(mutex_);
+            auto ready = [this]() { return queue_.HasPending() || closed_.load(); };
+            if (wake_at == OutboundQueue::Clock::time_point::max()) {
+                cv_.wait(lock, ready);
+            } else {
+                cv_.wait_until(lock, wake_at, ready);
+            }
+            continue;
+        }
+        if (broken_.load()) {
+            AddToSharedCounter(metrics().updates_dropped, 1);
+            continue;
+        }
+
+        // Writes carry a buffer hint while more are already queued behind them, so gRPC
+        // may hold them and flush them together; the batch cap bounds the added latency.
+        // The first write also carries the initial metadata and goes out unhinted: a
+        // hinted one is held until something else flushes the stream, and a client that
+        // only waits to read never does.
+        grpc::WriteOptions options;
+        if (queue_.batching().buffer_hints && headers_sent && queue_.HasPending() && ++batch < kMaxWriteBatch) {
+            options.set_buffer_hint();
+        } else {
+            batch = 0;
+        }
+        // Write blocks while the transport is not accepting more, e.g. under flow control
+        auto write_start = OutboundQueue::Clock::now();
+        bool written = stream_->Write(update->bytes(), options);
+        headers_sent = true;
+        StreamMetrics& stream_metrics = metrics();
+        AddToOwnCounter(stream_metrics.write_blocked_ns,
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(OutboundQueue::Clock::now() - write_start)
+                            .count());
+        if (written) {
+            AddToOwnCounter(stream_metrics.messages_sent, 1);
+            AddToOwnCounter(stream_metrics.bytes_sent, update->bytes().Length());
+        } else {
+            Log(LogLevel::kError) << "Failed to write update. Client likely disconnected.";
+            AddToSharedCounter(stream_metrics.updates_dropped, 1);
+            broken_.store(true);
+        }
+    }
+    AddToSharedCounter(metrics().updates_dropped, queue_.Clear());
+    std::lock_guard<std::mutex> lock(mutex_);
+    finished_ = true;
+    cv_.notify_all();
+}
@@ -0,0 +1,60 @@
+#ifndef STREAM_WRITER_H
+#define STREAM_WRITER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <grpcpp/grpcpp.h>
+
+#include "market_data.grpc.pb.h"
+#include "market_data.pb.h"
+#include "outbound_queue.h"
+
+// Outbound side of one synchronous Subscribe stream. Producers (engine workers and
+// the stream's read loop) only enqueue; a single writer thread owns the stream and
+// is the only caller of Write, so writes are ordered and a slow socket never blocks
+// a producer. Whatever has queued up since the last wakeup is written as one batch
+// with buffer hints, letting gRPC coalesce it into fewer frames and syscalls.
+class StreamWriter final : public OutboundStream {
+public:
+    // Updates are written as their pre-encoded bytes, so the stream comes from a raw handler
+    using Stream = grpc::ServerReaderWriter<grpc::ByteBuffer, marketdata::SubscriptionRequest>;
+
+    // With a context, a writer still blocked when the stream is closed is cancelled.
+    explicit StreamWriter(Stream* stream, BatchOptions batching = BatchOptions(),
+                          grpc::ServerContext* context = nullptr);
+    ~StreamWriter() override;
+
+    // Returns false once the writer is closed or the stream is broken.
+    bool Enqueue(OutboundItem item) override;
+
+    const OutboundQueue& queue() const override { return queue_; }
+
+    // Stops the writer thread, dropping anything still queued. After this returns the
+    // stream is never touched again. A write the client is not reading can block for
+    // as long as the client stays connected, so if the writer has not stopped within
+    // kCloseTimeout the call is cancelled to release it.
+    void Close();
+
+    bool broken() const { return broken_.load(); }
+
+private:
+    void WriterLoop();
+
+    Stream* stream_;
+    grpc::ServerContext* context_;
+    OutboundQueue queue_;
+    std::atomic<bool> closed_{false};
+    std::atomic<bool> broken_{false};
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    // Set, under mutex_, when the writer thread is done with the stream
+    bool finished_ = false;
+    std::thread thread_;
+};
+
+#endif // STREAM_WRITER_H
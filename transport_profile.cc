@@ -0,0 +1,106 @@
+#include "transport_profile.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace {
+
+// Large enough for a batch of full-depth snapshots, beyond gRPC's 4 MiB default
+constexpr int kMaxMessageSize = 64 * 1024 * 1024;
+
+struct ProfileSettings {
+    // Initial HTTP/2 stream window, and whether gRPC may grow it from measured bandwidth
+    int stream_window;
+    bool bdp_probe;
+    int max_frame_size;
+    // Bytes gRPC may buffer for writing before it stops accepting more
+    int write_buffer_size;
+    int keepalive_time_ms;
+    int keepalive_timeout_ms;
+    grpc_compression_algorithm compression;
+    // Sync server: pollers kept waiting per completion queue
+    int min_pollers;
+    int max_pollers;
+    // Batch window used when the user did not choose one
+    std::chrono::microseconds batch_window;
+    bool buffer_hints;
+};
+
+const ProfileSettings& Settings(TransportProfile profile) {
+    static const ProfileSettings latency = {
+        64 * 1024, false, 16 * 1024, 64 * 1024, 10000, 5000, GRPC_COMPRESS_NONE, 2, 4,
+        std::chrono::microseconds(0), false};
+    static const ProfileSettings throughput = {
+        8 * 1024 * 1024, true, 1024 * 1024, 4 * 1024 * 1024, 30000, 10000, GRPC_COMPRESS_GZIP, 1, 2,
+        std::chrono::microseconds(500), true};
+    return profile == TransportProfile::kLatency ? latency : throughput;
+}
+
+} // namespace
+
+bool ParseTransportProfile(const std::string& name, TransportProfile* profile) {
+    if (name == "default") {
+        *profile = TransportProfile::kDefault;
+    } else if (name == "latency") {
+        *profile = TransportProfile::kLatency;
+    } else if (name == "throughput") {
+        *profile = TransportProfile::kThroughput;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void ApplyTransportProfile(TransportProfile profile, grpc::ServerBuilder* builder) {
+    if (profile == TransportProfile::kDefault) {
+        return;
+    }
+    const ProfileSettings& settings = Settings(profile);
+    builder->SetMaxReceiveMessageSize(kMaxMessageSize);
+    builder->SetMaxSendMessageSize(kMaxMessageSize);
+    builder->AddChannelArgument(GRPC_ARG_HTTP2_STREAM_LOOKAHEAD_BYTES, settings.stream_window);
+    builder->AddChannelArgument(GRPC_ARG_HTTP2_BDP_PROBE, settings.bdp_probe ? 1 : 0);
+    builder->AddChannelArgument(GRPC_ARG_HTTP2_MAX_FRAME_SIZE, settings.max_frame_size);
+    builder->AddChannelArgument(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE, settings.write_buffer_size);
+    // Ping idle clients, and accept their pings at the rate the profile sends them
+    builder->AddChannelArgument(GRPC_ARG_KEEPALIVE_TIME_MS, settings.keepalive_time_ms);
+    builder->AddChannelArgument(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, settings.keepalive_timeout_ms);
+    builder->AddChannelArgument(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+    builder->AddChannelArgument(GRPC_ARG_HTTP2_MIN_RECV_PING_INTERVAL_WITHOUT_DATA_MS, settings.keepalive_time_ms);
+    builder->AddChannelArgument(GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA, 0);
+    builder->SetDefaultCompressionAlgorithm(settings.compression);
+    // One completion queue per core spreads the sync server's streams over them
+    builder->SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::NUM_CQS,
+                                 static_cast<int>(std::max(1u, std::thread::hardware_concurrency())));
+    builder->SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::MIN_POLLERS, settings.min_pollers);
+    builder->SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::MAX_POLLERS, settings.max_pollers);
+}
+
+void ApplyTransportProfile(TransportProfile profile, grpc::ChannelArguments* args) {
+    if (profile == TransportProfile::kDefault) {
+        return;
+    }
+    const ProfileSettings& settings = Settings(profile);
+    args->SetMaxReceiveMessageSize(kMaxMessageSize);
+    args->SetMaxSendMessageSize(kMaxMessageSize);
+    args->SetInt(GRPC_ARG_HTTP2_STREAM_LOOKAHEAD_BYTES, settings.stream_window);
+    args->SetInt(GRPC_ARG_HTTP2_BDP_PROBE, settings.bdp_probe ? 1 : 0);
+    args->SetInt(GRPC_ARG_HTTP2_MAX_FRAME_SIZE, settings.max_frame_size);
+    args->SetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE, settings.write_buffer_size);
+    args->SetInt(GRPC_ARG_KEEPALIVE_TIME_MS, settings.keepalive_time_ms);
+    args->SetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, settings.keepalive_timeout_ms);
+    args->SetInt(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+    args->SetInt(GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA, 0);
+    args->SetCompressionAlgorithm(settings.compression);
+}
+
+void ApplyTransportProfile(TransportProfile profile, bool explicit_window, BatchOptions* batching) {
+    if (profile == TransportProfile::kDefault) {
+        return;
+    }
+    const ProfileSettings& settings = Settings(profile);
+    if (!explicit_window) {
+        batching->window = settings.batch_window;
+    }
+    batching->buffer_hints = settings.buffer_hints;
+}
@@ -0,0 +1,40 @@
+#ifndef TRANSPORT_PROFILE_H
+#define TRANSPORT_PROFILE_H
+
+#include <string>
+
+#include <grpcpp/grpcpp.h>
+
+#include "outbound_queue.h"
+
+// Named sets of gRPC transport settings, selected with --profile on the server and on
+// every client binary. Both ends of a connection should use the same profile: flow
+// control windows, keepalive pings and compression only take full effect when the
+// peer is configured to match.
+//
+// kDefault leaves gRPC's own settings alone. kLatency writes every update as soon as
+// it is queued, with small flow control windows, no compression and keepalives that
+// notice a dead peer within seconds. kThroughput batches updates, lets gRPC coalesce
+// writes, opens large HTTP/2 windows and frames, and gzips messages. gRPC always
+// disables Nagle's algorithm on its sockets, so no profile needs to.
+enum class TransportProfile {
+    kDefault,
+    kLatency,
+    kThroughput,
+};
+
+// Accepts "default", "latency" and "throughput".
+bool ParseTransportProfile(const std::string& name, TransportProfile* profile);
+
+// Configures a server's HTTP/2, keepalive, message size, compression and
+// sync-server thread settings.
+void ApplyTransportProfile(TransportProfile profile, grpc::ServerBuilder* builder);
+
+// Configures a client channel to match a server running the same profile.
+void ApplyTransportProfile(TransportProfile profile, grpc::ChannelArguments* args);
+
+// Sets the stream write batching of the profile. A batch window the user chose is
+// kept; explicit_window says whether there is one.
+void ApplyTransportProfile(TransportProfile profile, bool explicit_window, BatchOptions* batching);
+
+#endif // TRANSPORT_PROFILE_H